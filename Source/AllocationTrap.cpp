@@ -0,0 +1,67 @@
+#include "AllocationTrap.h"
+
+#if PING_ALLOCATION_TRAP
+
+#include <cstdlib>
+#include <new>
+
+namespace
+{
+    thread_local bool trapArmed = false;
+
+    // Disarm around the assertion itself: jassert logs through juce::String,
+    // which allocates and would otherwise recurse straight back in here.
+    void checkHeapAccess() noexcept
+    {
+        if (! trapArmed)
+            return;
+        trapArmed = false;
+        jassertfalse; // heap touched on the audio thread — see the call stack
+        trapArmed = true;
+    }
+
+    void* trappedAlloc (std::size_t size) noexcept
+    {
+        checkHeapAccess();
+        return std::malloc (size != 0 ? size : 1);
+    }
+
+    void trappedFree (void* p) noexcept
+    {
+        if (p == nullptr)
+            return;
+        checkHeapAccess();
+        std::free (p);
+    }
+}
+
+bool AllocationTrap::isArmed() noexcept              { return trapArmed; }
+void AllocationTrap::setArmed (bool shouldBeArmed) noexcept { trapArmed = shouldBeArmed; }
+
+// Only the unaligned forms are replaced; the C++17 align_val_t overloads keep
+// the library implementation, which never calls into these.
+void* operator new (std::size_t size)
+{
+    if (auto* p = trappedAlloc (size))
+        return p;
+    throw std::bad_alloc();
+}
+
+void* operator new[] (std::size_t size)
+{
+    if (auto* p = trappedAlloc (size))
+        return p;
+    throw std::bad_alloc();
+}
+
+void* operator new   (std::size_t size, const std::nothrow_t&) noexcept { return trappedAlloc (size); }
+void* operator new[] (std::size_t size, const std::nothrow_t&) noexcept { return trappedAlloc (size); }
+
+void operator delete   (void* p) noexcept                          { trappedFree (p); }
+void operator delete[] (void* p) noexcept                          { trappedFree (p); }
+void operator delete   (void* p, std::size_t) noexcept             { trappedFree (p); }
+void operator delete[] (void* p, std::size_t) noexcept             { trappedFree (p); }
+void operator delete   (void* p, const std::nothrow_t&) noexcept   { trappedFree (p); }
+void operator delete[] (void* p, const std::nothrow_t&) noexcept   { trappedFree (p); }
+
+#endif // PING_ALLOCATION_TRAP
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <JuceHeader.h>
+
+// ── Audio-thread allocation trap ────────────────────────────────────────────
+// Debug-build guard that asserts whenever the heap is touched from inside a
+// ScopedAllocationTrap. PingProcessor::processBlock arms one for its whole
+// body, so any allocation that sneaks back into the real-time path (a
+// temporary juce::AudioBuffer, a std::vector growth, a coefficient object, …)
+// trips a jassert the first time it runs under a debugger.
+//
+// The trap is implemented in AllocationTrap.cpp by replacing the global
+// operator new / delete family. It is compiled in only when
+// PING_ALLOCATION_TRAP is non-zero, which defaults to JUCE_DEBUG; release
+// builds keep the standard allocator untouched and ScopedAllocationTrap
+// compiles down to nothing.
+// ───────────────────────────────────────────────────────────────────────────
+#ifndef PING_ALLOCATION_TRAP
+ #define PING_ALLOCATION_TRAP JUCE_DEBUG
+#endif
+
+namespace AllocationTrap
+{
+   #if PING_ALLOCATION_TRAP
+    /** True while the calling thread is inside a ScopedAllocationTrap. */
+    bool isArmed() noexcept;
+    void setArmed (bool shouldBeArmed) noexcept;
+   #else
+    inline bool isArmed() noexcept           { return false; }
+    inline void setArmed (bool) noexcept     {}
+   #endif
+}
+
+/** Arms the allocation trap for the calling thread for the lifetime of the
+    object. Nesting is supported (the previous state is restored). */
+class ScopedAllocationTrap
+{
+public:
+    ScopedAllocationTrap() noexcept : wasArmed (AllocationTrap::isArmed())
+    {
+        AllocationTrap::setArmed (true);
+    }
+
+    ~ScopedAllocationTrap() noexcept { AllocationTrap::setArmed (wasArmed); }
+
+private:
+    const bool wasArmed;
+
+    JUCE_DECLARE_NON_COPYABLE (ScopedAllocationTrap)
+};
@@ -0,0 +1,131 @@
+#pragma once
+
+#include <array>
+#include <cmath>
+#include <vector>
+
+#if defined(__AVX__)
+ #include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64)
+ #include <emmintrin.h>
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+ #include <arm_neon.h>
+#endif
+
+// ── BandAmpKernel ───────────────────────────────────────────────────────────
+// Per-reflection octave-band amplitude kernel for calcRefs / calcRefsPolygon.
+//
+// Every image source multiplies a 1/r start value by a chain of per-band
+// factors (floor, ceiling, wall, organ-case and vault absorption raised to
+// the bounce counts, air absorption, mic polar gain, speaker directivity,
+// polarity). The engine used to evaluate five std::pow calls and a
+// std::map lookup (micG) per band per image source.
+//
+//   • The integer-exponent powers now come from PowerTable rows built once
+//     per calcRefs call. Each entry is std::pow (base, k) — the same call the
+//     inline loop made — so every factor is bit-identical.
+//   • The eight bands are multiplied as eight lanes (AVX: 2 × 4, SSE2 /
+//     NEON: 4 × 2, else scalar) in exactly the scalar order. Each lane is a
+//     chain of correctly rounded IEEE multiplies, so the result matches
+//     amplitudesScalar() bit for bit (IR_48) and IR_11 / IR_14 hold.
+//
+// Pure header — no JUCE dependency — so the test binary links it directly.
+// ───────────────────────────────────────────────────────────────────────────
+namespace BandAmpKernel
+{
+    constexpr int kNumBands = 8;
+    constexpr int kNumFactors = 5;
+    using Bands = std::array<double, kNumBands>;
+
+    /** Row k holds base[b]^k for k in [0, maxExp]. Row 0 is exactly 1.0, so a
+        bounce count of zero multiplies by one (a no-op in IEEE arithmetic). */
+    class PowerTable
+    {
+    public:
+        void build (const Bands& base, int maxExp)
+        {
+            rows.assign ((size_t) (maxExp + 1) * kNumBands, 1.0);
+            for (int k = 1; k <= maxExp; ++k)
+                for (int b = 0; b < kNumBands; ++b)
+                    rows[(size_t) (k * kNumBands + b)] = std::pow (base[(size_t) b], (double) k);
+        }
+
+        const double* row (int k) const noexcept { return rows.data() + (size_t) k * kNumBands; }
+        size_t bytes() const noexcept            { return rows.size() * sizeof (double); }
+
+    private:
+        std::vector<double> rows;
+    };
+
+    /** Reference kernel. out[b] = a0 · f[0][b] · … · f[4][b] · air[b] · mic[b]
+        · sg[b] · polarity, multiplied left to right. */
+    inline void amplitudesScalar (double a0, const double* const (&f)[kNumFactors],
+                                  const double* air, const double* mic, const double* sg,
+                                  double polarity, double* out) noexcept
+    {
+        for (int b = 0; b < kNumBands; ++b)
+        {
+            double a = a0;
+            for (int i = 0; i < kNumFactors; ++i)
+                a *= f[i][b];
+            out[b] = a * air[b] * mic[b] * sg[b] * polarity;
+        }
+    }
+
+    /** Same result as amplitudesScalar, eight bands at a time. */
+    inline void amplitudes (double a0, const double* const (&f)[kNumFactors],
+                            const double* air, const double* mic, const double* sg,
+                            double polarity, double* out) noexcept
+    {
+       #if defined(__AVX__)
+        for (int h = 0; h < kNumBands; h += 4)
+        {
+            __m256d a = _mm256_set1_pd (a0);
+            for (int i = 0; i < kNumFactors; ++i)
+                a = _mm256_mul_pd (a, _mm256_loadu_pd (f[i] + h));
+            a = _mm256_mul_pd (a, _mm256_loadu_pd (air + h));
+            a = _mm256_mul_pd (a, _mm256_loadu_pd (mic + h));
+            a = _mm256_mul_pd (a, _mm256_loadu_pd (sg + h));
+            _mm256_storeu_pd (out + h, _mm256_mul_pd (a, _mm256_set1_pd (polarity)));
+        }
+       #elif defined(__SSE2__) || defined(_M_X64)
+        for (int h = 0; h < kNumBands; h += 2)
+        {
+            __m128d a = _mm_set1_pd (a0);
+            for (int i = 0; i < kNumFactors; ++i)
+                a = _mm_mul_pd (a, _mm_loadu_pd (f[i] + h));
+            a = _mm_mul_pd (a, _mm_loadu_pd (air + h));
+            a = _mm_mul_pd (a, _mm_loadu_pd (mic + h));
+            a = _mm_mul_pd (a, _mm_loadu_pd (sg + h));
+            _mm_storeu_pd (out + h, _mm_mul_pd (a, _mm_set1_pd (polarity)));
+        }
+       #elif defined(__ARM_NEON) && defined(__aarch64__)
+        for (int h = 0; h < kNumBands; h += 2)
+        {
+            float64x2_t a = vdupq_n_f64 (a0);
+            for (int i = 0; i < kNumFactors; ++i)
+                a = vmulq_f64 (a, vld1q_f64 (f[i] + h));
+            a = vmulq_f64 (a, vld1q_f64 (air + h));
+            a = vmulq_f64 (a, vld1q_f64 (mic + h));
+            a = vmulq_f64 (a, vld1q_f64 (sg + h));
+            vst1q_f64 (out + h, vmulq_f64 (a, vdupq_n_f64 (polarity)));
+        }
+       #else
+        amplitudesScalar (a0, f, air, mic, sg, polarity, out);
+       #endif
+    }
+
+    /** Instruction set amplitudes() was compiled for (benchmarks / test logs). */
+    inline const char* isaName() noexcept
+    {
+       #if defined(__AVX__)
+        return "AVX";
+       #elif defined(__SSE2__) || defined(_M_X64)
+        return "SSE2";
+       #elif defined(__ARM_NEON) && defined(__aarch64__)
+        return "NEON";
+       #else
+        return "scalar";
+       #endif
+    }
+}
@@ -0,0 +1,145 @@
+#pragma once
+
+#include <cstdint>
+#include <list>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+
+// ── ByteBudgetLRU ───────────────────────────────────────────────────────────
+// The map, LRU list, byte budget and eviction shared by SynthStageCache and
+// DecodedIRCache. Each entry carries its own byte count; once the total
+// exceeds the budget, entries are evicted least-recently-used first. A
+// budget of 0 disables the cache: find() always misses without counting it
+// and insert() stores nothing.
+//
+// Values are copied out under the lock, so Value should be cheap to copy
+// (the caches store shared_ptrs to immutable data). Thread-safe; one mutex
+// guards the map and the list. Pure header — no JUCE dependency.
+// ───────────────────────────────────────────────────────────────────────────
+struct ByteBudgetLRUStats
+{
+    uint64_t hits = 0, misses = 0, evictions = 0;
+    size_t   usedBytes = 0, numEntries = 0;
+};
+
+template <typename Key, typename Value>
+class ByteBudgetLRU
+{
+public:
+    using Stats = ByteBudgetLRUStats;
+
+    explicit ByteBudgetLRU (size_t budget = 0) : budgetBytes (budget) {}
+
+    /** Sets the byte budget, evicting down to it. 0 disables and empties the
+        cache. */
+    void setBudgetBytes (size_t budget)
+    {
+        std::lock_guard<std::mutex> lock (mutex);
+        budgetBytes = budget;
+        evictToBudget();
+    }
+
+    size_t getBudgetBytes() const
+    {
+        std::lock_guard<std::mutex> lock (mutex);
+        return budgetBytes;
+    }
+
+    /** Copies the value stored under key into out and makes it most recently
+        used, if there is one and accept (value) returns true; otherwise
+        counts a miss and leaves the entry where it is. */
+    template <typename Accept>
+    bool find (const Key& key, Value& out, Accept&& accept)
+    {
+        std::lock_guard<std::mutex> lock (mutex);
+        if (budgetBytes == 0)
+            return false;
+
+        auto it = entries.find (key);
+        if (it == entries.end() || ! accept (it->second.value))
+        {
+            ++stats.misses;
+            return false;
+        }
+        lru.splice (lru.begin(), lru, it->second.lruPos);
+        ++stats.hits;
+        out = it->second.value;
+        return true;
+    }
+
+    bool find (const Key& key, Value& out)
+    {
+        return find (key, out, [] (const Value&) { return true; });
+    }
+
+    /** Stores value under key (replacing any entry there), then evicts the
+        least recently used entries until the total fits the budget. A value
+        larger than the whole budget is not stored. */
+    void insert (const Key& key, Value value, size_t bytes)
+    {
+        std::lock_guard<std::mutex> lock (mutex);
+        if (bytes > budgetBytes)
+            return;
+
+        erase (key);
+        lru.push_front (key);
+        entries[key] = Entry { std::move (value), bytes, lru.begin() };
+        stats.usedBytes += bytes;
+        evictToBudget();
+    }
+
+    void clear()
+    {
+        std::lock_guard<std::mutex> lock (mutex);
+        entries.clear();
+        lru.clear();
+        stats.usedBytes = 0;
+    }
+
+    Stats getStats() const
+    {
+        std::lock_guard<std::mutex> lock (mutex);
+        Stats s = stats;
+        s.numEntries = entries.size();
+        return s;
+    }
+
+private:
+    struct Entry
+    {
+        Value value;
+        size_t bytes = 0;
+        typename std::list<Key>::iterator lruPos;
+    };
+
+    void erase (const Key& key)
+    {
+        auto it = entries.find (key);
+        if (it == entries.end())
+            return;
+        stats.usedBytes -= it->second.bytes;
+        lru.erase (it->second.lruPos);
+        entries.erase (it);
+    }
+
+    void evictToBudget()
+    {
+        while (stats.usedBytes > budgetBytes && ! lru.empty())
+        {
+            // Copy: erase() destroys the list node the reference would point at.
+            const Key oldest = lru.back();
+            erase (oldest);
+            ++stats.evictions;
+        }
+    }
+
+    mutable std::mutex mutex;
+    size_t budgetBytes = 0;
+    std::unordered_map<Key, Entry> entries;
+    std::list<Key> lru;   // front = most recently used
+    Stats stats;
+
+    ByteBudgetLRU (const ByteBudgetLRU&) = delete;
+    ByteBudgetLRU& operator= (const ByteBudgetLRU&) = delete;
+};
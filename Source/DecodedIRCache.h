@@ -0,0 +1,107 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "ByteBudgetLRU.h"
+
+// ── DecodedIRCache ──────────────────────────────────────────────────────────
+// Decoded audio of IR files, so a reload of a file that has not changed
+// skips the disk read and the WAV / AIFF decode.
+//
+// Every Stretch, Decay, Reverse or trim edit re-runs PingProcessor::
+// loadIRFromFile, which decodes the MAIN file and its _direct / _outrig /
+// _ambient siblings before the transform pipeline (loadIRFromBuffer). With
+// the cache on, those four decodes become lookups and only the transform
+// stage runs again. Each file is its own entry, so a set uses up to four.
+//
+// The key is the full path plus the file's modification time and size
+// (makeKey), so rewriting a file — re-exporting a synth set, replacing a
+// WAV in the IR folder — misses and decodes it afresh; the stale entry
+// ages out of the LRU.
+//
+// Values are immutable (shared_ptr<const DecodedIR>); evicting an entry a
+// load still holds is safe. Storage, the byte budget and LRU eviction are
+// ByteBudgetLRU's, as in SynthStageCache. A budget of 0 (the default)
+// disables the cache: find() always misses and insert() does nothing, so
+// offline Tools read the file every time; the plugin turns it on
+// (PingEditor).
+//
+// Thread-safe (ByteBudgetLRU's mutex). Pure header — no JUCE dependency.
+// ───────────────────────────────────────────────────────────────────────────
+class DecodedIRCache
+{
+public:
+    /** Budget the editor uses. A 20 s four-channel IR at 48 kHz decodes to
+        ~15 MB, so this keeps several full MAIN + sibling sets. */
+    static constexpr size_t kInteractiveBudgetBytes = (size_t) 256 << 20;
+
+    /** One decoded file: numChannels planar channels of numSamples each. */
+    struct DecodedIR
+    {
+        double sampleRate = 0.0;
+        int numChannels = 0;
+        int numSamples = 0;
+        std::vector<float> samples;   // channel c starts at c * numSamples
+
+        const float* channel (int c) const noexcept { return samples.data() + (size_t) c * (size_t) numSamples; }
+        float*       channel (int c) noexcept       { return samples.data() + (size_t) c * (size_t) numSamples; }
+        size_t       bytes() const noexcept         { return samples.size() * sizeof (float); }
+    };
+
+    using Stats = ByteBudgetLRUStats;
+
+    explicit DecodedIRCache (size_t budget = 0) : store (budget) {}
+
+    /** Process-wide cache shared by every plugin instance. */
+    static DecodedIRCache& shared()
+    {
+        static DecodedIRCache cache;
+        return cache;
+    }
+
+    /** Cache key for a file: its full path, modification time (ms) and size. */
+    static std::string makeKey (const std::string& fullPath, int64_t modTimeMs, int64_t sizeBytes)
+    {
+        return fullPath + '\n' + std::to_string (modTimeMs) + '\n' + std::to_string (sizeBytes);
+    }
+
+    /** Sets the byte budget, evicting down to it. 0 disables and empties the
+        cache. */
+    void setBudgetBytes (size_t budget) { store.setBudgetBytes (budget); }
+    size_t getBudgetBytes() const       { return store.getBudgetBytes(); }
+    bool isEnabled() const              { return getBudgetBytes() > 0; }
+
+    /** The file decoded under key, or nullptr. A hit makes it most recently
+        used. */
+    std::shared_ptr<const DecodedIR> find (const std::string& key)
+    {
+        std::shared_ptr<const DecodedIR> value;
+        store.find (key, value);
+        return value;
+    }
+
+    /** Stores value under key (replacing any entry there), then evicts the
+        least recently used entries until the total fits the budget. A file
+        larger than the whole budget is not stored. */
+    void insert (const std::string& key, std::shared_ptr<const DecodedIR> value)
+    {
+        if (value != nullptr)
+        {
+            const size_t bytes = value->bytes();
+            store.insert (key, std::move (value), bytes);
+        }
+    }
+
+    void clear()             { store.clear(); }
+    Stats getStats() const   { return store.getStats(); }
+
+private:
+    ByteBudgetLRU<std::string, std::shared_ptr<const DecodedIR>> store;
+
+    DecodedIRCache (const DecodedIRCache&) = delete;
+    DecodedIRCache& operator= (const DecodedIRCache&) = delete;
+};
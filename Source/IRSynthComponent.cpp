@@ -1,5 +1,6 @@
 #include "IRSynthComponent.h"
 #include "PingBinaryData.h"
+#include "SynthStageCache.h"
 
 // Small custom-paint button used for the Option-mirror axis selector.
 // Renders a rounded rectangle with a dashed line through the centre — vertical
@@ -129,12 +130,22 @@ namespace
 
 // Out-of-line destructor so unique_ptr<MirrorAxisButton> sees the complete
 // type defined above in this translation unit.
-IRSynthComponent::~IRSynthComponent() = default;
+IRSynthComponent::~IRSynthComponent()
+{
+    // Stop an in-flight Calculate IR promptly; synthPool's destructor waits
+    // for the job to return.
+    invalidatePendingSynth();
+}
 
 IRSynthComponent::IRSynthComponent()
 {
     setOpaque (true);
 
+    // Interactive editing re-synthesises after small edits, so keep stage
+    // results around: unchanged mic paths / stages come from the cache.
+    // Process-wide and idempotent, so every editor instance may set it.
+    SynthStageCache::shared().setBudgetBytes (SynthStageCache::kInteractiveBudgetBytes);
+
     // Load background texture (same brushed-steel image as the main plugin UI)
     bgTexture = juce::ImageCache::getFromMemory (BinaryData::texture_bg_jpg,
                                                   BinaryData::texture_bg_jpgSize);
@@ -836,6 +847,14 @@ IRSynthComponent::IRSynthComponent()
     progressValue = 0.0;
     progressLabel.setText ("", juce::dontSendNotification);
     progressLabel.setColour (juce::Label::textColourId, textDim);
+    progressLabel.addMouseListener (this, false);
+
+    addChildComponent (profileOverlay);
+    profileOverlay.setFont (juce::FontOptions (juce::Font::getDefaultMonospacedFontName(), 10.0f, juce::Font::plain));
+    profileOverlay.setJustificationType (juce::Justification::topLeft);
+    profileOverlay.setColour (juce::Label::backgroundColourId, juce::Colours::black.withAlpha (0.75f));
+    profileOverlay.setColour (juce::Label::textColourId, juce::Colours::white.withAlpha (0.9f));
+    profileOverlay.setInterceptsMouseClicks (false, false);
 
     addAndMakeVisible (doneButton);
     doneButton.addListener (this);
@@ -970,6 +989,7 @@ void IRSynthComponent::resized()
 
     layoutControls (leftCol);
     floorPlanComponent.setBounds (rightCol.reduced (8));
+    profileOverlay.setBounds (floorPlanComponent.getBounds().reduced (6));
     layoutMicPathsStrip (micStripArea);
 
     // Lay out the four per-path filename labels along the LOADED row. The row
@@ -1784,9 +1804,10 @@ void IRSynthComponent::timerCallback()
 
 void IRSynthComponent::buttonClicked (juce::Button* b)
 {
-    if (b == &previewButton && ! synthRunning.load())
+    // Both buttons stay live while a job runs: clicking again preempts it.
+    if (b == &previewButton)
         startSynthesis();
-    else if (b == &bakeBalanceButton && ! synthRunning.load())
+    else if (b == &bakeBalanceButton)
         startSynthesis (true);
     else if (b == &doneButton)
         onDone();
@@ -1976,17 +1997,28 @@ void IRSynthComponent::startSynthesis (bool bakeCurrentBalance)
         p.baked_tail_gain = 1.0;
     }
 
+    // Interactive renders use the vectorised FDN core (~4× faster tail,
+    // deviation far below audibility — IR_52).
+    p.fdn_vectorised = true;
+
     lastRenderParams = p;
     synthRunning = true;
+
+    // Preempt any job still running: cancel its token so it bails out at its
+    // next checkpoint and frees the task pool, then queue this one behind it
+    // on synthPool. The old job's completion sees a stale generation and is
+    // dropped, so only the newest Calculate ever touches the UI.
+    SynthTaskPool::CancellationToken token;
+    {
+        const juce::SpinLock::ScopedLockType sl (synthCancelLock);
+        synthCancel.cancel();
+        synthCancel = token;
+    }
+    const int generation = ++synthGeneration;
+
     // Fresh Calculate run: clear any invalidation flag set by a previous
-    // preset switch. If the user kicks off Calculate, navigates away, then
-    // kicks off another Calculate before the first finishes, the second
-    // startSynthesis() re-arms the flag; the first job's completion still
-    // sees the flag as false only if no intervening invalidation happened,
-    // which is the correct "keep whichever finished last" semantics.
+    // preset switch.
     pendingSynthInvalidated.store (false);
-    previewButton.setEnabled (false);
-    bakeBalanceButton.setEnabled (false);
     // Lock the rest of the IR Synth UI for the duration of the background
     // synth. Prevents the user from (a) leaving via Main Menu mid-calc,
     // (b) tweaking parameters under the impression they'd apply to the
@@ -1997,23 +2029,53 @@ void IRSynthComponent::startSynthesis (bool bakeCurrentBalance)
     progressValue = 0.0;
     progressLabel.setText ("Starting\xe2\x80\xa6", juce::dontSendNotification);
 
-    synthPool.addJob ([this, p]
+    synthPool.addJob ([this, p, token, generation]
     {
-        IRSynthProgressFn progressCb = [this] (double frac, const std::string& msg)
+        // A job cancelled while still queued skips the synth entirely.
+        IRSynthResultF result;
+        result.cancelled = true;
+        if (! token.isCancelled())
         {
-            juce::MessageManager::callAsync ([this, frac, msg]
+            // Two-stage synthesis: a low-order, shortened preview (tens of
+            // milliseconds) goes to the convolvers straight away, then the
+            // full-quality IR below replaces it. The editor loads the second
+            // one as a refinement (short shallow dip, not a fade from silence).
+            // The preview runs first rather than beside the full pass: waits
+            // on the shared task pool help with any queued task, so the full
+            // pass's long stages would end up inside the preview's waits.
+            IRSynthResultF preview = IRSynthEngine::synthPreviewIR<float> (p, nullptr, token);
+            if (preview.success)
             {
-                updateProgress (frac, juce::String (msg));
-            });
-        };
+                juce::MessageManager::callAsync ([this, preview, generation]
+                {
+                    if (generation != synthGeneration || pendingSynthInvalidated.load())
+                        return;
+                    progressLabel.setText ("Preview loaded, refining\xe2\x80\xa6", juce::dontSendNotification);
+                    if (onComplete)
+                        onComplete (preview);
+                });
+            }
 
-        IRSynthResult result = IRSynthEngine::synthIR (p, progressCb);
+            IRSynthProgressFn progressCb = [this, token] (double frac, const std::string& msg)
+            {
+                if (token.isCancelled())
+                    return;
+                juce::MessageManager::callAsync ([this, frac, msg]
+                {
+                    updateProgress (frac, juce::String (msg));
+                });
+            };
 
-        juce::MessageManager::callAsync ([this, result]
+            result = IRSynthEngine::synthIR<float> (p, progressCb, token);
+        }
+
+        juce::MessageManager::callAsync ([this, result, generation]
         {
+            // Preempted by a newer Calculate, whose completion owns the UI.
+            if (generation != synthGeneration)
+                return;
+
             synthRunning = false;
-            previewButton.setEnabled (true);
-            bakeBalanceButton.setEnabled (true);
             // Re-enable the rest of the UI (Main Menu, sliders, combos,
             // floor-plan, Save/Export/Import, IR combo) that startSynthesis
             // locked. Runs BEFORE the invalidation check so the user
@@ -2025,8 +2087,9 @@ void IRSynthComponent::startSynthesis (bool bakeCurrentBalance)
             // If the user loaded a new preset / IR while the synth was
             // running in the pool, installing this (now stale) result
             // would silently overwrite the freshly-loaded convolver
-            // contents. Drop it.
-            if (pendingSynthInvalidated.load())
+            // contents. invalidatePendingSynth() has already cancelled the
+            // synth; drop whatever it returned.
+            if (pendingSynthInvalidated.load() || result.cancelled)
             {
                 progressLabel.setText ("Cancelled (preset changed).", juce::dontSendNotification);
                 return;
@@ -2054,6 +2117,11 @@ void IRSynthComponent::startSynthesis (bool bakeCurrentBalance)
                 doneMsg += "  Peak: silent.";
             }
             progressLabel.setText (doneMsg, juce::dontSendNotification);
+            if (result.success)
+            {
+                lastProfile = result.profile;
+                updateProfileOverlay();
+            }
             if (result.success && onComplete)
             {
                 onComplete (result);
@@ -2136,8 +2204,8 @@ void IRSynthComponent::setInteractionLocked (bool locked)
     importIRButton.setEnabled (e);
     doneButton    .setEnabled (e);
 
-    // previewButton / bakeBalanceButton are managed by startSynthesis + the
-    // completion callAsync so their own disable lifecycle wins.
+    // previewButton / bakeBalanceButton stay enabled: clicking either while
+    // a job runs preempts it with a fresh one (see startSynthesis).
 }
 
 void IRSynthComponent::onDone()
@@ -2158,3 +2226,52 @@ void IRSynthComponent::updateProgress (double fraction, const juce::String& mess
     progressValue = fraction;
     progressLabel.setText (message, juce::dontSendNotification);
 }
+
+void IRSynthComponent::mouseDown (const juce::MouseEvent& e)
+{
+    // Alt-click on the progress label toggles the synth profile overlay.
+    if (e.eventComponent == &progressLabel && e.mods.isAltDown())
+    {
+        profileOverlay.setVisible (! profileOverlay.isVisible());
+        profileOverlay.toFront (false);
+        updateProfileOverlay();
+    }
+}
+
+void IRSynthComponent::updateProfileOverlay()
+{
+    if (! profileOverlay.isVisible())
+        return;
+
+    if (lastProfile.stages.empty())
+    {
+        profileOverlay.setText ("No synth profile yet - run Calculate IR.", juce::dontSendNotification);
+        return;
+    }
+
+    auto pad = [] (juce::String s, int width, bool right)
+    {
+        while (s.length() < width)
+            s = right ? " " + s : s + " ";
+        return s;
+    };
+
+    juce::String text = pad ("path", 8, false) + pad ("stage", 8, false) + pad ("wall ms", 9, true)
+                      + pad ("cpu ms", 9, true) + pad ("MB", 8, true) + pad ("items", 10, true) + "\n";
+    for (const auto& s : lastProfile.stages)
+    {
+        text += pad (s.path, 8, false) + pad (s.stage, 8, false)
+              + pad (juce::String (s.wallMs, 1), 9, true)
+              + pad (juce::String (s.cpuMs, 1), 9, true)
+              + pad (juce::String ((double) s.peakBytes / (1024.0 * 1024.0), 1), 8, true)
+              + pad (juce::String ((juce::int64) s.items), 10, true);
+        if (s.nodes > 0)
+            text += "  nodes " + juce::String ((juce::int64) s.nodes);
+        if (s.cacheHits > 0)
+            text += "  cached " + juce::String ((juce::int64) s.cacheHits);
+        text += "\n";
+    }
+    text += "total " + juce::String (lastProfile.totalWallMs, 1) + " ms wall, "
+          + juce::String (lastProfile.totalCpuMs(), 1) + " ms cpu";
+    profileOverlay.setText (text, juce::dontSendNotification);
+}
@@ -23,31 +23,37 @@ class IRSynthComponent : public juce::Component,
 {
 public:
     /** Called when synthesis completes. Run on message thread. */
-    using OnCompleteFn = std::function<void (const IRSynthResult&)>;
+    using OnCompleteFn = std::function<void (const IRSynthResultF&)>;
 
     explicit IRSynthComponent();
     ~IRSynthComponent() override;   // out-of-line so unique_ptr<MirrorAxisButton> can see the full type
 
     void paint (juce::Graphics& g) override;
     void resized() override;
+    void mouseDown (const juce::MouseEvent& e) override;
 
     /** Called when synthesis completes successfully – loads IR into processor, caller stays on page. */
     void setOnComplete (OnCompleteFn fn) { onComplete = std::move (fn); }
 
-    /** Discard the result of any in-flight Calculate IR job when it
-        eventually completes, instead of installing it in the convolvers.
-        Call this before loading a new preset or a new IR from disk so a
-        pending background synth can't overwrite the freshly-loaded IR.
-        Safe to call whether or not a job is actually running — a no-op
-        if nothing is pending. */
-    void invalidatePendingSynth() noexcept { pendingSynthInvalidated.store (true); }
+    /** Cancel any in-flight Calculate IR job and discard its result instead
+        of installing it in the convolvers. Call this before loading a new
+        preset or a new IR from disk so a pending background synth can't
+        overwrite the freshly-loaded IR. The job stops at its next engine
+        checkpoint (a few ms) and frees the synth task pool. Safe to call
+        from any thread, whether or not a job is actually running. */
+    void invalidatePendingSynth() noexcept
+    {
+        pendingSynthInvalidated.store (true);
+        const juce::SpinLock::ScopedLockType sl (synthCancelLock);
+        synthCancel.cancel();
+    }
 
     /** Enable/disable every user-interactive control in the IR Synth panel
-        except the Calculate IR and Bake Balance buttons (which have their
-        own `synthRunning` lifecycle) and the progress bar/label. Used to
-        lock the UI for the ~1 s (typical) to ~10 s (worst case, big
-        polygon room) while a Calculate IR job is running on the synth
-        pool, so the user can't (a) navigate away via Main Menu and get
+        except the Calculate IR and Bake Balance buttons (which stay live
+        so a second click preempts the running job) and the progress
+        bar/label. Used to lock the UI for the ~1 s (typical) to ~10 s
+        (worst case, big polygon room) while a Calculate IR job is running
+        on the synth pool, so the user can't (a) navigate away via Main Menu and get
         confused, (b) change parameters that the in-flight synth is not
         using, or (c) Save the still-old IR from the bottom bar. */
     void setInteractionLocked (bool locked);
@@ -115,6 +121,7 @@ private:
     void onDone();
     void updateRT60Display();
     void updateProgress (double fraction, const juce::String& message);
+    void updateProfileOverlay();
 
     /** Lay out all controls within the left column. Stores section header bounds for paint(). */
     void layoutControls (juce::Rectangle<int> leftBounds);
@@ -340,6 +347,12 @@ private:
     juce::Label progressLabel;
     juce::TextButton doneButton { "Main Menu" };
 
+    // Developer overlay over the floor plan: per-stage timings of the last
+    // completed synth (IRSynthResult::profile). Alt-click the progress label
+    // to toggle it.
+    juce::Label profileOverlay;
+    SynthProfile lastProfile;
+
     bool dirty = false;
     bool suppressingParamNotifications = false;
     juce::String cleanIRName;
@@ -354,7 +367,16 @@ private:
     // setStateInformation has installed the new preset's IR and silently
     // overwrites it with the pre-switch preset's synthesised buffer.
     std::atomic<bool> pendingSynthInvalidated { false };
-    std::unique_ptr<IRSynthResult> pendingResult;
+    // Cancellation token of the newest Calculate IR job. startSynthesis()
+    // cancels the previous job's token before queuing a new one, so a second
+    // Calculate preempts the first instead of waiting for it. Replaced on the
+    // message thread, cancelled from any thread — hence the lock.
+    SynthTaskPool::CancellationToken synthCancel;
+    juce::SpinLock synthCancelLock;
+    // Message thread only. Bumped by every startSynthesis(); a completion
+    // whose generation is stale belongs to a preempted job and is ignored.
+    int synthGeneration = 0;
+    std::unique_ptr<IRSynthResultF> pendingResult;
     IRSynthParams lastRenderParams;
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (IRSynthComponent)
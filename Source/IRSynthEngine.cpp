@@ -1,11 +1,19 @@
 #include "IRSynthEngine.h"
+#include "BandAmpKernel.h"
+#include "FdnKernel.h"
+#include "ModalBankKernel.h"
+#include "SynthStageCache.h"
+#include "SynthTaskPool.h"
 #include <cctype>
 #include <cmath>
 #include <cstring>
 #include <algorithm>
-#include <future>
 #include <atomic>
+#include <chrono>
 #include <mutex>
+#if ! defined(_WIN32)
+ #include <time.h>
+#endif
 #ifdef PING_POLYGON_DEBUG
  #include <cstdio>
 #endif
@@ -439,9 +447,10 @@ double IRSynthEngine::directivityCos (double az, double el,
 }
 
 // ── micG — per-octave-band polar pattern gain ─────────────────────────────
-// band ∈ [0, 7] indexing octave bands [125 Hz .. 16 kHz]. Called once per
-// (reflection, band) from calcRefs so each frequency band sees its own
-// off-axis rejection while on-axis (o + d = 1) remains frequency-flat.
+// band ∈ [0, 7] indexing octave bands [125 Hz .. 16 kHz]. Each frequency
+// band sees its own off-axis rejection while on-axis (o + d = 1) remains
+// frequency-flat. calcRefs evaluates all bands at once through micGains
+// below (same expression, pattern resolved once per call).
 //
 // cosTheta is precomputed by the caller via directivityCos, hoisted out of
 // the per-band loop so the spherical-law-of-cosines call (4 trig ops) runs
@@ -456,6 +465,22 @@ double IRSynthEngine::micG (int band, const std::string& pat, double cosTheta)
     return std::max(0.0, o + d * cosTheta);
 }
 
+const IRSynthEngine::MicPattern* IRSynthEngine::findMicPattern (const std::string& pat)
+{
+    const auto& mic = getMIC();
+    auto it = mic.find (pat);
+    return it == mic.end() ? nullptr : &it->second;
+}
+
+// Same expression as micG, band by band, so the gains are bit-identical.
+void IRSynthEngine::micGains (const MicPattern* pattern, double cosTheta, double* out) noexcept
+{
+    for (int b = 0; b < N_BANDS; ++b)
+        out[b] = pattern == nullptr ? 1.0
+                                    : std::max (0.0, (*pattern)[(size_t) b].first
+                                                     + (*pattern)[(size_t) b].second * cosTheta);
+}
+
 // ── spkG — verbatim from JS (pure cardioid) ────────────────────────────────
 double IRSynthEngine::spkG (double faceAngle, double azToReceiver)
 {
@@ -857,15 +882,27 @@ namespace
     }
 
     // Polygon image-source identity: combine the chain of wall identities
-    // (in reflection order) with the vertical lattice index nz.
-    inline uint64_t isIdentityPoly (const std::vector<uint64_t>& wallIds,
-                                    const std::vector<int>& wallPath,
-                                    int nz) noexcept
+    // (in reflection order) with the vertical lattice index nz. The chain
+    // part depends only on the 2D image, so calcRefsPolygon folds it once per
+    // image (pathIdentityPoly) and mixes in nz per vertical copy.
+    inline uint64_t pathIdentityPoly (const std::vector<uint64_t>& wallIds,
+                                      const std::vector<ImageSourceNode2D>& arena,
+                                      int index) noexcept
     {
+        int path[64];   // orderLimitForShape caps the order at 60
+        int n = 0;
+        for (int i = index; arena[(size_t) i].parent >= 0; i = arena[(size_t) i].parent)
+            path[n++] = arena[(size_t) i].wall;
+
         uint64_t h = 0xcbf29ce484222325ULL;
-        for (int wi : wallPath)
-            h = mix64 (h ^ wallIds[(size_t) wi]);
-        return mix64 (h ^ ((uint64_t) (uint32_t) nz << 32));
+        while (n > 0)                    // oldest wall first
+            h = mix64 (h ^ wallIds[(size_t) path[--n]]);
+        return h;
+    }
+
+    inline uint64_t isIdentityPoly (uint64_t pathIdentity, int nz) noexcept
+    {
+        return mix64 (pathIdentity ^ ((uint64_t) (uint32_t) nz << 32));
     }
 }
 
@@ -934,6 +971,159 @@ std::vector<double> IRSynthEngine::calcRT60 (const IRSynthParams& p)
     return rt60;
 }
 
+// Cancellation checkpoint shared by the stage functions (null = never).
+namespace
+{
+    inline bool isCancelled (IRSynthEngine::Cancel cancel) noexcept
+    {
+        return cancel != nullptr && cancel->isCancelled();
+    }
+
+    // Preview pass (IRSynthParams::preview): cap the image-source order and
+    // the IR length. Every image within the capped order is generated exactly
+    // as in the full pass (hash-keyed jitter), so the preview's early field
+    // matches the full IR; the FDN simply runs over the shorter buffer.
+    void applyPreviewCaps (int& mo, int& irLen, int sr)
+    {
+        mo    = std::min (mo, IRSynthEngine::kPreviewMaxOrder);
+        irLen = std::min (irLen, (int) std::floor (IRSynthEngine::kPreviewMaxSeconds * sr));
+    }
+
+    template <typename Sample>
+    IRSynthResultT<Sample> cancelledResult()
+    {
+        IRSynthResultT<Sample> res;
+        res.cancelled = true;
+        res.errorMessage = "Cancelled.";
+        return res;
+    }
+
+    // ── Stage profile (see SynthProfile.h) ──────────────────────────────────
+    // CPU time of the calling thread, in ms; 0 without a per-thread clock.
+    double threadCpuMs() noexcept
+    {
+       #if defined(_WIN32)
+        return 0.0;
+       #else
+        timespec t {};
+        clock_gettime (CLOCK_THREAD_CPUTIME_ID, &t);
+        return (double) t.tv_sec * 1.0e3 + (double) t.tv_nsec * 1.0e-6;
+       #endif
+    }
+
+    // Times one stage of one path from construction to finish(). Pool work
+    // runs through task() or measure(), which add their thread's CPU time;
+    // an onThisThread probe instead charges the constructing thread's CPU
+    // time up to finish() (stages that run inline on the path thread).
+    // Counts may be added from any task. A null profile makes finish() a
+    // no-op.
+    class StageProbe
+    {
+    public:
+        enum Mode { tasks, onThisThread };
+
+        StageProbe (SynthProfile* profileToFill, const char* pathName, const char* stageName,
+                    Mode mode = tasks)
+            : profile (profileToFill), path (pathName), stage (stageName),
+              start (std::chrono::steady_clock::now()),
+              inlineCpuStart (mode == onThisThread ? threadCpuMs() : -1.0) {}
+
+        template <typename Fn>
+        void measure (Fn&& fn)
+        {
+            const double c0 = threadCpuMs();
+            fn();
+            cpuUs.fetch_add ((long long) ((threadCpuMs() - c0) * 1.0e3), std::memory_order_relaxed);
+        }
+
+        template <typename Fn>
+        auto task (Fn fn)
+        {
+            return [this, fn] () mutable { measure (fn); };
+        }
+
+        void addItems (size_t n) noexcept  { items.fetch_add (n, std::memory_order_relaxed); }
+        void addCacheHit() noexcept        { cacheHits.fetch_add (1, std::memory_order_relaxed); }
+        void addNodes (size_t n) noexcept  { nodes.fetch_add (n, std::memory_order_relaxed); }
+        void setBytes (size_t n) noexcept  { peakBytes = std::max (peakBytes, n); }
+
+        void finish()
+        {
+            if (profile == nullptr)
+                return;
+            if (inlineCpuStart >= 0.0)
+                cpuUs.fetch_add ((long long) ((threadCpuMs() - inlineCpuStart) * 1.0e3), std::memory_order_relaxed);
+            SynthProfile::Stage s;
+            s.path      = path;
+            s.stage     = stage;
+            s.wallMs    = std::chrono::duration<double, std::milli> (std::chrono::steady_clock::now() - start).count();
+            s.cpuMs     = (double) cpuUs.load() * 1.0e-3;
+            s.peakBytes = peakBytes;
+            s.items     = items.load();
+            s.nodes     = nodes.load();
+            s.cacheHits = cacheHits.load();
+            profile->stages.push_back (std::move (s));
+        }
+
+    private:
+        SynthProfile* profile;
+        const char* path;
+        const char* stage;
+        std::chrono::steady_clock::time_point start;
+        double inlineCpuStart;
+        std::atomic<long long> cpuUs { 0 };
+        std::atomic<size_t> items { 0 }, nodes { 0 }, cacheHits { 0 };
+        size_t peakBytes = 0;
+    };
+
+    // ── Stage cache (see SynthStageCache.h) ──────────────────────────────────
+    using StageKey = SynthStageCache::KeyBuilder;
+
+    template <typename T>
+    size_t cacheBytes (const std::vector<T>& v) noexcept { return v.size() * sizeof (T); }
+
+    template <typename Sample>
+    size_t cacheBytes (const MicIRChannelsT<Sample>& m) noexcept
+    {
+        return cacheBytes (m.LL) + cacheBytes (m.RL) + cacheBytes (m.LR) + cacheBytes (m.RR);
+    }
+
+    // The result stored under key, or compute() — stored unless the synth was
+    // cancelled meanwhile, since a cancelled stage may return a partial result.
+    template <typename Fn>
+    auto cachedStage (SynthStageCache::Key key, IRSynthEngine::Cancel cancel, Fn&& compute)
+        -> std::shared_ptr<const decltype (compute())>
+    {
+        using T = decltype (compute());
+        auto& cache = SynthStageCache::shared();
+        if (auto hit = cache.find<T> (key))
+            return hit;
+        auto value = std::make_shared<const T> (compute());
+        if (! isCancelled (cancel))
+            cache.insert<T> (key, value, cacheBytes (*value));
+        return value;
+    }
+
+    // IRSynthParams fields makeWalls2D reads (the polygon outline).
+    void addShapeInputs (StageKey& k, const IRSynthParams& p)
+    {
+        k.add (p.shape).add (p.width).add (p.depth)
+         .add (p.shapeNavePct).add (p.shapeTrptPct).add (p.shapeTaper).add (p.shapeCornerCut);
+    }
+
+    // IRSynthParams fields calcRefs / calcRefsPolygon read besides their
+    // explicit arguments. Keep in step with those functions: a field missing
+    // here would let a stale image-source list survive an edit.
+    void addRefsInputs (StageKey& k, const IRSynthParams& p)
+    {
+        addShapeInputs (k, p);
+        k.add (p.wall_material).add (p.window_fraction)
+         .add (p.lambert_scatter_enabled).add (p.spk_directivity_full)
+         .add ((int) p.source_radiation.kind)
+         .add (p.source_radiation.bandExp).add (p.source_radiation.bandFloor);
+    }
+}
+
 // ── calcRefs — verbatim from JS image-source loop ───────────────────────────
 std::vector<IRSynthEngine::Ref> IRSynthEngine::calcRefs (
     double rx, double ry, double rz,
@@ -952,25 +1142,223 @@ std::vector<IRSynthEngine::Ref> IRSynthEngine::calcRefs (
     double minJitterMs,
     double highOrderJitterMs,
     double micFaceTilt,
-    double spkFaceTilt)
+    double spkFaceTilt,
+    Cancel cancel)
+{
+    const ImageLattice lattice = buildImageLattice (sx, sy, sz, p, He, mo, rF, rC, rW, oF, vHfA, ts, sr,
+                                                    seed, minJitterMs, highOrderJitterMs, cancel);
+    if (lattice.mo < 0)
+        return {};
+    return calcRefs (rx, ry, rz, lattice, p, eo, ec, sr, micPat, spkFaceAngle, micFaceAngle,
+                     maxRefDist, micFaceTilt, spkFaceTilt, cancel);
+}
+
+// ── Image lattice — calcRefs' receiver-independent half ────────────────────
+// Everything here depends only on the source, the room and the salt: the
+// image coordinates (each axis separately — ix depends on nx alone), the
+// hash-keyed ts / order jitter of every image, and the per-order absorption
+// tables. The values are the ones the image loop used to compute inline,
+// by the same expressions, so calcRefs stays bit-identical.
+IRSynthEngine::ImageLattice IRSynthEngine::buildImageLattice (
+    double sx, double sy, double sz,
+    const IRSynthParams& p,
+    double He, int mo,
+    const std::array<double,8>& rF,
+    const std::array<double,8>& rC,
+    const std::array<double,8>& rW,
+    double oF, double vHfA, double ts, int sr,
+    uint32_t seed,
+    double minJitterMs,
+    double highOrderJitterMs,
+    Cancel cancel)
 {
     double W = p.width, D = p.depth;
-    // `seed` is now the per-speaker SALT in the hash-keyed jitter scheme
-    // (see "Image-source-keyed deterministic jitter" comment block above).
-    // The per-image-source rolls (ts-jitter, close-source jitter, Lambert
-    // scatter) are deterministic functions of (image-source identity, salt,
-    // kind) — no sequential RNG state is consumed inside this loop.
-    const uint32_t saltSrc = seed;
+    ImageLattice L;
+    L.sx = sx; L.sy = sy; L.sz = sz;
+    L.ts = ts;
+    L.minJitterMs = minJitterMs;
+    L.highOrderJitterMs = highOrderJitterMs;
+    // `seed` is the per-speaker SALT in the hash-keyed jitter scheme (see
+    // "Image-source-keyed deterministic jitter" above). The per-image rolls
+    // are functions of (image-source identity, salt, kind) only.
+    L.salt = seed;
+
+    const int side = 2 * mo + 1;
+    L.ix.resize ((size_t) side);
+    L.iy.resize ((size_t) side);
+    L.iz.resize ((size_t) side);
+    for (int n = -mo; n <= mo; ++n)
+    {
+        L.ix[(size_t) (n + mo)] = n * W + (n % 2 ? W - sx : sx);
+        L.iy[(size_t) (n + mo)] = n * D + (n % 2 ? D - sy : sy);
+        L.iz[(size_t) (n + mo)] = n * He + (n % 2 ? He - sz : sz);
+    }
+
+    // Per-order power tables for the band kernel (BandAmpKernel.h). Row k
+    // of a table is base^k, the value the band loop used to compute with
+    // std::pow per reflection; row 0 = 1.0 stands in for the skipped organ
+    // / vault factor when |ny| or |nz| is 0.
+    {
+        BandAmpKernel::Bands oBase, vBase;
+        oBase.fill (oF);
+        for (int b = 0; b < N_BANDS; ++b)
+            vBase[(size_t) b] = 1.0 - vHfA * std::min (b / 3.0, 1.0);
+        L.powF.build (rF, (mo + 1) / 2);
+        L.powC.build (rC, mo / 2);
+        L.powW.build (rW, 2 * mo);
+        L.powO.build (oBase, mo);
+        L.powV.build (vBase, mo);
+    }
+
+    const bool tsOn     = ts > 0.05;
+    const bool jitterOn = minJitterMs > 0.0 || highOrderJitterMs > 0.0;
+    if (tsOn || jitterOn)
+    {
+        const size_t count = (size_t) side * (size_t) side * (size_t) side;
+        if (tsOn)     L.tsShift.resize (count);
+        if (jitterOn) L.jitterShift.resize (count);
+        int minTs = 0, minJitter = 0;
+        size_t i = 0;
+        for (int nx = -mo; nx <= mo; ++nx)
+        {
+            if (isCancelled (cancel))
+                return {};
+            for (int ny = -mo; ny <= mo; ++ny)
+                for (int nz = -mo; nz <= mo; ++nz, ++i)
+                {
+                    const uint64_t isHash = isIdentityRect (nx, ny, nz);
+                    if (tsOn)
+                    {
+                        const int shift = (int)std::floor(hashRange(isHash, L.salt, 0, -ts * 4.0, ts * 4.0) * sr / 1000.0);
+                        L.tsShift[i] = shift;
+                        minTs = std::min (minTs, shift);
+                    }
+                    if (jitterOn)
+                    {
+                        const int totalBounces = std::abs(nx) + std::abs(ny) + std::abs(nz);
+                        const double jitterMs = (totalBounces >= 2) ? highOrderJitterMs : minJitterMs;
+                        const int shift = jitterMs > 0.0
+                            ? (int)std::floor(hashRange(isHash, L.salt, 1, -jitterMs, jitterMs) * sr / 1000.0)
+                            : 0;
+                        L.jitterShift[i] = shift;
+                        minJitter = std::min (minJitter, shift);
+                    }
+                }
+        }
+        L.minShift = minTs + minJitter;
+    }
+    L.mo = mo;
+    return L;
+}
+
+std::vector<IRSynthEngine::Ref> IRSynthEngine::calcRefs (
+    double rx, double ry, double rz,
+    const ImageLattice& L,
+    const IRSynthParams& p,
+    bool eo, int ec, int sr,
+    const std::string& micPat,
+    double spkFaceAngle, double micFaceAngle,
+    double maxRefDist,
+    double micFaceTilt,
+    double spkFaceTilt,
+    Cancel cancel)
+{
+    const int mo = L.mo;
+    const double sx = L.sx, sy = L.sy, sz = L.sz, ts = L.ts;
+    const uint32_t saltSrc = L.salt;
+    const int side = 2 * mo + 1;
     std::vector<Ref> refs;
+    if (mo < 0)
+        return refs;
+    // Full mode keeps nearly every image: reserve for all of them (plus the
+    // order 1–3 scatter refs) instead of growing through ~20 reallocations.
+    if (! eo)
+        refs.reserve ((size_t) side * (size_t) side * (size_t) side + 256);
+
+    const MicPattern* micPattern = findMicPattern (micPat);
+
+    // Source directivity: by default, direct (0) and first-order (1) use the
+    // full speaker pattern; order 2 is a 50/50 blend with omni; order 3+ is
+    // fully omnidirectional. This fade avoids over-attenuating late
+    // reflections that in reality arrive from all directions.
+    //
+    // When IRSynthParams::spk_directivity_full is true, the fade is disabled
+    // and every reflection order keeps the full cardioid — an A/B knob for
+    // testing whether early-reflection directional cues are being lost to
+    // the fade.
+    //
+    // The speaker angle is taken source → real receiver, so the gains depend
+    // on the bounce count only through the fade: sgByOrder[0] is orders 0–1,
+    // [1] order 2, [2] order 3+.
+    const double spkAz = std::atan2(ry - sy, rx - sx);
+    std::array<double, 8> sgByOrder[3];
+    for (int k = 0; k < 3; ++k)
+    {
+        const int totalBounces = k + 1;
+        std::array<double, 8>& sgBand = sgByOrder[k];
+        if (p.source_radiation.kind == SourceRadiation::Kind::LegacyCardioid)
+        {
+            // Legacy path — preserve bit-identical output to the pre-v2.11
+            // engine. Same scalar `sg` is broadcast to every band; per-band
+            // multiplication below is numerically identical to the original
+            // `* sg *`. NB: spkFaceTilt is intentionally NOT consumed here —
+            // see the v2.12 promise that LegacyCardioid stays bit-identical
+            // (UI greys out the tilt slider).
+            double sgDir = spkG(spkFaceAngle, spkAz);
+            double sg;
+            if (p.spk_directivity_full)
+                sg = sgDir;
+            else if (totalBounces <= 1)
+                sg = sgDir;
+            else if (totalBounces == 2)
+                sg = 0.5 * sgDir + 0.5;
+            else
+                sg = 1.0;
+            sgBand.fill(sg);
+        }
+        else
+        {
+            // Non-Legacy: full 3D directivity cone. Elevation is computed
+            // source→receiver (NOT source→image-source) to match the
+            // convention spkAz uses, so it represents the angle the wave
+            // leaves the source's frame.
+            const double hDistSrcReal = std::sqrt((rx - sx) * (rx - sx) + (ry - sy) * (ry - sy));
+            const double elSrc        = std::atan2(rz - sz, std::max(hDistSrcReal, 1e-9));
+            const double cosThSpk     = directivityCos(spkAz, elSrc, spkFaceAngle, spkFaceTilt);
+            fillSpkBandGainsParametric(p.source_radiation, cosThSpk,
+                                       totalBounces, p.spk_directivity_full,
+                                       sgBand);
+        }
+    }
 
+    // Distance beyond which no image can be kept: maxRefDist, and in ER-only
+    // mode the distance whose arrival stays at or past ec even after the
+    // largest negative jitter. Both carry a margin for rounding (a relative
+    // 1e-9, one sample). Whole x slabs and (x, y) columns past it are
+    // skipped; the per-image tests below still decide every visited image.
+    double cullDist = maxRefDist * (1.0 + 1e-9);
+    if (eo)
+        cullDist = std::min (cullDist, (ec - L.minShift + 1) * SPEED / sr);
+
+    const bool tsOn = ! L.tsShift.empty();
+    const bool jitterOn = ! L.jitterShift.empty();
     for (int nx = -mo; nx <= mo; ++nx)
+    {
+        const double ix = L.ix[(size_t) (nx + mo)];
+        if (std::abs (ix - rx) > cullDist)
+            continue;
         for (int ny = -mo; ny <= mo; ++ny)
+        {
+            const double iy = L.iy[(size_t) (ny + mo)];
+            if (std::sqrt((ix - rx) * (ix - rx) + (iy - ry) * (iy - ry)) > cullDist)
+                continue;
+            if (isCancelled (cancel))
+                return {};
+            const size_t column = ((size_t) (nx + mo) * (size_t) side + (size_t) (ny + mo)) * (size_t) side;
             for (int nz = -mo; nz <= mo; ++nz)
             {
+                const double iz = L.iz[(size_t) (nz + mo)];
                 int totalBounces = std::abs(nx) + std::abs(ny) + std::abs(nz);
-                double ix = nx * W + (nx % 2 ? W - sx : sx);
-                double iy = ny * D + (ny % 2 ? D - sy : sy);
-                double iz = nz * He + (nz % 2 ? He - sz : sz);
                 double dist = std::sqrt((ix - rx) * (ix - rx) + (iy - ry) * (iy - ry) + (iz - rz) * (iz - rz));
                 if (dist < 1e-6) continue;
                 // Skip image sources beyond the target window — the FDN tail covers
@@ -978,15 +1366,14 @@ std::vector<IRSynthEngine::Ref> IRSynthEngine::calcRefs (
                 // sources that are actually distinct from diffuse reverberation.
                 if (dist > maxRefDist) continue;
 
-                const uint64_t isHash = isIdentityRect (nx, ny, nz);
-
+                const size_t image = column + (size_t) (nz + mo);
                 int t = (int)std::floor(dist / SPEED * sr);
-                if (ts > 0.05) t = std::max(1, t + (int)std::floor(hashRange(isHash, saltSrc, 0, -ts * 4.0, ts * 4.0) * sr / 1000.0));
+                if (tsOn) t = std::max(1, t + L.tsShift[image]);
                 // Order-dependent jitter when sources are close: keep direct and first-order
                 // tight (small jitter); scramble order 2+ to break the periodic decaying echo
                 // that comes from repeated bounces (e.g. floor-ceiling at 2*H/c).
-                double jitterMs = (totalBounces >= 2) ? highOrderJitterMs : minJitterMs;
-                if (jitterMs > 0.0) t = std::max(1, t + (int)std::floor(hashRange(isHash, saltSrc, 1, -jitterMs, jitterMs) * sr / 1000.0));
+                double jitterMs = (totalBounces >= 2) ? L.highOrderJitterMs : L.minJitterMs;
+                if (jitterOn && jitterMs > 0.0) t = std::max(1, t + L.jitterShift[image]);
                 // In ER-only mode, skip image sources that arrive at or beyond the ER
                 // window boundary.  In full-reverb mode keep all sources — late ones seed
                 // the FDN (ef=0 after ecFdn prevents them appearing in the ER output).
@@ -1002,67 +1389,26 @@ std::vector<IRSynthEngine::Ref> IRSynthEngine::calcRefs (
                 const double hDist   = std::sqrt((ix - rx) * (ix - rx) + (iy - ry) * (iy - ry));
                 const double el      = std::atan2(iz - rz, std::max(hDist, 1e-9));
                 const double cosTh3D = directivityCos(az, el, micFaceAngle, micFaceTilt);
-                // micG is now called per-band inside the loop below so each octave
-                // band sees its own off-axis rejection (frequency-dependent polar pattern).
-                // Source directivity: by default, direct (0) and first-order (1)
-                // use the full speaker pattern; order 2 is a 50/50 blend with
-                // omni; order 3+ is fully omnidirectional. This fade avoids
-                // over-attenuating late reflections that in reality arrive from
-                // all directions.
-                //
-                // When IRSynthParams::spk_directivity_full is true, the fade is
-                // disabled and every reflection order keeps the full cardioid —
-                // an A/B knob for testing whether early-reflection directional
-                // cues are being lost to the fade.
-                double spkAz = std::atan2(ry - sy, rx - sx);
-                std::array<double, 8> sgBand;
-                if (p.source_radiation.kind == SourceRadiation::Kind::LegacyCardioid)
-                {
-                    // Legacy path — preserve bit-identical output to the
-                    // pre-v2.11 engine. Same scalar `sg` is broadcast to
-                    // every band; per-band multiplication below is
-                    // numerically identical to the original `* sg *`.
-                    // NB: spkFaceTilt is intentionally NOT consumed here —
-                    // see the v2.12 promise that LegacyCardioid stays
-                    // bit-identical (UI greys out the tilt slider).
-                    double sgDir = spkG(spkFaceAngle, spkAz);
-                    double sg;
-                    if (p.spk_directivity_full)
-                        sg = sgDir;
-                    else if (totalBounces <= 1)
-                        sg = sgDir;
-                    else if (totalBounces == 2)
-                        sg = 0.5 * sgDir + 0.5;
-                    else
-                        sg = 1.0;
-                    sgBand.fill(sg);
-                }
-                else
-                {
-                    // Non-Legacy: full 3D directivity cone. Elevation is
-                    // computed source→receiver (NOT source→image-source)
-                    // to match the convention spkAz uses, so it represents
-                    // the angle the wave leaves the source's frame.
-                    const double hDistSrcReal = std::sqrt((rx - sx) * (rx - sx) + (ry - sy) * (ry - sy));
-                    const double elSrc        = std::atan2(rz - sz, std::max(hDistSrcReal, 1e-9));
-                    const double cosThSpk     = directivityCos(spkAz, elSrc, spkFaceAngle, spkFaceTilt);
-                    fillSpkBandGainsParametric(p.source_radiation, cosThSpk,
-                                               totalBounces, p.spk_directivity_full,
-                                               sgBand);
-                }
+                const std::array<double, 8>& sgBand = sgByOrder[std::min(std::max(totalBounces, 1), 3) - 1];
                 double polarity = (totalBounces % 2 == 0) ? 1.0 : -1.0;
 
-                std::array<double,8> amps;
+                // a = 1/r · F^⌈|nz|/2⌉ · C^⌊|nz|/2⌋ · W^(|nx|+|ny|) · O^|ny|
+                //     · V^|nz| · air · mic · sg · polarity, per band.
+                // Air absorption depends on the continuous distance, so it
+                // stays a per-reflection pow.
+                const int anz = std::abs(nz);
+                const double* factors[BandAmpKernel::kNumFactors] = {
+                    L.powF.row((anz + 1) / 2), L.powC.row(anz / 2),
+                    L.powW.row(std::abs(nx) + std::abs(ny)),
+                    L.powO.row(std::abs(ny)), L.powV.row(anz) };
+                double air[8], mic[8];
                 for (int b = 0; b < N_BANDS; ++b)
-                {
-                    double a = 1.0 / std::max(dist, 0.5);
-                    a *= std::pow(rF[b], std::ceil(std::abs(nz) / 2.0));
-                    a *= std::pow(rC[b], std::floor(std::abs(nz) / 2.0));
-                    a *= std::pow(rW[b], std::abs(nx) + std::abs(ny));
-                    if (std::abs(ny) > 0) a *= std::pow(oF, std::abs(ny));
-                    if (std::abs(nz) > 0) a *= std::pow(1.0 - vHfA * std::min(b / 3.0, 1.0), std::abs(nz));
-                    amps[b] = a * std::pow(10.0, -AIR[b] * dist / 20.0) * micG(b, micPat, cosTh3D) * sgBand[b] * polarity;
-                }
+                    air[b] = std::pow(10.0, -AIR[b] * dist / 20.0);
+                micGains(micPattern, cosTh3D, mic);
+
+                std::array<double,8> amps;
+                BandAmpKernel::amplitudes(1.0 / std::max(dist, 0.5), factors, air, mic,
+                                          sgBand.data(), polarity, amps.data());
                 refs.push_back({ t, amps, az });
 
                 // Feature A — Lambert diffuse scattering: add N_SCATTER secondary refs per
@@ -1074,6 +1420,7 @@ std::vector<IRSynthEngine::Ref> IRSynthEngine::calcRefs (
                 const int N_SCATTER = 2;
                 if (p.lambert_scatter_enabled && ts > 0.05 && totalBounces >= 1 && totalBounces <= 3)
                 {
+                    const uint64_t isHash = isIdentityRect (nx, ny, nz);
                     double scatterWeight = (ts * 0.08) / (double)N_SCATTER * std::pow(0.6, totalBounces - 1);
                     for (int s = 0; s < N_SCATTER; ++s)
                     {
@@ -1090,6 +1437,8 @@ std::vector<IRSynthEngine::Ref> IRSynthEngine::calcRefs (
                     }
                 }
             }
+        }
+    }
     return refs;
 }
 
@@ -1106,13 +1455,23 @@ std::vector<IRSynthEngine::Ref> IRSynthEngine::calcRefs (
 //
 // Full chain validation:
 //   For every accepted 2D image source we verify the full reflection path back
-//   from the receiver hits each wall in wallPath within its finite segment.
+//   from the receiver hits each wall of its chain within its finite segment.
 //   This is essential for the Cathedral cruciform whose concavity allows
 //   near-corner image sources that fail the per-step dot test but still try to
 //   "cut the corner" through a non-existent wall section. Pruning during
 //   recursion would also work but at modest extra complexity for marginal
 //   speed gain — we validate on the leaf accept and on each internal node.
 //
+// Beam pruning:
+//   Most candidates fail validation, and a failure can take a walk down the
+//   whole chain. Each accepted node therefore carries its beam — the interval
+//   of its wall through which any point that validates the node must see the
+//   image — and a child is only built when the candidate wall intersects that
+//   beam (plus a per-call table of which walls face each other). The test is
+//   a necessary condition, padded beyond rayIntersectsSegment's tolerances,
+//   so it only removes candidates validation would reject: the image-source
+//   set is unchanged (IR_49, IR_56) and validation still decides acceptance.
+//
 // Order cap:
 //   Polygon ISM cost grows ~ O(W^N) where W = wall count, N = order. Each
 //   shape gets a hand-tuned hard cap (orderLimitForShape) on top of the
@@ -1121,41 +1480,161 @@ std::vector<IRSynthEngine::Ref> IRSynthEngine::calcRefs (
 
 namespace
 {
-    // ── Internal image-source representation (file-static) ────────────────────
-    struct ImageSource2D
-    {
-        double                  x = 0.0, y = 0.0;   // image position (metres)
-        std::vector<int>        wallPath;           // wall indices, oldest first
-        std::array<double, 8>   cumAbs{};           // accumulated reflection coeffs
-        int                     order = 0;          // = wallPath.size()
-        // imgPositions[k] = image source after reflecting through wallPath[0..k-1].
-        // Stored so leaf-level chain validation can walk the receiver-to-source
-        // ray sequence without recomputing each parent's image position.
-        // Size = order + 1 (entry 0 is the original source position).
-        std::vector<std::pair<double, double>> imgPositions;
-    };
+    // ── Image-source tree (flat arena) ────────────────────────────────────────
+    // Nodes are ImageSourceNode2D (IRSynthEngine.h), appended in depth-first
+    // order. A node stores only its parent index and wall; the wall path and
+    // the intermediate image positions are read back through parent links, so
+    // a node costs one arena slot and no heap allocation of its own.
 
     // Walk the reflection path from receiver back to source, verifying that at
     // every step the line from the current point to the next-earlier image
     // source crosses the corresponding wall WITHIN its finite segment. Returns
-    // false (= invalid image source) on the first miss. order==0 sources are
-    // trivially valid (no walls to traverse).
+    // false (= invalid image source) on the first miss. The candidate at
+    // (imgX, imgY) reached through `wall` is not in the arena yet; `parent`
+    // is its predecessor (order ≥ 1, so parent is never -1).
     bool validateChain2D (const std::vector<Wall2D>& walls,
-                          const ImageSource2D& is,
+                          const std::vector<ImageSourceNode2D>& arena,
+                          double imgX, double imgY, int wall, int parent,
                           double rcvX, double rcvY) noexcept
     {
         double curX = rcvX, curY = rcvY;
-        for (int k = (int) is.wallPath.size() - 1; k >= 0; --k)
+        for (;;)
         {
-            const Wall2D& w = walls[(size_t) is.wallPath[k]];
-            const auto& tgt = is.imgPositions[(size_t) (k + 1)];
+            const Wall2D& w = walls[(size_t) wall];
             double t = 0.0, s = 0.0;
-            if (! IRSynthEngine::rayIntersectsSegment (curX, curY, tgt.first, tgt.second, w, t, s))
+            if (! IRSynthEngine::rayIntersectsSegment (curX, curY, imgX, imgY, w, t, s))
                 return false;
-            curX = curX + t * (tgt.first  - curX);
-            curY = curY + t * (tgt.second - curY);
+            curX = curX + t * (imgX - curX);
+            curY = curY + t * (imgY - curY);
+
+            const auto& prev = arena[(size_t) parent];
+            if (prev.parent < 0)
+                return true;               // reached the real source
+            imgX = prev.x;
+            imgY = prev.y;
+            wall = prev.wall;
+            parent = prev.parent;
         }
-        return true;
+    }
+
+    // ── Beam pruning ────────────────────────────────────────────────────────
+    // A node's aperture is an interval of its wall's s parameter (0 … 1 along
+    // the segment, as rayIntersectsSegment reports it). Any point from which
+    // the node's chain validates sees the image through that interval. An
+    // order-1 node's aperture is its whole wall; a child's is the part of its
+    // wall inside the cone from the parent image through the parent's
+    // aperture, on the room side of the parent's wall.
+    constexpr double kApertureSlack = 2.0e-6;   // rayIntersectsSegment's s tolerance (1e-6) + rounding
+    constexpr double kFacingTol     = 1.0e-3;   // metres
+
+    struct Aperture2D
+    {
+        double lo = -kApertureSlack, hi = 1.0 + kApertureSlack;   // lo > hi: empty
+    };
+
+    // facing[a * n + b]: some point of wall a lies on the room side of wall
+    // b's line. A path that reflects off a and next off b reaches b from its
+    // room side, so a child through b of a node on a needs facing[a][b].
+    // Built once per tree; the per-node beam test refines it.
+    std::vector<uint8_t> buildWallFacing2D (const std::vector<Wall2D>& walls)
+    {
+        const size_t n = walls.size();
+        std::vector<uint8_t> facing (n * n, 0);
+        for (size_t a = 0; a < n; ++a)
+            for (size_t b = 0; b < n; ++b)
+            {
+                const Wall2D& wa = walls[a];
+                const Wall2D& wb = walls[b];
+                const double d1 = (wa.x1 - wb.x1) * wb.nx + (wa.y1 - wb.y1) * wb.ny;
+                const double d2 = (wa.x2 - wb.x1) * wb.nx + (wa.y2 - wb.y1) * wb.ny;
+                facing[a * n + b] = (a != b && std::max (d1, d2) > -kFacingTol) ? 1 : 0;
+            }
+        return facing;
+    }
+
+    // The cone a node's children are clipped against: apex at the node's
+    // image, edges through the ends of its aperture, truncated by its wall.
+    struct Beam2D
+    {
+        bool   fromSource = true;          // root: children get their whole wall
+        double ix = 0.0, iy = 0.0;         // image (apex)
+        const Wall2D* wall = nullptr;
+        double outDist = 0.0;              // image's distance outside the wall's line
+        bool   hasCone = false;
+        double n0x = 0.0, n0y = 0.0;       // unit normals of the two cone edges,
+        double n1x = 0.0, n1y = 0.0;       // pointing into the cone
+    };
+
+    Beam2D makeBeam2D (double ix, double iy, const Wall2D& w, const Aperture2D& ap) noexcept
+    {
+        Beam2D b;
+        b.fromSource = false;
+        b.ix = ix;
+        b.iy = iy;
+        b.wall = &w;
+        b.outDist = -((ix - w.x1) * w.nx + (iy - w.y1) * w.ny);
+
+        const double wx = w.x2 - w.x1, wy = w.y2 - w.y1;
+        const double e0x = w.x1 + ap.lo * wx - ix, e0y = w.y1 + ap.lo * wy - iy;
+        const double e1x = w.x1 + ap.hi * wx - ix, e1y = w.y1 + ap.hi * wy - iy;
+        const double l0 = std::sqrt (e0x * e0x + e0y * e0y);
+        const double l1 = std::sqrt (e1x * e1x + e1y * e1y);
+        const double c  = e0x * e1y - e0y * e1x;
+        // A wall seen edge-on (or an image on its line) leaves the cone's
+        // orientation to rounding — skip the cone, keep the truncation.
+        if (l0 > 0.0 && l1 > 0.0 && std::abs (c) > 1e-9 * l0 * l1)
+        {
+            const double sg = c > 0.0 ? 1.0 : -1.0;
+            b.hasCone = true;
+            b.n0x = -sg * e0y / l0;  b.n0y =  sg * e0x / l0;
+            b.n1x =  sg * e1y / l1;  b.n1y = -sg * e1x / l1;
+        }
+        return b;
+    }
+
+    // Narrows [ap.lo, ap.hi] of the segment A + u·(B − A) to where the linear
+    // function g (g(A) = gA, g(B) = gB) is at least −tol.
+    inline void clipAperture (Aperture2D& ap, double gA, double gB, double tol) noexcept
+    {
+        const double d = gB - gA;
+        if (d == 0.0)
+        {
+            if (gA < -tol)
+                ap.hi = ap.lo - 1.0;
+            return;
+        }
+        const double u = (-tol - gA) / d;
+        if (d > 0.0) ap.lo = std::max (ap.lo, u);
+        else         ap.hi = std::min (ap.hi, u);
+    }
+
+    // Aperture of a child reflected through wall wj, or an empty one when no
+    // point of wj can see the parent image through the parent's beam.
+    Aperture2D childAperture2D (const Beam2D& beam, const Wall2D& wj) noexcept
+    {
+        Aperture2D ap;
+        if (beam.fromSource)
+            return ap;
+
+        const double ax = wj.x1 - beam.ix, ay = wj.y1 - beam.iy;
+        const double bx = wj.x2 - beam.ix, by = wj.y2 - beam.iy;
+        const double r = std::sqrt (std::max (ax * ax + ay * ay, bx * bx + by * by));
+
+        // Validation accepts a crossing up to 1e-6 of the ray length past the
+        // image, so an image that close to its wall's line constrains nothing.
+        if (beam.outDist <= 2.0e-6 * r + 1.0e-6)
+            return ap;
+
+        const double tol = 1.0e-6 + 1.0e-9 * r;
+        const Wall2D& w = *beam.wall;
+        clipAperture (ap, (wj.x1 - w.x1) * w.nx + (wj.y1 - w.y1) * w.ny,
+                          (wj.x2 - w.x1) * w.nx + (wj.y2 - w.y1) * w.ny, tol);
+        if (beam.hasCone)
+        {
+            clipAperture (ap, ax * beam.n0x + ay * beam.n0y, bx * beam.n0x + by * beam.n0y, tol);
+            clipAperture (ap, ax * beam.n1x + ay * beam.n1y, bx * beam.n1x + by * beam.n1y, tol);
+        }
+        return ap;
     }
 
     // Recursive Borish 2D image-source tree generator. At each level we:
@@ -1166,23 +1645,28 @@ namespace
     //      back-reflection), pruning by a dot-product test that requires the
     //      current image source to lie on the OUTSIDE of the candidate wall
     //      (otherwise the reflection produces a copy on the room side, which
-    //      would never be visible to the receiver).
+    //      would never be visible to the receiver), then by the facing table
+    //      and this node's beam (see "Beam pruning" above).
+    // Only accepted images enter the arena, so arena.size() is the accepted
+    // count the budget is measured against. `aperture` is this node's, from
+    // its parent's beam; chainChecks counts validateChain2D calls.
     void generateIS2D (const std::vector<Wall2D>& walls,
+                       const std::vector<uint8_t>& facing,
                        double imgX, double imgY,
-                       const std::vector<int>& wallPath,
-                       const std::vector<std::pair<double, double>>& imgPositions,
+                       int parent, int wall, const Aperture2D& aperture,
                        const std::array<double, 8>& cumAbs,
                        double rcvX, double rcvY,
                        double maxDist2D, int maxOrder,
                        size_t acceptedBudget,
-                       std::vector<ImageSource2D>& out)
+                       std::vector<ImageSourceNode2D>& arena,
+                       size_t& chainChecks)
     {
         // Image-count budget early-out (WI-1). Once we've accepted
         // `acceptedBudget` image sources the tree stops descending entirely.
         // The budget is a soft total cap that complements the per-shape order
         // ceiling: convex shapes (Fan, Octagonal) naturally produce deeper
         // trees than concave ones (Cathedral) without per-shape hand tuning.
-        if (out.size() >= acceptedBudget)
+        if (arena.size() >= acceptedBudget)
             return;
 
         // Path-length early termination.
@@ -1190,31 +1674,39 @@ namespace
         if (std::sqrt (dx * dx + dy * dy) > maxDist2D)
             return;
 
-        // Build the image source candidate up front so validateChain2D can run.
-        ImageSource2D is;
-        is.x = imgX;
-        is.y = imgY;
-        is.wallPath = wallPath;
-        is.imgPositions = imgPositions;
-        is.cumAbs = cumAbs;
-        is.order = (int) wallPath.size();
+        const int order = parent < 0 ? 0 : arena[(size_t) parent].order + 1;
 
         // Order 0 (direct path) is always valid — no walls to validate.
         // Higher orders need the full chain check; if it fails we PRUNE the
-        // whole branch since deeper descendants share the same wallPath[0..k-1]
+        // whole branch since deeper descendants share the same chain prefix
         // and would all fail at the same earlier step.
-        if (is.order > 0 && ! validateChain2D (walls, is, rcvX, rcvY))
-            return;
-
-        out.push_back (std::move (is));
+        if (order > 0)
+        {
+            ++chainChecks;
+            if (! validateChain2D (walls, arena, imgX, imgY, wall, parent, rcvX, rcvY))
+                return;
+        }
 
-        if ((int) wallPath.size() >= maxOrder)
+        const int self = (int) arena.size();
+        ImageSourceNode2D node;
+        node.x = imgX;
+        node.y = imgY;
+        node.cumAbs = cumAbs;
+        node.parent = parent;
+        node.wall = wall;
+        node.order = order;
+        arena.push_back (node);
+
+        if (order >= maxOrder)
             return;
 
-        for (int wi = 0; wi < (int) walls.size(); ++wi)
+        const Beam2D beam = order > 0 ? makeBeam2D (imgX, imgY, walls[(size_t) wall], aperture) : Beam2D {};
+        const size_t numWalls = walls.size();
+
+        for (int wi = 0; wi < (int) numWalls; ++wi)
         {
             // Don't immediately re-reflect off the most recent wall.
-            if (! wallPath.empty() && wallPath.back() == wi)
+            if (wall == wi)
                 continue;
 
             const Wall2D& w = walls[(size_t) wi];
@@ -1247,20 +1739,27 @@ namespace
             if (dot < -1e-6)
                 continue;
 
-            const auto refl = IRSynthEngine::reflect2D (imgX, imgY, w);
+            if (wall >= 0 && ! facing[(size_t) wall * numWalls + (size_t) wi])
+                continue;
 
-            std::vector<int> newPath = wallPath;
-            newPath.push_back (wi);
-            std::vector<std::pair<double, double>> newPositions = imgPositions;
-            newPositions.emplace_back (refl.first, refl.second);
+            // The receiver must see the new image through w (validation's
+            // first step, same call and inputs) and within the part of w the
+            // beam reaches; only then can the rest of the chain validate.
+            const auto refl = IRSynthEngine::reflect2D (imgX, imgY, w);
+            double t = 0.0, sHit = 0.0;
+            if (! IRSynthEngine::rayIntersectsSegment (rcvX, rcvY, refl.first, refl.second, w, t, sHit))
+                continue;
+            const Aperture2D childAp = childAperture2D (beam, w);
+            if (sHit < childAp.lo - 1.0e-9 || sHit > childAp.hi + 1.0e-9)
+                continue;
 
             std::array<double, 8> newAbs;
             for (int b = 0; b < 8; ++b)
                 newAbs[(size_t) b] = cumAbs[(size_t) b] * w.rAbs[(size_t) b];
 
-            generateIS2D (walls, refl.first, refl.second, newPath, newPositions,
+            generateIS2D (walls, facing, refl.first, refl.second, self, wi, childAp,
                           newAbs, rcvX, rcvY, maxDist2D, maxOrder,
-                          acceptedBudget, out);
+                          acceptedBudget, arena, chainChecks);
         }
     }
 
@@ -1298,6 +1797,26 @@ namespace
     constexpr size_t kPolygonAcceptedBudget = 20000;
 }
 
+// ── buildImageSources2D — arena root for generateIS2D ──────────────────────
+std::vector<ImageSourceNode2D> IRSynthEngine::buildImageSources2D (
+    const std::vector<Wall2D>& walls,
+    double sx, double sy, double rx, double ry,
+    double maxDist2D, int maxOrder, size_t acceptedBudget,
+    size_t* chainChecks)
+{
+    std::vector<ImageSourceNode2D> arena;
+    arena.reserve (std::min<size_t> (acceptedBudget, 4096));
+    std::array<double, 8> initAbs;
+    initAbs.fill (1.0);
+    const auto facing = buildWallFacing2D (walls);
+    size_t checks = 0;
+    generateIS2D (walls, facing, sx, sy, -1, -1, Aperture2D {}, initAbs, rx, ry,
+                  maxDist2D, maxOrder, acceptedBudget, arena, checks);
+    if (chainChecks != nullptr)
+        *chainChecks = checks;
+    return arena;
+}
+
 // ── calcRefsPolygon ─────────────────────────────────────────────────────────
 // Polygon-aware ER calculator. Mirrors calcRefs parameter-for-parameter.
 // Horizontal (xy-plane) reflections come from the 2D image-source tree;
@@ -1321,7 +1840,9 @@ std::vector<IRSynthEngine::Ref> IRSynthEngine::calcRefsPolygon (
     double minJitterMs,
     double highOrderJitterMs,
     double micFaceTilt,
-    double spkFaceTilt)
+    double spkFaceTilt,
+    Cancel cancel,
+    size_t* acceptedImages)
 {
     // `seed` is now the per-speaker SALT in the hash-keyed jitter scheme
     // (see "Image-source-keyed deterministic jitter" comment block above
@@ -1381,21 +1902,13 @@ std::vector<IRSynthEngine::Ref> IRSynthEngine::calcRefsPolygon (
     // shape hard cap to keep worst-case cost bounded.
     const int moHoriz = orderLimitForShape (p.shape, mo);
 
-    // 2D image-source tree generation.
-    std::array<double, 8> initAbs;
-    initAbs.fill (1.0);
-    std::vector<ImageSource2D> images;
-    images.reserve (256);
-    {
-        std::vector<int> emptyPath;
-        std::vector<std::pair<double, double>> startPositions { { sx, sy } };
-        // Use maxRefDist directly as the 2D distance gate. For a typical
-        // mo-bounded full-reverb pass this is 1e9 (no gate), so the pruning
-        // happens via maxOrder alone.
-        generateIS2D (walls, sx, sy, emptyPath, startPositions, initAbs,
-                      rx, ry, maxRefDist, moHoriz,
-                      kPolygonAcceptedBudget, images);
-    }
+    // 2D image-source tree generation. Use maxRefDist directly as the 2D
+    // distance gate. For a typical mo-bounded full-reverb pass this is 1e9
+    // (no gate), so the pruning happens via maxOrder alone.
+    const auto images = buildImageSources2D (walls, sx, sy, rx, ry, maxRefDist, moHoriz,
+                                             kPolygonAcceptedBudget);
+    if (acceptedImages != nullptr)
+        *acceptedImages = images.size();
 
 #ifdef PING_POLYGON_DEBUG
     // Calibration log (WI-1). Off in normal builds; enable by defining
@@ -1419,8 +1932,34 @@ std::vector<IRSynthEngine::Ref> IRSynthEngine::calcRefsPolygon (
     // Combine 2D and 1D vertical reflections. For each (image, nz) pair we
     // build a single Ref with combined absorption and arrival time, mirroring
     // calcRefs' per-bounce gain stack.
-    for (const auto& is : images)
+    // Band-kernel tables, as in calcRefs. Horizontal wall absorption comes
+    // from each image's cumAbs chain; the organ factor is raised to the 2D
+    // order instead of |ny|.
+    using BandAmpKernel::PowerTable;
+    PowerTable powF, powC, powO, powV;
+    {
+        int maxOrder = 0;
+        for (const auto& is : images)
+            maxOrder = std::max (maxOrder, is.order);
+        BandAmpKernel::Bands oBase, vBase;
+        oBase.fill (oF);
+        for (int b = 0; b < N_BANDS; ++b)
+            vBase[(size_t) b] = 1.0 - vHfA * std::min (b / 3.0, 1.0);
+        powF.build (rF, (moVert + 1) / 2);
+        powC.build (rC, moVert / 2);
+        powO.build (oBase, maxOrder);
+        powV.build (vBase, moVert);
+    }
+    const MicPattern* micPattern = findMicPattern (micPat);
+
+    for (int ii = 0; ii < (int) images.size(); ++ii)
     {
+        if (isCancelled (cancel))
+            return {};
+
+        const auto& is = images[(size_t) ii];
+        const uint64_t pathHash = pathIdentityPoly (wallIds, images, ii);
+
         for (int nz = -moVert; nz <= moVert; ++nz)
         {
             // 3D image source position (z derived from rectangular nz mirror)
@@ -1435,7 +1974,7 @@ std::vector<IRSynthEngine::Ref> IRSynthEngine::calcRefsPolygon (
             // Total reflection count = horizontal hops + vertical hops.
             const int totalBounces = is.order + std::abs (nz);
 
-            const uint64_t isHash = isIdentityPoly (wallIds, is.wallPath, nz);
+            const uint64_t isHash = isIdentityPoly (pathHash, nz);
 
             int t = (int) std::floor (dist / SPEED * sr);
             if (ts > 0.05)
@@ -1489,27 +2028,25 @@ std::vector<IRSynthEngine::Ref> IRSynthEngine::calcRefsPolygon (
 
             const double polarity = (totalBounces % 2 == 0) ? 1.0 : -1.0;
 
-            std::array<double, 8> amps;
+            // Factor order (bit-identity with the pre-kernel loop):
+            //   • floor / ceiling absorption — vertical bounces, alternating
+            //   • is.cumAbs — wall absorption accumulated along the 2D chain
+            //   • vault HF absorption — per vertical bounce
+            //   • organ-case absorption — calcRefs applies it per |ny|; the
+            //     polygon path approximates it once per horizontal bounce
+            //     (it is a coarse blanket factor anyway)
+            const int anz = std::abs (nz);
+            const double* factors[BandAmpKernel::kNumFactors] = {
+                powF.row ((anz + 1) / 2), powC.row (anz / 2),
+                is.cumAbs.data(), powV.row (anz), powO.row (is.order) };
+            double air[8], mic[8];
             for (int b = 0; b < N_BANDS; ++b)
-            {
-                double a = 1.0 / std::max (dist, 0.5);
-                // Vertical bounces: floor/ceiling absorption (alternating).
-                a *= std::pow (rF[(size_t) b], std::ceil  (std::abs (nz) / 2.0));
-                a *= std::pow (rC[(size_t) b], std::floor (std::abs (nz) / 2.0));
-                // Horizontal bounces: cumulative wall absorption from the 2D
-                // chain (stored in is.cumAbs, accumulated at each wall hit).
-                a *= is.cumAbs[(size_t) b];
-                // Vault HF absorption — applied per vertical bounce.
-                if (std::abs (nz) > 0)
-                    a *= std::pow (1.0 - vHfA * std::min (b / 3.0, 1.0), std::abs (nz));
-                // Organ-case absorption — calcRefs applies it per |ny|; for the
-                // polygon path we approximate by applying it once per horizontal
-                // bounce (it is a coarse blanket factor anyway).
-                if (is.order > 0)
-                    a *= std::pow (oF, is.order);
-                amps[(size_t) b] = a * std::pow (10.0, -AIR[b] * dist / 20.0)
-                                   * micG (b, micPat, cosTh3D) * sgBand[(size_t) b] * polarity;
-            }
+                air[b] = std::pow (10.0, -AIR[b] * dist / 20.0);
+            micGains (micPattern, cosTh3D, mic);
+
+            std::array<double, 8> amps;
+            BandAmpKernel::amplitudes (1.0 / std::max (dist, 0.5), factors, air, mic,
+                                       sgBand.data(), polarity, amps.data());
             refs.push_back ({ t, amps, az });
 
             // Feature A — Lambert diffuse scatter.
@@ -1550,101 +2087,151 @@ std::vector<IRSynthEngine::Ref> IRSynthEngine::calcRefsPolygon (
 }
 
 // ── bpF — verbatim from JS (bandpass) ──────────────────────────────────────
-std::vector<double> IRSynthEngine::bpF (const std::vector<double>& buf, double fc, int sr)
+namespace
 {
-    double wl = std::max(fc / 1.414, 20.0) / (sr / 2.0);
-    double wh = std::min(fc * 1.414, sr / 2.0 - 1.0) / (sr / 2.0);
-    double wc = (wl + wh) / 2.0;
-    double Q = wc / (wh - wl);
-    double K = std::tan(wc * 3.141592653589793 * 0.5);
-    double n = 1.0 / (1.0 + K / Q + K * K);
-    double b0 = K / Q * n, b2 = -b0, a1 = 2.0 * (K * K - 1.0) * n, a2 = (1.0 - K / Q + K * K) * n;
-
-    std::vector<double> out(buf.size());
-    double x1 = 0, x2 = 0, y1 = 0, y2 = 0;
-    for (size_t i = 0; i < buf.size(); ++i)
+    // bpF's octave band-pass biquad with its state exposed, so renderCh can
+    // run it chunk by chunk and skip chunks where the band is silent.
+    struct BandpassBiquad
     {
-        double x = buf[i];
-        double y = b0 * x + b2 * x2 - a1 * y1 - a2 * y2;
-        out[i] = y;
-        x2 = x1; x1 = x; y2 = y1; y1 = y;
-    }
+        double b0 = 0.0, b2 = 0.0, a1 = 0.0, a2 = 0.0;
+        double x1 = 0.0, x2 = 0.0, y1 = 0.0, y2 = 0.0;
+
+        BandpassBiquad (double fc, int sr)
+        {
+            double wl = std::max(fc / 1.414, 20.0) / (sr / 2.0);
+            double wh = std::min(fc * 1.414, sr / 2.0 - 1.0) / (sr / 2.0);
+            double wc = (wl + wh) / 2.0;
+            double Q = wc / (wh - wl);
+            double K = std::tan(wc * 3.141592653589793 * 0.5);
+            double n = 1.0 / (1.0 + K / Q + K * K);
+            b0 = K / Q * n; b2 = -b0; a1 = 2.0 * (K * K - 1.0) * n; a2 = (1.0 - K / Q + K * K) * n;
+        }
+
+        double process (double x) noexcept
+        {
+            double y = b0 * x + b2 * x2 - a1 * y1 - a2 * y2;
+            x2 = x1; x1 = x; y2 = y1; y1 = y;
+            return y;
+        }
+
+        double stateMagnitude() const noexcept
+        {
+            return std::max ({ std::abs (x1), std::abs (x2), std::abs (y1), std::abs (y2) });
+        }
+
+        // The recursion never decays to exactly zero: once y1 / y2 reach the
+        // subnormal range, rounding sustains a limit cycle. Below this the
+        // state is treated as silent (its output is ≥ 600 dB down on any
+        // deposited reflection) and flushed.
+        static constexpr double kSilentState = 1e-30;
+
+        void reset() noexcept { x1 = x2 = y1 = y2 = 0.0; }
+    };
+}
+
+template <typename Sample>
+std::vector<Sample> IRSynthEngine::bpF (const std::vector<Sample>& buf, double fc, int sr)
+{
+    BandpassBiquad f (fc, sr);
+    std::vector<Sample> out(buf.size());
+    for (size_t i = 0; i < buf.size(); ++i)
+        out[i] = (Sample)f.process(buf[i]);
     return out;
 }
 
 // ── lpF — verbatim from JS (lowpass) ───────────────────────────────────────
-std::vector<double> IRSynthEngine::lpF (const std::vector<double>& buf, double fc, int sr)
+template <typename Sample>
+std::vector<Sample> IRSynthEngine::lpF (const std::vector<Sample>& buf, double fc, int sr)
 {
     double K = std::tan(3.141592653589793 * fc / sr);
     double n = 1.0 / (1.0 + 1.414213562373095 * K + K * K);
     double b0 = K * K * n, b1 = 2.0 * b0, b2 = b0;
     double a1 = 2.0 * (K * K - 1.0) * n, a2 = (1.0 - 1.414213562373095 * K + K * K) * n;
 
-    std::vector<double> out(buf.size());
+    std::vector<Sample> out(buf.size());
     double x1 = 0, x2 = 0, y1 = 0, y2 = 0;
     for (size_t i = 0; i < buf.size(); ++i)
     {
         double x = buf[i];
         double y = b0 * x + b1 * x1 + b2 * x2 - a1 * y1 - a2 * y2;
-        out[i] = y;
+        out[i] = (Sample)y;
         x2 = x1; x1 = x; y2 = y1; y1 = y;
     }
     return out;
 }
 
 // ── hpF — verbatim from JS (highpass) ───────────────────────────────────────
-std::vector<double> IRSynthEngine::hpF (const std::vector<double>& buf, double fc, int sr)
+template <typename Sample>
+std::vector<Sample> IRSynthEngine::hpF (const std::vector<Sample>& buf, double fc, int sr)
 {
     double K = std::tan(3.141592653589793 * fc / sr);
     double n = 1.0 / (1.0 + 1.414213562373095 * K + K * K);
     double b0 = n, b1 = -2.0 * n, b2 = n;
     double a1 = 2.0 * (K * K - 1.0) * n, a2 = (1.0 - 1.414213562373095 * K + K * K) * n;
 
-    std::vector<double> out(buf.size());
+    std::vector<Sample> out(buf.size());
     double x1 = 0, x2 = 0, y1 = 0, y2 = 0;
     for (size_t i = 0; i < buf.size(); ++i)
     {
         double x = buf[i];
         double y = b0 * x + b1 * x1 + b2 * x2 - a1 * y1 - a2 * y2;
-        out[i] = y;
+        out[i] = (Sample)y;
         x2 = x1; x1 = x; y2 = y1; y1 = y;
     }
     return out;
 }
 
-// ── bpFQ — high-Q bandpass biquad for modal resonators ─────────────────────
-// Same design as bpF but with explicit Q instead of the fixed octave-band Q.
-std::vector<double> IRSynthEngine::bpFQ (const std::vector<double>& buf, double fc, double Q, int sr)
+// ── roomModes — box modes below 250 Hz for the modal bank ─────────────────
+// f = c/2 · √((nx/L)² + (ny/W)² + (nz/H)²). One non-zero index is an axial
+// mode, two a tangential, three an oblique one.
+std::vector<IRSynthEngine::RoomMode> IRSynthEngine::roomModes (
+    double L, double W, double H, bool tangentialOblique)
 {
-    double K = std::tan(3.141592653589793 * fc / (double)sr);
-    double n = 1.0 / (1.0 + K / Q + K * K);
-    double b0 = K / Q * n, b2 = -b0;
-    double a1 = 2.0 * (K * K - 1.0) * n;
-    double a2 = (1.0 - K / Q + K * K) * n;
-    std::vector<double> out(buf.size());
-    double x1=0, x2=0, y1=0, y2=0;
-    for (size_t i = 0; i < buf.size(); ++i)
+    // Axial mode frequencies: f_n = c*n / (2*L), n = 1..4 per dimension
+    std::vector<RoomMode> modes;
+    for (int n = 1; n <= 4; ++n)
     {
-        double x = buf[i];
-        double y = b0*x + b2*x2 - a1*y1 - a2*y2;
-        out[i] = y;  x2=x1; x1=x; y2=y1; y1=y;
+        double fx = SPEED * n / (2.0 * L);
+        double fy = SPEED * n / (2.0 * W);
+        double fz = SPEED * n / (2.0 * H);
+        if (fx > 10.0 && fx < 250.0) modes.push_back({ fx, 1.0 });
+        if (fy > 10.0 && fy < 250.0) modes.push_back({ fy, 1.0 });
+        if (fz > 10.0 && fz < 250.0) modes.push_back({ fz, 1.0 });
     }
-    return out;
+    if (! tangentialOblique)
+        return modes;
+
+    for (int nx = 0; nx <= 4; ++nx)
+        for (int ny = 0; ny <= 4; ++ny)
+            for (int nz = 0; nz <= 4; ++nz)
+            {
+                const int nonZero = (nx > 0) + (ny > 0) + (nz > 0);
+                if (nonZero < 2)
+                    continue;
+                const double kx = nx / L, ky = ny / W, kz = nz / H;
+                const double f = 0.5 * SPEED * std::sqrt (kx * kx + ky * ky + kz * kz);
+                if (f > 10.0 && f < 250.0)
+                    modes.push_back({ f, nonZero == 2 ? std::sqrt (0.5) : 0.5 });
+            }
+    return modes;
 }
 
-// ── applyModalBank — add axial room-mode resonances below ~250 Hz ───────────
+// ── applyModalBank — add room-mode resonances below ~250 Hz ────────────────
 // The image-source method is ray-based and under-represents low-frequency
-// standing-wave energy.  A parallel bank of IIR resonators tuned to the axial
+// standing-wave energy.  A parallel bank of IIR resonators tuned to the
 // modes of the room adds the modal ringing characteristic of large enclosed spaces.
 // Each resonator's Q is derived from the 125 Hz RT60 so modes decay correctly.
-std::vector<double> IRSynthEngine::applyModalBank (
-    const std::vector<double>& buf,
+template <typename Sample>
+void IRSynthEngine::applyModalBank (
+    std::vector<Sample>& iLL, std::vector<Sample>& iRL,
+    std::vector<Sample>& iLR, std::vector<Sample>& iRR,
     double W, double D, double He,
     double rt60_125, double gain, int sr,
     const std::string& shape,
-    double polygonAreaM2)
+    double polygonAreaM2,
+    bool tangentialOblique)
 {
-    // Effective dimensions for the axial-mode formula. For rectangular rooms
+    // Effective dimensions for the mode formula. For rectangular rooms
     // these are just (W, D, He). For polygon rooms, the equivalent-box
     // approximation derives Wₑ, Dₑ from the polygon area so the modes sit at
     // frequencies a box of the same horizontal area would produce.
@@ -1663,7 +2250,7 @@ std::vector<double> IRSynthEngine::applyModalBank (
         // Caller must pass the polygon's actual horizontal area. If it's
         // missing or zero we fall back to the v2.8.0 early-return.
         if (polygonAreaM2 <= 1e-6)
-            return buf;
+            return;
 
         Leff = std::sqrt (polygonAreaM2);          // Wₑ = side of the area-equal square
         Weff = polygonAreaM2 / Leff;               // Dₑ = polygonArea / Wₑ  (= Leff for square)
@@ -1671,40 +2258,31 @@ std::vector<double> IRSynthEngine::applyModalBank (
 #else
         // v2.8.0 behaviour: axial modes not meaningful for polygon plans.
         (void) polygonAreaM2;
-        return buf;
+        return;
 #endif
     }
 
-    // Axial mode frequencies: f_n = c*n / (2*L), n = 1..4 per dimension
-    std::vector<double> modes;
-    for (int n = 1; n <= 4; ++n)
-    {
-        double fx = SPEED * n / (2.0 * Leff);
-        double fy = SPEED * n / (2.0 * Weff);
-        double fz = SPEED * n / (2.0 * Heff);
-        if (fx > 10.0 && fx < 250.0) modes.push_back(fx);
-        if (fy > 10.0 && fy < 250.0) modes.push_back(fy);
-        if (fz > 10.0 && fz < 250.0) modes.push_back(fz);
-    }
-    if (modes.empty()) return buf;
+    const auto modes = roomModes (Leff, Weff, Heff, tangentialOblique);
+    if (modes.empty()) return;
 
-    std::vector<double> modal(buf.size(), 0.0);
-    for (double fc : modes)
+    std::vector<ModalBankKernel::Resonator> bank;
+    bank.reserve (modes.size());
+    double totalWeight = 0.0;
+    for (const auto& m : modes)
     {
         // Q = π*fc*RT60 / ln(1000) — standard decay-rate / bandwidth relationship
-        double Q = std::clamp(3.141592653589793 * fc * rt60_125 / 6.908, 8.0, 80.0);
+        double Q = std::clamp(3.141592653589793 * m.fc * rt60_125 / 6.908, 8.0, 80.0);
         // Lower modes carry more energy; weight ∝ 60/fc, clamped to avoid extreme boosts
-        double modeGain = gain * std::min(60.0 / fc, 2.0);
-        std::vector<double> res = bpFQ(buf, fc, Q, sr);
-        for (size_t i = 0; i < modal.size(); ++i)
-            modal[i] += res[i] * modeGain;
-    }
-    // Normalise by mode count so total level is stable regardless of room dimensions
-    const double norm = 1.0 / (double)modes.size();
-    std::vector<double> out(buf.size());
-    for (size_t i = 0; i < out.size(); ++i)
-        out[i] = buf[i] + modal[i] * norm;
-    return out;
+        double modeGain = gain * std::min(60.0 / m.fc, 2.0) * m.weight;
+        bank.push_back (ModalBankKernel::design (m.fc, Q, modeGain, sr));
+        totalWeight += m.weight;
+    }
+    // Normalise by (weighted) mode count so total level is stable regardless
+    // of room dimensions. Axial-only: 1 / modes.size(), as always.
+    const double norm = 1.0 / totalWeight;
+
+    Sample* const ch[ModalBankKernel::kNumChannels] = { iLL.data(), iRL.data(), iLR.data(), iRR.data() };
+    ModalBankKernel::process (bank, norm, ch, ModalBankKernel::kNumChannels, iLL.size());
 }
 
 // ── makeAllpassDiffuser — verbatim from JS ─────────────────────────────────
@@ -1760,76 +2338,188 @@ double IRSynthEngine::AllpassDiffuser::process (double x)
     return s;
 }
 
-// ── renderCh — verbatim from JS (per-band buffers, sum filtered, then diffuser) ─
-std::vector<double> IRSynthEngine::renderCh (
+// ── renderCh — sparse band-split render ──────────────────────────────────────
+// Same signal chain as the JS original (per-band impulse trains → bpF per
+// band → sum → deferred ER allpass), without its eight irLen-long band
+// buffers (≈ 92 MB per channel for a 30 s IR):
+//   • Reflections are bucketed by arrival time into kRenderChunk-sample
+//     chunks. Each chunk deposits its reflections into eight chunk-sized
+//     band blocks in refs order, so coincident impulses sum exactly as they
+//     did in the full-length buffers.
+//   • Each band's biquad then runs over the block, its state carried from
+//     chunk to chunk, and adds into the output in band order.
+//   • A band with nothing deposited in a chunk and a biquad state below
+//     BandpassBiquad::kSilentState skips the chunk, and its state is flushed
+//     to zero. The state never reaches exactly zero on its own (it settles
+//     into a subnormal limit cycle), so without the threshold every band
+//     would filter to the end of the IR. Past the last reflection each band
+//     drops below it within ~0.3 s (125 Hz, the slowest), so the cost
+//     follows the reflection span, not irLen × N_BANDS (IR_59). The ER
+//     allpass stops the same way once its delay lines are below it.
+// The skipped samples are below 1e-30 in the dense render, so the output
+// matches it to that level (IR_51) and the IR_11 / IR_14 locks hold.
+namespace
+{
+    constexpr int kRenderChunk = 4096;
+}
+
+template <typename Sample>
+std::vector<Sample> IRSynthEngine::renderCh (
     const std::vector<Ref>& refs,
     int irLen, double den, int sr, double diffusion,
     double reflectionSpreadMs,
-    double freqScatterMs)
+    double freqScatterMs,
+    Cancel cancel,
+    int* filteredChunks)
 {
-    std::vector<std::vector<double>> bi(N_BANDS);
-    for (int b = 0; b < N_BANDS; ++b)
-        bi[b].resize((size_t)irLen, 0.0);
+    if (filteredChunks != nullptr)
+        *filteredChunks = 0;
+    std::vector<Sample> raw((size_t)std::max(irLen, 0), Sample(0));
+    if (irLen <= 0)
+        return raw;
 
     const int spreadHalf = (reflectionSpreadMs > 0.0)
         ? std::max(1, (int)std::round(reflectionSpreadMs * 0.001 * sr * 0.5))
         : 0;
+    // Furthest any deposit lands from its reflection's arrival sample.
+    const int scatterReach = (freqScatterMs > 0.0) ? (int)std::ceil(freqScatterMs * sr / 1000.0) + 1 : 0;
+    const int reach = std::max(spreadHalf, scatterReach);
 
+    // Bucket (chunk index) of each reflection that can reach [0, irLen), or -1.
+    const int numChunks = (irLen + kRenderChunk - 1) / kRenderChunk;
+    auto bucketOf = [&] (const Ref& r)
+    {
+        if (spreadHalf <= 0 ? (r.t >= irLen) : (r.t - spreadHalf >= irLen || r.t + spreadHalf < 0))
+            return -1;
+        return std::clamp(r.t, 0, irLen - 1) / kRenderChunk;
+    };
+
+    // Stable counting sort of reflection indices by bucket, plus per-band
+    // input bounds: Σ|a·den| ≥ any deposited sample (a band whose bound is
+    // negligible is skipped, as the dense render skipped bands with peak
+    // ≤ 1e-12).
+    std::vector<int> bucketStart((size_t)numChunks + 1, 0);
+    std::array<double, 8> bandBound {};
     for (const auto& r : refs)
     {
-        double lat = std::abs(std::sin(r.az));
-        if (spreadHalf <= 0)
+        const int k = bucketOf(r);
+        if (k < 0) continue;
+        ++bucketStart[(size_t)k + 1];
+        for (int b = 0; b < N_BANDS; ++b)
+            bandBound[b] += std::abs(r.amps[b] * den);
+    }
+    for (int k = 0; k < numChunks; ++k)
+        bucketStart[(size_t)k + 1] += bucketStart[(size_t)k];
+    std::vector<int> order((size_t)bucketStart[(size_t)numChunks]);
+    {
+        std::vector<int> fill(bucketStart.begin(), bucketStart.end() - 1);
+        for (int i = 0; i < (int)refs.size(); ++i)
         {
-            if (r.t >= irLen) continue;
-            for (int b = 0; b < N_BANDS; ++b)
+            const int k = bucketOf(refs[(size_t)i]);
+            if (k >= 0) order[(size_t)fill[(size_t)k]++] = i;
+        }
+    }
+
+    std::vector<BandpassBiquad> filters;
+    for (int b = 0; b < N_BANDS; ++b)
+        filters.emplace_back((double)BANDS[b], sr);
+
+    const int nb = (reach + kRenderChunk - 1) / kRenderChunk;   // neighbour buckets a chunk reads
+    std::vector<double> block((size_t)N_BANDS * kRenderChunk, 0.0);
+    std::vector<double> mix((size_t)kRenderChunk);   // band sum, rounded to Sample once
+    std::vector<int> candidates;
+    int renderedEnd = 0;   // raw is silent from here on
+
+    for (int k = 0; k < numChunks; ++k)
+    {
+        if (isCancelled (cancel))
+            return {};
+
+        const int c0 = k * kRenderChunk;
+        const int c1 = std::min(c0 + kRenderChunk, irLen);
+
+        // Reflections that can deposit into [c0, c1), merged back into refs order.
+        candidates.clear();
+        for (int j = std::max(0, k - nb); j <= std::min(numChunks - 1, k + nb); ++j)
+        {
+            const auto mid = (std::ptrdiff_t)candidates.size();
+            candidates.insert(candidates.end(), order.begin() + bucketStart[(size_t)j],
+                                                order.begin() + bucketStart[(size_t)j + 1]);
+            std::inplace_merge(candidates.begin(), candidates.begin() + mid, candidates.end());
+        }
+
+        std::array<bool, 8> touched {};
+        for (int idx : candidates)
+        {
+            const auto& r = refs[(size_t)idx];
+            if (r.t + reach < c0 || r.t - reach >= c1) continue;
+            double lat = std::abs(std::sin(r.az));
+            if (spreadHalf <= 0)
             {
-                int bt = r.t;
-                if (freqScatterMs > 0.0 && b > 0)
+                for (int b = 0; b < N_BANDS; ++b)
                 {
-                    // Frequency-dependent scattering: higher frequency bands scatter more
-                    // because shorter wavelengths interact with surface micro-structure.
-                    // A deterministic hash of (arrival_sample, band) gives reproducible,
-                    // per-band uncorrelated offsets — no extra RNG state needed.
-                    uint32_t h = ((uint32_t)(r.t + 1) * 2654435769u) ^ ((uint32_t)b * 1234567891u);
-                    double frac = (double)(h & 0xFFFF) / 65535.0 - 0.5;  // −0.5 … +0.5
-                    double scale = (double)b / (double)(N_BANDS - 1);     // 0 @ 125Hz → 1 @ 16kHz
-                    bt += (int)std::round(frac * 2.0 * freqScatterMs * scale * sr / 1000.0);
-                    bt = std::clamp(bt, 0, irLen - 1);
+                    int bt = r.t;
+                    if (freqScatterMs > 0.0 && b > 0)
+                    {
+                        // Frequency-dependent scattering: higher frequency bands scatter more
+                        // because shorter wavelengths interact with surface micro-structure.
+                        // A deterministic hash of (arrival_sample, band) gives reproducible,
+                        // per-band uncorrelated offsets — no extra RNG state needed.
+                        uint32_t h = ((uint32_t)(r.t + 1) * 2654435769u) ^ ((uint32_t)b * 1234567891u);
+                        double frac = (double)(h & 0xFFFF) / 65535.0 - 0.5;  // −0.5 … +0.5
+                        double scale = (double)b / (double)(N_BANDS - 1);     // 0 @ 125Hz → 1 @ 16kHz
+                        bt += (int)std::round(frac * 2.0 * freqScatterMs * scale * sr / 1000.0);
+                        bt = std::clamp(bt, 0, irLen - 1);
+                    }
+                    if (bt < c0 || bt >= c1) continue;
+                    block[(size_t)(b * kRenderChunk + bt - c0)] += r.amps[b] * den * (1.0 - lat * ((double)b / (double)(N_BANDS - 1)) * 0.5);
+                    touched[(size_t)b] = true;
                 }
-                bi[b][(size_t)bt] += r.amps[b] * den * (1.0 - lat * ((double)b / (double)(N_BANDS - 1)) * 0.5);
             }
-        }
-        else
-        {
-            // Spread this reflection over ±spreadHalf samples with triangular envelope
-            // (weights sum to 1 so total energy is preserved).
-            double weightSum = 0.0;
-            for (int d = -spreadHalf; d <= spreadHalf; ++d)
-                weightSum += 1.0 - (double)std::abs(d) / (double)(spreadHalf + 1);
-            const double invSum = (weightSum > 1e-12) ? 1.0 / weightSum : 1.0;
-            for (int d = -spreadHalf; d <= spreadHalf; ++d)
+            else
             {
-                int i = r.t + d;
-                if (i < 0 || i >= irLen) continue;
-                double w = (1.0 - (double)std::abs(d) / (double)(spreadHalf + 1)) * invSum;
-                for (int b = 0; b < N_BANDS; ++b)
-                    bi[b][(size_t)i] += r.amps[b] * den * (1.0 - lat * ((double)b / (double)(N_BANDS - 1)) * 0.5) * w;
+                // Spread this reflection over ±spreadHalf samples with triangular envelope
+                // (weights sum to 1 so total energy is preserved).
+                double weightSum = 0.0;
+                for (int d = -spreadHalf; d <= spreadHalf; ++d)
+                    weightSum += 1.0 - (double)std::abs(d) / (double)(spreadHalf + 1);
+                const double invSum = (weightSum > 1e-12) ? 1.0 / weightSum : 1.0;
+                for (int d = -spreadHalf; d <= spreadHalf; ++d)
+                {
+                    int i = r.t + d;
+                    if (i < 0 || i >= irLen || i < c0 || i >= c1) continue;
+                    double w = (1.0 - (double)std::abs(d) / (double)(spreadHalf + 1)) * invSum;
+                    for (int b = 0; b < N_BANDS; ++b)
+                    {
+                        block[(size_t)(b * kRenderChunk + i - c0)] += r.amps[b] * den * (1.0 - lat * ((double)b / (double)(N_BANDS - 1)) * 0.5) * w;
+                        touched[(size_t)b] = true;
+                    }
+                }
             }
         }
-    }
 
-    std::vector<double> raw((size_t)irLen, 0.0);
-    for (int b = 0; b < N_BANDS; ++b)
-    {
-        double m = 0.0;
-        for (size_t i = 0; i < bi[b].size(); ++i)
-            if (std::abs(bi[b][i]) > m) m = std::abs(bi[b][i]);
-        if (m > 1e-12)
+        std::fill(mix.begin(), mix.end(), 0.0);
+        for (int b = 0; b < N_BANDS; ++b)
         {
-            std::vector<double> filt = bpF(bi[b], (double)BANDS[b], sr);
-            for (int i = 0; i < irLen; ++i)
-                raw[(size_t)i] += filt[(size_t)i];
+            if (bandBound[b] <= 1e-12) continue;
+            auto& f = filters[(size_t)b];
+            if (! touched[(size_t)b] && f.stateMagnitude() < BandpassBiquad::kSilentState)
+            {
+                f.reset();
+                continue;
+            }
+            if (filteredChunks != nullptr)
+                ++*filteredChunks;
+            double* x = block.data() + (size_t)b * kRenderChunk;
+            for (int i = c0; i < c1; ++i)
+                mix[(size_t)(i - c0)] += f.process(x[i - c0]);
+            if (touched[(size_t)b])
+                std::fill(x, x + (c1 - c0), 0.0);
+            renderedEnd = c1;
         }
+        if (renderedEnd == c1)
+            for (int i = c0; i < c1; ++i)
+                raw[(size_t)i] = (Sample)mix[(size_t)(i - c0)];
     }
 
     // Temporal smoothing DISABLED: a 5 ms moving average replaces each sample with
@@ -1854,25 +2544,37 @@ std::vector<double> IRSynthEngine::renderCh (
         // the allpass state is cold (zero) when diffusion kicks in.
         // Use ER-specific allpass (shorter incommensurate delays) so we don't
         // get a dominant 17.1 ms repeating delay from the default allpass.
+        //
+        // In place: 0 … dryEnd-1 stays dry, dryEnd … wetStart-1 crossfades
+        // dry→wet linearly, wetStart … irLen-1 is fully wet.
         const int dryEnd   = (int)std::round(0.065 * sr);  // pure-dry up to here
         const int fadeLen  = (int)std::round(0.020 * sr);  // crossfade window
         const int wetStart = dryEnd + fadeLen;              // fully-wet from here
 
-        std::vector<double> wet((size_t)irLen, 0.0);
         AllpassDiffuser diff = makeAllpassDiffuserForER(sr, diffusion);
+        auto diffuserIsQuiet = [&diff]
+        {
+            for (const auto& buf : diff.bufs)
+                for (double v : buf)
+                    if (std::abs(v) >= BandpassBiquad::kSilentState)
+                        return false;
+            return true;
+        };
         for (int i = dryEnd; i < irLen; ++i)
-            wet[(size_t)i] = diff.process(raw[(size_t)i]);
-
-        // 0 … dryEnd-1  →  raw unchanged (dry)
-        // dryEnd … wetStart-1  →  linear crossfade dry→wet
-        for (int i = dryEnd; i < wetStart && i < irLen; ++i)
         {
-            const double t  = (double)(i - dryEnd) / (double)fadeLen;
-            raw[(size_t)i]  = raw[(size_t)i] * (1.0 - t) + wet[(size_t)i] * t;
+            // Past the rendered span the input is silent; stop once the
+            // delay lines are silent too (the rest of raw is already zero).
+            if (i >= renderedEnd && (i - renderedEnd) % kRenderChunk == 0 && diffuserIsQuiet())
+                break;
+            const double wet = diff.process(raw[(size_t)i]);
+            if (i < wetStart)
+            {
+                const double t  = (double)(i - dryEnd) / (double)fadeLen;
+                raw[(size_t)i]  = (Sample)(raw[(size_t)i] * (1.0 - t) + wet * t);
+            }
+            else
+                raw[(size_t)i] = (Sample)wet;
         }
-        // wetStart … irLen-1  →  fully wet
-        for (int i = wetStart; i < irLen; ++i)
-            raw[(size_t)i] = wet[(size_t)i];
     }
     return raw;
 }
@@ -1910,17 +2612,13 @@ static void hadamard16 (std::vector<double>& a)
         a[i] *= s;
 }
 
-// ── renderFDNTail — verbatim from JS (N=16 FDN, Hadamard, LFO modulation) ──
-std::vector<double> IRSynthEngine::renderFDNTail (
-    const std::vector<double>& rt60s,
-    int irLen, int erCut,
-    const std::vector<double>& erIR,
-    double diffusion, int sr, uint32_t seed,
-    double roomW, double roomD, double roomH,
-    int maxRefCut,
-    const IRSynthParams* paramsForShape)
+// ── designFDN — delay / LFO / loss-filter design for renderFDNTail ─────────
+FdnKernel::Config IRSynthEngine::designFDN (const std::vector<double>& rt60s, int sr, uint32_t seed,
+                                            double roomW, double roomD, double roomH,
+                                            const IRSynthParams* paramsForShape)
 {
-    const int N = 16;
+    const int N = FdnKernel::kNumLines;
+    FdnKernel::Config cfg;
     // Volume / surface — rectangular formula by default. For polygon shapes the
     // floor area and perimeter come from makeWalls2D, giving the correct mean
     // free path for fan/cathedral/octagonal/circular footprints. The rectangular
@@ -1949,38 +2647,18 @@ std::vector<double> IRSynthEngine::renderFDNTail (
 
     // Power-law spacing so the longest delay lines are spread (not clustered at maxMs).
     // Reduces the level of a single dominant recurrence; exponent 1.4 spreads the top.
-    std::vector<int> delays(N);
+    auto& delays = cfg.delay;
     const double power = 1.4;
     for (int i = 0; i < N; ++i)
     {
         double frac = (N > 1) ? std::pow((double)i / (double)(N - 1), power) : 1.0;
         double t = minMs + (maxMs - minMs) * frac;
-        delays[i] = nearestPrime((int)std::round(t * sr / 1000.0));
+        delays[(size_t)i] = nearestPrime((int)std::round(t * sr / 1000.0));
     }
     for (int i = 1; i < N; ++i)
-        if (delays[i] <= delays[i - 1])
-            delays[i] = nearestPrime(delays[i - 1] + 2);
-
-    // LFO modulation depth varies per delay line depending on how HF-attenuated
-    // that line is.  A line with alpha ≈ 1.0 (LF-dominated, little HF content)
-    // can tolerate ±1.2 ms without audible chorusing.  A line with low alpha
-    // (fast HF decay, significant HF content) must use a much shallower depth
-    // (≈ ±0.3 ms) to avoid pitch-modulation artefacts on high-frequency transients.
-    // Linear interpolation on alpha: depth = MIN + (MAX – MIN) * alpha.
-    const double LFO_DEPTH_MAX_MS = 1.2;   // for LF-dominated lines (alpha → 1.0)
-    const double LFO_DEPTH_MIN_MS = 0.3;   // for HF-attenuated lines (alpha → 0.0)
-    // Per-line depths are populated after the lpAlpha loop below.
-    std::vector<int> lfoDepthSamp(N, 0);
-
-    // Buffer size is determined by the maximum possible modulation depth (LFO_DEPTH_MAX_MS).
-    int maxLfoDepthSamp = (int)std::round(LFO_DEPTH_MAX_MS * sr / 1000.0);
-
-    std::vector<std::vector<double>> bufs(N);
-    for (int i = 0; i < N; ++i)
-        bufs[i].resize((size_t)(delays[i] + maxLfoDepthSamp * 2 + 4), 0.0);
+        if (delays[(size_t)i] <= delays[(size_t)i - 1])
+            delays[(size_t)i] = nearestPrime(delays[(size_t)i - 1] + 2);
 
-    std::vector<int> writePtr(N, 0);
-    std::vector<double> lfoRates(N), lfoPhaseAcc(N);
     {
         // Use geometric (not linear/arithmetic) spacing for LFO rates so that no
         // two delay lines share a rational beat frequency.  Linear spacing
@@ -1998,51 +2676,115 @@ std::vector<double> IRSynthEngine::renderFDNTail (
         const double channelPhaseOffset = (seed == 101 ? 3.141592653589793 : 0.0);
         for (int i = 0; i < N; ++i)
         {
-            lfoRates[i]    = r_base_hz * std::pow(k, i) * twoPiOverSr;
-            lfoPhaseAcc[i] = channelPhaseOffset + i * 0.7853;
+            cfg.lfoRate[(size_t)i]  = r_base_hz * std::pow(k, i) * twoPiOverSr;
+            cfg.lfoPhase[(size_t)i] = channelPhaseOffset + i * 0.7853;
         }
     }
 
-    auto readFrac = [&](int ch, int delaySamp) -> double
-    {
-        int len = (int)bufs[ch].size();
-        double readF = ((writePtr[ch] - delaySamp) % len + len) % len;
-        int r0 = (int)std::floor(readF);
-        double frac = readF - r0;
-        int r1 = (r0 + 1) % len;
-        return bufs[ch][r0] * (1.0 - frac) + bufs[ch][r1] * frac;
-    };
-
-    std::vector<double> lpState(N, 0.0);
-    struct LpAlpha { double alpha; double gain; };
-    std::vector<LpAlpha> lpAlpha(N);
     for (int i = 0; i < N; ++i)
     {
-        int d = delays[i];
+        int d = delays[(size_t)i];
         double gLF = std::pow(10.0, -3.0 * d / (rt60s[0] * sr));
         // Use 16 kHz RT60 (rt60s[7]) as HF reference — more aggressive than the previous
         // 4 kHz reference (rt60s[5]).  Air absorption above 8 kHz is substantial, so the
         // 1-pole LP correctly darkens large-room tails in proportion to their size.
         double gHF = std::pow(10.0, -3.0 * d / (rt60s[7] * sr));
         double alpha = std::min(0.9995, std::max(0.05, gHF / std::max(gLF, 1e-9)));
-        lpAlpha[i] = { alpha, gLF };
+        cfg.alpha[(size_t)i] = alpha;
+        cfg.gain[(size_t)i]  = gLF;
     }
 
-    // Compute per-line LFO modulation depth from each line's filter coefficient.
+    // LFO modulation depth varies per delay line depending on how HF-attenuated
+    // that line is.  A line with alpha ≈ 1.0 (LF-dominated, little HF content)
+    // can tolerate ±1.2 ms without audible chorusing.  A line with low alpha
+    // (fast HF decay, significant HF content) must use a much shallower depth
+    // (≈ ±0.3 ms) to avoid pitch-modulation artefacts on high-frequency transients.
+    // Linear interpolation on alpha: depth = MIN + (MAX – MIN) * alpha.
     // alpha is already clamped to [0.05, 0.9995] above; the extra clamp here is
     // defensive against any future floating-point edge cases.
     for (int i = 0; i < N; ++i)
     {
-        double a = std::max(0.0, std::min(1.0, lpAlpha[i].alpha));
-        double depthMs = LFO_DEPTH_MIN_MS + (LFO_DEPTH_MAX_MS - LFO_DEPTH_MIN_MS) * a;
-        lfoDepthSamp[i] = (int)std::round(depthMs * sr / 1000.0);
+        double a = std::max(0.0, std::min(1.0, cfg.alpha[(size_t)i]));
+        double depthMs = kFdnLfoDepthMinMs + (kFdnLfoDepthMaxMs - kFdnLfoDepthMinMs) * a;
+        cfg.lfoDepth[(size_t)i] = (int)std::round(depthMs * sr / 1000.0);
     }
+    return cfg;
+}
+
+std::array<FdnKernel::Config, 2> IRSynthEngine::designPathFDN (const IRSynthParams& p, TailPath path, int sr)
+{
+    // He and rt as synthMainPath / synthExtraPath compute them.
+    auto& vp = getVP();
+    auto vpIt = vp.find(p.vault_type);
+    if (vpIt == vp.end()) vpIt = vp.find("None (flat)");
+    const double hm = vpIt != vp.end() ? vpIt->second[0] : 1.0;
+    const double He = p.height * hm;
+    const std::vector<double> rt = calcRT60(p);
+
+    const uint32_t seedL = path == TailPath::Main   ? 100u
+                         : path == TailPath::Outrig ? kOutrigSeedBase + 58
+                                                    : kAmbientSeedBase + 58;
+    return { designFDN(rt, sr, seedL,     p.width, p.depth, He, &p),
+             designFDN(rt, sr, seedL + 1, p.width, p.depth, He, &p) };
+}
+
+// ── renderFDNTail — verbatim from JS (N=16 FDN, Hadamard, LFO modulation) ──
+template <typename Sample>
+std::vector<Sample> IRSynthEngine::renderFDNTail (
+    const std::vector<double>& rt60s,
+    int irLen, int erCut,
+    const std::vector<Sample>& erIR,
+    double diffusion, int sr, uint32_t seed,
+    double roomW, double roomD, double roomH,
+    int maxRefCut,
+    const IRSynthParams* paramsForShape,
+    Cancel cancel)
+{
+    const int N = 16;
+    const FdnKernel::Config cfg = designFDN(rt60s, sr, seed, roomW, roomD, roomH, paramsForShape);
+    const std::vector<int> delays(cfg.delay.begin(), cfg.delay.end());
+    const std::vector<int> lfoDepthSamp(cfg.lfoDepth.begin(), cfg.lfoDepth.end());
+
+    // Buffer size is determined by the maximum possible modulation depth.
+    int maxLfoDepthSamp = (int)std::round(kFdnLfoDepthMaxMs * sr / 1000.0);
+
+    // The vectorised core keeps its own delay memory (FdnKernel::Lines16).
+    const bool vectorised = paramsForShape != nullptr && paramsForShape->fdn_vectorised;
+    std::vector<std::vector<double>> bufs(vectorised ? 0 : N);
+    for (int i = 0; i < (int)bufs.size(); ++i)
+        bufs[i].resize((size_t)(delays[i] + maxLfoDepthSamp * 2 + 4), 0.0);
+
+    std::vector<int> writePtr(N, 0);
+    std::vector<double> lfoRates(cfg.lfoRate.begin(), cfg.lfoRate.end());
+    std::vector<double> lfoPhaseAcc(cfg.lfoPhase.begin(), cfg.lfoPhase.end());
+
+    auto readFrac = [&](int ch, int delaySamp) -> double
+    {
+        int len = (int)bufs[ch].size();
+        double readF = ((writePtr[ch] - delaySamp) % len + len) % len;
+        int r0 = (int)std::floor(readF);
+        double frac = readF - r0;
+        int r1 = (r0 + 1) % len;
+        return bufs[ch][r0] * (1.0 - frac) + bufs[ch][r1] * frac;
+    };
+
+    std::vector<double> lpState(N, 0.0);
+    struct LpAlpha { double alpha; double gain; };
+    std::vector<LpAlpha> lpAlpha(N);
+    for (int i = 0; i < N; ++i)
+        lpAlpha[i] = { cfg.alpha[(size_t)i], cfg.gain[(size_t)i] };
+
+    FdnKernel::Lines16 kernel;
+    if (vectorised)
+        kernel.prepare(cfg);
 
     std::vector<double> tmpMix(N);
 
     auto fdnStep = [&](double inject, int sampleIdx) -> double
     {
         (void)sampleIdx;
+        if (vectorised)
+            return kernel.step(inject);
         for (int ch = 0; ch < N; ++ch)
         {
             lfoPhaseAcc[ch] += lfoRates[ch];
@@ -2082,7 +2824,7 @@ std::vector<double> IRSynthEngine::renderFDNTail (
         fdnStep(erIR[(size_t)i] * env, i);
     }
 
-    std::vector<double> out((size_t)irLen, 0.0);
+    std::vector<Sample> out((size_t)irLen, Sample(0));
 
     // Phase 2 — seed AND capture (erCut … maxRefCut-1).
     // The image-source signal continues to feed the FDN while its output is
@@ -2093,14 +2835,24 @@ std::vector<double> IRSynthEngine::renderFDNTail (
     //     85 ms warmup alone could provide.  Without this, the FDN level at 1 s
     //     is much quieter than the image-source field it must replace, causing
     //     the audible reverb cutoff at exactly maxRefDist.
+    // Both capture phases poll the cancellation token every 8192 samples.
+    constexpr int kCancelCheckMask = 8191;
     for (int i = erCut; i < maxRefCut; ++i)
-        out[(size_t)i] = fdnStep(erIR[(size_t)i], i);
+    {
+        if ((i & kCancelCheckMask) == 0 && isCancelled (cancel))
+            return {};
+        out[(size_t)i] = (Sample)fdnStep(erIR[(size_t)i], i);
+    }
 
     // Phase 3 — free-running (maxRefCut … irLen-1).
     // Image sources are silent beyond maxRefDist; the FDN now carries the full
     // reverb tail on its own, decaying naturally at the room's RT60.
     for (int i = maxRefCut; i < irLen; ++i)
-        out[(size_t)i] = fdnStep(0.0, i);
+    {
+        if ((i & kCancelCheckMask) == 0 && isCancelled (cancel))
+            return {};
+        out[(size_t)i] = (Sample)fdnStep(0.0, i);
+    }
 
     if (diffusion > 0.02)
     {
@@ -2108,7 +2860,7 @@ std::vector<double> IRSynthEngine::renderFDNTail (
         // without blurring the initial discrete reflections.
         AllpassDiffuser diff = makeAllpassDiffuser(sr, diffusion);
         for (int i = 0; i < irLen; ++i)
-            out[(size_t)i] = diff.process(out[(size_t)i]);
+            out[(size_t)i] = (Sample)diff.process(out[(size_t)i]);
     }
 
     return out;
@@ -2142,11 +2894,13 @@ static double shapeDen (const std::string& shape)
 // MAIN output (guarded by IR_14).
 //
 // When one or more extras are enabled the dispatcher runs MAIN and each
-// enabled extra concurrently via std::async (launch::async policy).
+// enabled extra as a task on the shared SynthTaskPool; MAIN's own
+// per-channel stages are nested tasks on the same pool, so the whole synth
+// never runs more threads than the pool has workers (plus this one).
 // Synchronisation notes:
 //   • IRSynthEngine's static material / vault / mic-pattern maps use lazy
 //     `if (empty()) fill(); ` initialisation which is NOT thread-safe. We
-//     warm them up on the calling thread here so all async threads only ever
+//     warm them up on the calling thread here so all pool threads only ever
 //     *read* from the populated maps (which is safe for std::map).
 //   • The progress callback is serialised behind cbMutex so hosts that assume
 //     single-threaded GUI callbacks (the common case) don't see a race.
@@ -2154,39 +2908,48 @@ static double shapeDen (const std::string& shape)
 //     MIN across active paths (i.e. "we're waiting for the slowest path").
 //   • MAIN is authoritative for res.rt60 / res.irLen / res.sampleRate /
 //     res.success. Extras only populate res.direct / res.outrig / res.ambient.
+//   • Cancellation: `cancel` is shared by every task group of this synth,
+//     so cancelling it drops all queued path / stage tasks at once, and the
+//     running ones bail out at their next checkpoint (calcRefs per image
+//     column, renderCh per render chunk, renderFDNTail every 8192 samples, and
+//     between stages). The pool is free again within a few milliseconds.
 // ── Output safety gain (v2.14.2) ─────────────────────────────────────────
 // Helper: peak across one channel buffer. Defined here rather than as a
 // member to keep the class API stable.
 namespace {
-    inline double peakAbs (const std::vector<double>& v)
+    template <typename Sample>
+    inline double peakAbs (const std::vector<Sample>& v)
     {
         double m = 0.0;
         for (double x : v) { double a = std::fabs (x); if (a > m) m = a; }
         return m;
     }
 
-    inline double peakAcrossPaths (const IRSynthResult& r)
+    template <typename Sample>
+    inline double peakAcrossPaths (const IRSynthResultT<Sample>& r)
     {
         double m = 0.0;
         m = std::max ({ m, peakAbs (r.iLL), peakAbs (r.iRL),
                            peakAbs (r.iLR), peakAbs (r.iRR) });
-        for (const MicIRChannels* ch : { &r.direct, &r.outrig, &r.ambient })
+        for (const MicIRChannelsT<Sample>* ch : { &r.direct, &r.outrig, &r.ambient })
             if (ch->synthesised)
                 m = std::max ({ m, peakAbs (ch->LL), peakAbs (ch->RL),
                                    peakAbs (ch->LR), peakAbs (ch->RR) });
         return m;
     }
 
-    inline void scaleChannels (std::vector<double>& v, double g)
+    template <typename Sample>
+    inline void scaleChannels (std::vector<Sample>& v, double g)
     {
-        for (double& x : v) x *= g;
+        for (Sample& x : v) x = (Sample) (x * g);
     }
 
-    inline void scaleAllPaths (IRSynthResult& r, double g)
+    template <typename Sample>
+    inline void scaleAllPaths (IRSynthResultT<Sample>& r, double g)
     {
         scaleChannels (r.iLL, g); scaleChannels (r.iRL, g);
         scaleChannels (r.iLR, g); scaleChannels (r.iRR, g);
-        for (MicIRChannels* ch : { &r.direct, &r.outrig, &r.ambient })
+        for (MicIRChannelsT<Sample>* ch : { &r.direct, &r.outrig, &r.ambient })
             if (ch->synthesised) {
                 scaleChannels (ch->LL, g); scaleChannels (ch->RL, g);
                 scaleChannels (ch->LR, g); scaleChannels (ch->RR, g);
@@ -2199,7 +2962,8 @@ namespace {
     // peak ≤ 1.0 AND synth_gain_db == 0, applied_gain == 1.0 exactly, no
     // multiplication runs through any sample, and the result is byte-
     // identical to the pre-v2.14.2 engine.
-    void applyOutputGain (IRSynthResult& res, const IRSynthParams& p)
+    template <typename Sample>
+    void applyOutputGain (IRSynthResultT<Sample>& res, const IRSynthParams& p)
     {
         const double peak = peakAcrossPaths (res);
         // Sentinel: negligible peak → leave applied_gain at 0 dB and let
@@ -2230,9 +2994,13 @@ namespace {
     }
 }
 
-IRSynthResult IRSynthEngine::synthIR (const IRSynthParams& p, IRSynthProgressFn cb)
+template <typename Sample>
+IRSynthResultT<Sample> IRSynthEngine::synthIR (const IRSynthParams& p, IRSynthProgressFn cb,
+                                               SynthTaskPool::CancellationToken cancel)
 {
     const bool anyExtra = p.outrig_enabled || p.ambient_enabled || p.direct_enabled;
+    const auto synthStart = std::chrono::steady_clock::now();
+    auto elapsedMs = [&] { return std::chrono::duration<double, std::milli> (std::chrono::steady_clock::now() - synthStart).count(); };
 
     // Fast path: no extras → straight synchronous call. Guarantees bit-identity
     // with the pre-C5 behaviour for every existing session, preset and test.
@@ -2240,8 +3008,10 @@ IRSynthResult IRSynthEngine::synthIR (const IRSynthParams& p, IRSynthProgressFn
     // and synth_gain_db == 0 (the default for every legacy IR / fixture).
     if (! anyExtra)
     {
-        IRSynthResult res = synthMainPath (p, cb);
+        IRSynthResultT<Sample> res = synthMainPath<Sample> (p, cb, &cancel);
         if (res.success) applyOutputGain (res, p);
+        res.preview = p.preview;
+        res.profile.totalWallMs = elapsedMs();
         return res;
     }
 
@@ -2270,60 +3040,82 @@ IRSynthResult IRSynthEngine::synthIR (const IRSynthParams& p, IRSynthProgressFn
     auto outrigCb = [&](double f, const std::string& m) { outrigProg.store (f);  reportAggregate (m); };
     auto ambientCb = [&](double f, const std::string& m) { ambientProg.store (f); reportAggregate (m); };
 
-    auto mainFut = std::async (std::launch::async,
-        [&]{ return synthMainPath (p, mainCb); });
+    IRSynthResultT<Sample> res;
+    MicIRChannelsT<Sample> outrig, ambient, direct;
+    SynthProfile outrigProfile, ambientProfile, directProfile;
+    SynthTaskPool::TaskGroup paths (SynthTaskPool::shared(), cancel);
 
-    std::future<MicIRChannels> outrigFut, ambientFut, directFut;
+    paths.run ([&]{ res = synthMainPath<Sample> (p, mainCb, &cancel); });
 
     if (p.outrig_enabled)
-        outrigFut = std::async (std::launch::async,
-            [&]{ return synthExtraPath (p,
+        paths.run ([&]{ outrig = synthExtraPath<Sample> (p,
                                         p.outrig_lx, p.outrig_ly,
                                         p.outrig_rx, p.outrig_ry,
                                         p.outrig_height,
                                         p.outrig_langle, p.outrig_rangle,
                                         p.outrig_pattern,
-                                        /*seedBase*/ 52,
+                                        /*seedBase*/ kOutrigSeedBase,
                                         outrigCb,
-                                        p.outrig_ltilt, p.outrig_rtilt); });
+                                        p.outrig_ltilt, p.outrig_rtilt, &cancel, &outrigProfile); });
 
     if (p.ambient_enabled)
-        ambientFut = std::async (std::launch::async,
-            [&]{ return synthExtraPath (p,
+        paths.run ([&]{ ambient = synthExtraPath<Sample> (p,
                                         p.ambient_lx, p.ambient_ly,
                                         p.ambient_rx, p.ambient_ry,
                                         p.ambient_height,
                                         p.ambient_langle, p.ambient_rangle,
                                         p.ambient_pattern,
-                                        /*seedBase*/ 62,
+                                        /*seedBase*/ kAmbientSeedBase,
                                         ambientCb,
-                                        p.ambient_ltilt, p.ambient_rtilt); });
+                                        p.ambient_ltilt, p.ambient_rtilt, &cancel, &ambientProfile); });
 
     if (p.direct_enabled)
-        directFut = std::async (std::launch::async,
-            [&]{ return synthDirectPath (p); });
+        paths.run ([&]{ direct = synthDirectPath<Sample> (p, &directProfile); });
 
-    // Collect results — sequential to guarantee a deterministic assignment
+    // Collect results — each path wrote only its own slot; assign in a fixed
     // order for the returned IRSynthResult.
-    IRSynthResult res = mainFut.get();
-    if (outrigFut.valid())  res.outrig  = outrigFut.get();
-    if (ambientFut.valid()) res.ambient = ambientFut.get();
-    if (directFut.valid())  res.direct  = directFut.get();
+    paths.wait();
+    if (cancel.isCancelled())
+        return cancelledResult<Sample>();
+
+    if (p.outrig_enabled)  res.outrig  = std::move (outrig);
+    if (p.ambient_enabled) res.ambient = std::move (ambient);
+    if (p.direct_enabled)  res.direct  = std::move (direct);
+
+    for (auto* extra : { &outrigProfile, &ambientProfile, &directProfile })
+        for (auto& stage : extra->stages)
+            res.profile.stages.push_back (std::move (stage));
 
     if (res.success) applyOutputGain (res, p);
+    res.preview = p.preview;
+    res.profile.totalWallMs = elapsedMs();
 
     if (cb) cb (1.0, "Done.");
     return res;
 }
 
+template <typename Sample>
+IRSynthResultT<Sample> IRSynthEngine::synthPreviewIR (const IRSynthParams& p, IRSynthProgressFn cb,
+                                                      SynthTaskPool::CancellationToken cancel)
+{
+    IRSynthParams q = p;
+    q.preview = true;
+    return synthIR<Sample> (q, std::move (cb), std::move (cancel));
+}
+
 // ── synthMainPath — verbatim from JS (MAIN mic pair) ──────────────────────
-// This is the historical body of synthIR, unchanged. The feature/multi-mic-paths
+// This is the historical body of synthIR. The feature/multi-mic-paths
 // branch introduces sibling synthExtraPath / synthDirectPath helpers (C4) and a
-// parallel dispatcher in synthIR (C5). Bit-identity of MAIN output is locked by
-// IR_14 — do not rearrange floating-point expressions here.
-IRSynthResult IRSynthEngine::synthMainPath (const IRSynthParams& p, IRSynthProgressFn cb)
+// parallel dispatcher in synthIR (C5). The per-channel stages fan out onto
+// SynthTaskPool; each task computes exactly what the serial code did.
+// Bit-identity of MAIN output is locked by IR_14 — do not rearrange
+// floating-point expressions here.
+template <typename Sample>
+IRSynthResultT<Sample> IRSynthEngine::synthMainPath (const IRSynthParams& p, IRSynthProgressFn cb,
+                                                     Cancel cancel)
 {
-    IRSynthResult res;
+    using Buffer = std::vector<Sample>;
+    IRSynthResultT<Sample> res;
     res.sampleRate = p.sample_rate;
     int sr = p.sample_rate;
 
@@ -2356,6 +3148,8 @@ IRSynthResult IRSynthEngine::synthMainPath (const IRSynthParams& p, IRSynthProgr
     const double minDim    = std::min({ p.width, p.depth, He });
     const double maxRefDist = 1e9;  // no gate — all sources within mo are used
     int mo = std::min(60, std::max(3, (int)std::floor(rm * SPEED / minDim / 2.0)));
+    if (p.preview)
+        applyPreviewCaps (mo, irLen, sr);
 
     double ts = std::min(0.95, vs + p.organ_case * 0.35 + p.balconies * 0.25 + p.diffusion * 0.3);
     double oF = 1.0 - p.organ_case * 0.4;
@@ -2516,8 +3310,10 @@ IRSynthResult IRSynthEngine::synthMainPath (const IRSynthParams& p, IRSynthProgr
 
     // Polygon ISM dispatch (v2.8.0) — non-rectangular shapes use the 2D
     // polygon image-source generator. The "Rectangular" path is bit-identical
-    // to the pre-2.8.0 behaviour because it forwards directly to calcRefs.
-    auto refsDispatch = [&] (double rxL, double ryL, double rzL,
+    // to the pre-2.8.0 behaviour because it forwards directly to calcRefs,
+    // reading the speaker's image lattice (unused by the polygon path).
+    auto refsDispatch = [&] (StageProbe& probe, const ImageLattice& lattice,
+                             double rxL, double ryL, double rzL,
                              double sxL, double syL, double szL,
                              uint32_t seed,
                              const std::string& pat,
@@ -2525,10 +3321,21 @@ IRSynthResult IRSynthEngine::synthMainPath (const IRSynthParams& p, IRSynthProgr
                              double micTilt,
                              double spkTilt) -> std::vector<Ref>
     {
+        std::vector<Ref> refs;
         if (p.shape == "Rectangular")
-            return calcRefs        (rxL, ryL, rzL, sxL, syL, szL, p, He, mo, rF, rC, rW, oF, vHfA, ts, eo, ec, sr, seed, pat, spkAng, micAng, maxRefDist, jitterOrder01Ms, jitterOrder2PlusMs, micTilt, spkTilt);
+            refs = calcRefs        (rxL, ryL, rzL, lattice, p, eo, ec, sr, pat, spkAng, micAng, maxRefDist, micTilt, spkTilt, cancel);
         else
-            return calcRefsPolygon (rxL, ryL, rzL, sxL, syL, szL, p, He, mo, rF, rC, rW, oF, vHfA, ts, eo, ec, sr, seed, pat, spkAng, micAng, maxRefDist, jitterOrder01Ms, jitterOrder2PlusMs, micTilt, spkTilt);
+        {
+            size_t nodes = 0;
+            refs = calcRefsPolygon (rxL, ryL, rzL, sxL, syL, szL, p, He, mo, rF, rC, rW, oF, vHfA, ts, eo, ec, sr, seed, pat, spkAng, micAng, maxRefDist, jitterOrder01Ms, jitterOrder2PlusMs, micTilt, spkTilt, cancel, &nodes);
+            probe.addNodes (nodes);
+        }
+        probe.addItems (refs.size());
+        return refs;
+    };
+    auto latticeFor = [&] (double sxL, double syL, double szL, uint32_t seed)
+    {
+        return buildImageLattice (sxL, syL, szL, p, He, mo, rF, rC, rW, oF, vHfA, ts, sr, seed, jitterOrder01Ms, jitterOrder2PlusMs, cancel);
     };
 
     // Per-speaker salts (hash-keyed jitter scheme — see "Image-source-keyed
@@ -2543,33 +3350,6 @@ IRSynthResult IRSynthEngine::synthMainPath (const IRSynthParams& p, IRSynthProgr
     constexpr uint32_t kMainSaltL = 42u;
     constexpr uint32_t kMainSaltR = 43u;
 
-    std::vector<Ref> rLL = refsDispatch(rlx, rly, rz, slx, sly, sz, kMainSaltL, mainMicPattern, p.spkl_angle, faceL, tiltL, p.spkl_tilt);
-    // Mono mode: rRL is identical to rLL (same speaker drives both convolver
-    // input slots), so skip the redundant calcRefs call and copy. By
-    // linearity of convolution the existing 4-conv mixer then produces
-    //   outL = IR_LL ⊛ inL + IR_RL ⊛ inR = IR_LL ⊛ (inL + inR)
-    // which is exactly equivalent to mono-summing the input and feeding a
-    // single-speaker IR — eliminating inter-speaker comb filtering.
-    std::vector<Ref> rRL = p.mono_source ? rLL
-                                          : refsDispatch(rlx, rly, rz, srx, sry, sz, kMainSaltR, mainMicPattern, p.spkr_angle, faceL, tiltL, p.spkr_tilt);
-    std::vector<Ref> rLR = refsDispatch(rrx, rry, rz, slx, sly, sz, kMainSaltL, mainMicPattern, p.spkl_angle, faceR, tiltR, p.spkl_tilt);
-    std::vector<Ref> rRR = p.mono_source ? rLR
-                                          : refsDispatch(rrx, rry, rz, srx, sry, sz, kMainSaltR, mainMicPattern, p.spkr_angle, faceR, tiltR, p.spkr_tilt);
-
-    // Centre-mic rays (Decca only) share the MAIN per-speaker salts. The
-    // centre mic from L speaker uses kMainSaltL (same as L outer + R outer
-    // from L speaker), so all three mics see the same jitter realisation per
-    // image source.
-    std::vector<Ref> rLC, rRC;
-    if (p.main_decca_enabled)
-    {
-        rLC = refsDispatch(rcx, rcy, rz, slx, sly, sz, kMainSaltL, mainMicPattern, p.spkl_angle, faceC, tiltC, p.spkl_tilt);
-        rRC = p.mono_source ? rLC
-                            : refsDispatch(rcx, rcy, rz, srx, sry, sz, kMainSaltR, mainMicPattern, p.spkr_angle, faceC, tiltC, p.spkr_tilt);
-    }
-
-    report(0.30, "Rendering " + std::to_string(rLL.size() + rRL.size() + rLR.size() + rRR.size() + rLC.size() + rRC.size()) + " reflections…");
-
     double diff = p.diffusion;
     // When "early reflections only" is on we normally use no diffusion (sharp ER).
     // If speakers are close, moderate diffusion helps break the periodic delay (jitter alone often isn't enough).
@@ -2581,10 +3361,218 @@ IRSynthResult IRSynthEngine::synthMainPath (const IRSynthParams& p, IRSynthProgr
     // is perceptible but does not diffuse the high-frequency reverb into a noise floor.
     // At default settings (ts≈0.74), freqScatterMs ≈ 0.37 ms → ±18 samples at 4 kHz.
     const double freqScatterMs = ts * 0.5;  // Feature C — frequency-dependent scatter (0 = off)
-    std::vector<double> eLL = renderCh(rLL, irLen, den, sr, earlyDiff, reflectionSpreadMs, freqScatterMs);
-    std::vector<double> eRL = renderCh(rRL, irLen, den, sr, earlyDiff, reflectionSpreadMs, freqScatterMs);
-    std::vector<double> eLR = renderCh(rLR, irLen, den, sr, earlyDiff, reflectionSpreadMs, freqScatterMs);
-    std::vector<double> eRR = renderCh(rRR, irLen, den, sr, earlyDiff, reflectionSpreadMs, freqScatterMs);
+
+    // Stage-cache keys (SynthStageCache). refsKey covers every input of one
+    // calcRefs call; a band render is stored under that key plus the render
+    // settings and the sample type (float and double results never share a
+    // key, so every later key differs too). The path key adds what the FDN,
+    // the mix, the modal bank and the output filters read; the FDN seed
+    // window (ecFdn, fdnMaxRefCut) follows from the positions already in the
+    // image-source keys.
+    auto refsKey = [&] (double rxL, double ryL, double rzL,
+                        double sxL, double syL, double szL,
+                        uint32_t seed,
+                        const std::string& pat,
+                        double spkAng, double micAng,
+                        double micTilt,
+                        double spkTilt)
+    {
+        StageKey k ("refs");
+        addRefsInputs (k, p);
+        k.add (rxL).add (ryL).add (rzL).add (sxL).add (syL).add (szL)
+         .add (He).add (mo).add (rF).add (rC).add (rW).add (oF).add (vHfA).add (ts)
+         .add (eo).add (ec).add (sr).add (seed).add (pat).add (spkAng).add (micAng)
+         .add (maxRefDist).add (jitterOrder01Ms).add (jitterOrder2PlusMs).add (micTilt).add (spkTilt);
+        return k.get();
+    };
+    auto renderKey = [&] (SynthStageCache::Key refs)
+    {
+        return StageKey ("render").add (refs).add (irLen).add (den).add (sr).add (earlyDiff)
+                                  .add (reflectionSpreadMs).add (freqScatterMs)
+                                  .add ((int) sizeof (Sample)).get();
+    };
+
+    const auto kRefsLL = refsKey (rlx, rly, rz, slx, sly, sz, kMainSaltL, mainMicPattern, p.spkl_angle, faceL, tiltL, p.spkl_tilt);
+    const auto kRefsLR = refsKey (rrx, rry, rz, slx, sly, sz, kMainSaltL, mainMicPattern, p.spkl_angle, faceR, tiltR, p.spkl_tilt);
+    const auto kRefsRL = p.mono_source ? kRefsLL : refsKey (rlx, rly, rz, srx, sry, sz, kMainSaltR, mainMicPattern, p.spkr_angle, faceL, tiltL, p.spkr_tilt);
+    const auto kRefsRR = p.mono_source ? kRefsLR : refsKey (rrx, rry, rz, srx, sry, sz, kMainSaltR, mainMicPattern, p.spkr_angle, faceR, tiltR, p.spkr_tilt);
+    SynthStageCache::Key kRefsLC = 0, kRefsRC = 0;
+    if (p.main_decca_enabled)
+    {
+        kRefsLC = refsKey (rcx, rcy, rz, slx, sly, sz, kMainSaltL, mainMicPattern, p.spkl_angle, faceC, tiltC, p.spkl_tilt);
+        kRefsRC = p.mono_source ? kRefsLC : refsKey (rcx, rcy, rz, srx, sry, sz, kMainSaltR, mainMicPattern, p.spkr_angle, faceC, tiltC, p.spkr_tilt);
+    }
+    const auto kLL = renderKey (kRefsLL), kRL = renderKey (kRefsRL);
+    const auto kLR = renderKey (kRefsLR), kRR = renderKey (kRefsRR);
+    const auto kLC = renderKey (kRefsLC), kRC = renderKey (kRefsRC);
+
+    StageKey pathKeyBuilder ("mainPath");
+    addShapeInputs (pathKeyBuilder, p);
+    pathKeyBuilder.add (kLL).add (kRL).add (kLR).add (kRR).add (p.main_decca_enabled)
+                  .add (eo).add (coincident).add (diff).add (rt).add (irLen).add (ec).add (sr).add (He)
+                  .add (bakedErGain).add (bakedTailGain).add (p.modal_tangential_oblique)
+                  .add (p.fdn_vectorised);
+    if (p.main_decca_enabled)
+        pathKeyBuilder.add (kLC).add (kRC).add (p.decca_centre_gain);
+    const auto pathKey = pathKeyBuilder.get();
+
+    auto& cache = SynthStageCache::shared();
+    if (auto cached = cache.find<MicIRChannelsT<Sample>> (pathKey))
+    {
+        StageProbe cachedProbe (&res.profile, "main", "cached", StageProbe::onThisThread);
+        cachedProbe.addCacheHit();
+        cachedProbe.setBytes (cacheBytes (*cached));
+        res.iLL = cached->LL;
+        res.iRL = cached->RL;
+        res.iLR = cached->LR;
+        res.iRR = cached->RR;
+        res.rt60 = rt;
+        res.irLen = irLen;
+        res.success = true;
+        cachedProbe.finish();
+        report(1.0, "Done.");
+        return res;
+    }
+
+    // The per-channel stages below (image sources, band render, FDN, modal
+    // bank, output filters) run on SynthTaskPool: one TaskGroup per stage,
+    // each channel a task that writes only its own buffer, and wait() before
+    // the next stage reads them — so the result is bit-identical to running
+    // them in sequence. The lazily-built static maps are warmed first; their
+    // initialisation is not thread-safe (see synthIR). Every stage group
+    // shares synthIR's cancellation token, and each wait() is followed by a
+    // checkpoint, since a cancelled stage leaves its buffers partial / empty.
+    (void) getMats();
+    (void) getMIC();
+    const auto stageToken = cancel != nullptr ? *cancel : SynthTaskPool::CancellationToken();
+
+    // A channel whose band render is cached needs no image sources; its
+    // list stays empty. The lists themselves are not cached: they are ~10×
+    // the size of the render they feed and nothing else reads them.
+    using RenderPtr = std::shared_ptr<const Buffer>;
+    std::vector<Ref> rLL, rRL, rLR, rRR, rLC, rRC;
+    RenderPtr pLL = cache.find<Buffer> (kLL), pLR = cache.find<Buffer> (kLR);
+    RenderPtr pRL, pRR, pLC, pRC;
+    if (! p.mono_source)
+    {
+        pRL = cache.find<Buffer> (kRL);
+        pRR = cache.find<Buffer> (kRR);
+    }
+    if (p.main_decca_enabled)
+    {
+        pLC = cache.find<Buffer> (kLC);
+        if (! p.mono_source)
+            pRC = cache.find<Buffer> (kRC);
+    }
+    {
+        // Rectangular rooms: each speaker's image lattice is built once, by
+        // its own task, and read by every mic of that speaker below.
+        ImageLattice latticeL, latticeR;
+        if (p.shape == "Rectangular")
+        {
+            const bool needL = pLL == nullptr || pLR == nullptr || (p.main_decca_enabled && pLC == nullptr);
+            const bool needR = ! p.mono_source
+                            && (pRL == nullptr || pRR == nullptr || (p.main_decca_enabled && pRC == nullptr));
+            StageProbe latticeProbe (&res.profile, "main", "lattice");
+            SynthTaskPool::TaskGroup latticeStage (SynthTaskPool::shared(), stageToken);
+            if (needL)
+                latticeStage.run (latticeProbe.task ([&] { latticeL = latticeFor (slx, sly, sz, kMainSaltL); }));
+            if (needR)
+                latticeStage.run (latticeProbe.task ([&] { latticeR = latticeFor (srx, sry, sz, kMainSaltR); }));
+            latticeStage.wait();
+            if (isCancelled (cancel))
+                return cancelledResult<Sample>();
+            const size_t side = (size_t) (2 * mo + 1);
+            latticeProbe.addItems ((needL ? side * side * side : 0) + (needR ? side * side * side : 0));
+            latticeProbe.setBytes (latticeL.bytes() + latticeR.bytes());
+            latticeProbe.finish();
+        }
+
+        StageProbe refsProbe (&res.profile, "main", "refs");
+        SynthTaskPool::TaskGroup refsStage (SynthTaskPool::shared(), stageToken);
+        if (pLL == nullptr) refsStage.run (refsProbe.task ([&] { rLL = refsDispatch(refsProbe, latticeL, rlx, rly, rz, slx, sly, sz, kMainSaltL, mainMicPattern, p.spkl_angle, faceL, tiltL, p.spkl_tilt); }));
+        if (pLR == nullptr) refsStage.run (refsProbe.task ([&] { rLR = refsDispatch(refsProbe, latticeL, rrx, rry, rz, slx, sly, sz, kMainSaltL, mainMicPattern, p.spkl_angle, faceR, tiltR, p.spkl_tilt); }));
+        if (! p.mono_source)
+        {
+            if (pRL == nullptr) refsStage.run (refsProbe.task ([&] { rRL = refsDispatch(refsProbe, latticeR, rlx, rly, rz, srx, sry, sz, kMainSaltR, mainMicPattern, p.spkr_angle, faceL, tiltL, p.spkr_tilt); }));
+            if (pRR == nullptr) refsStage.run (refsProbe.task ([&] { rRR = refsDispatch(refsProbe, latticeR, rrx, rry, rz, srx, sry, sz, kMainSaltR, mainMicPattern, p.spkr_angle, faceR, tiltR, p.spkr_tilt); }));
+        }
+
+        // Centre-mic rays (Decca only) share the MAIN per-speaker salts. The
+        // centre mic from L speaker uses kMainSaltL (same as L outer + R outer
+        // from L speaker), so all three mics see the same jitter realisation per
+        // image source — and read the same lattice.
+        if (p.main_decca_enabled)
+        {
+            if (pLC == nullptr) refsStage.run (refsProbe.task ([&] { rLC = refsDispatch(refsProbe, latticeL, rcx, rcy, rz, slx, sly, sz, kMainSaltL, mainMicPattern, p.spkl_angle, faceC, tiltC, p.spkl_tilt); }));
+            if (! p.mono_source && pRC == nullptr)
+                refsStage.run (refsProbe.task ([&] { rRC = refsDispatch(refsProbe, latticeR, rcx, rcy, rz, srx, sry, sz, kMainSaltR, mainMicPattern, p.spkr_angle, faceC, tiltC, p.spkr_tilt); }));
+        }
+        refsStage.wait();
+        if (isCancelled (cancel))
+            return cancelledResult<Sample>();
+        for (const auto* render : { &pLL, &pLR, &pRL, &pRR, &pLC, &pRC })
+            if (*render != nullptr)
+                refsProbe.addCacheHit();
+        size_t refsBytes = 0;
+        for (const auto* refs : { &rLL, &rLR, &rRL, &rRR, &rLC, &rRC })
+            refsBytes += refs->capacity() * sizeof (Ref);
+        refsProbe.setBytes (refsBytes);
+        refsProbe.finish();
+    }
+
+    // Mono mode: rRL is identical to rLL (same speaker drives both convolver
+    // input slots), so skip the redundant calcRefs call and copy. By
+    // linearity of convolution the existing 4-conv mixer then produces
+    //   outL = IR_LL ⊛ inL + IR_RL ⊛ inR = IR_LL ⊛ (inL + inR)
+    // which is exactly equivalent to mono-summing the input and feeding a
+    // single-speaker IR — eliminating inter-speaker comb filtering.
+    if (p.mono_source)
+    {
+        rRL = rLL;  pRL = pLL;
+        rRR = rLR;  pRR = pLR;
+        rRC = rLC;  pRC = pLC;
+    }
+
+    report(0.30, "Rendering " + std::to_string(rLL.size() + rRL.size() + rLR.size() + rRR.size() + rLC.size() + rRC.size()) + " reflections…");
+
+    StageProbe renderProbe (&res.profile, "main", "render");
+    auto render = [&] (SynthStageCache::Key kRender, const std::vector<Ref>& refs, RenderPtr& dst)
+    {
+        if (dst != nullptr)
+        {
+            renderProbe.addCacheHit();
+            return;
+        }
+        renderProbe.addItems (refs.size());
+        dst = cachedStage (kRender, cancel, [&] { return renderCh<Sample>(refs, irLen, den, sr, earlyDiff, reflectionSpreadMs, freqScatterMs, cancel); });
+    };
+    {
+        SynthTaskPool::TaskGroup renderStage (SynthTaskPool::shared(), stageToken);
+        renderStage.run (renderProbe.task ([&] { render (kLL, rLL, pLL); }));
+        renderStage.run (renderProbe.task ([&] { render (kRL, rRL, pRL); }));
+        renderStage.run (renderProbe.task ([&] { render (kLR, rLR, pLR); }));
+        renderStage.run (renderProbe.task ([&] { render (kRR, rRR, pRR); }));
+        if (p.main_decca_enabled)
+        {
+            renderStage.run (renderProbe.task ([&] { render (kLC, rLC, pLC); }));
+            renderStage.run (renderProbe.task ([&] { render (kRC, rRC, pRC); }));
+        }
+        renderStage.wait();
+        if (isCancelled (cancel))
+            return cancelledResult<Sample>();
+        renderProbe.setBytes ((size_t) irLen * sizeof (Sample) * (p.main_decca_enabled ? 6 : 4));
+        renderProbe.finish();
+    }
+    const int numRenders = p.main_decca_enabled ? 6 : 4;
+    // Working copies: the Decca combine below adds into them.
+    StageProbe seedProbe (&res.profile, "main", "seed", StageProbe::onThisThread);
+    Buffer eLL = *pLL, eRL = *pRL, eLR = *pLR, eRR = *pRR, eLC, eRC;
+    if (p.main_decca_enabled)
+    {
+        eLC = *pLC;
+        eRC = *pRC;
+    }
 
     // ── Decca Tree combine (additive) ────────────────────────────────────────
     // H_L_out = H_L_mic + gC·H_C_mic   (speaker L → centre mic contributes to L-out too)
@@ -2597,17 +3585,14 @@ IRSynthResult IRSynthEngine::synthMainPath (const IRSynthParams& p, IRSynthProgr
     // (see Docs/deep-research-report.md §"Centre channel HPF").
     if (p.main_decca_enabled)
     {
-        std::vector<double> eLC = renderCh(rLC, irLen, den, sr, earlyDiff, reflectionSpreadMs, freqScatterMs);
-        std::vector<double> eRC = renderCh(rRC, irLen, den, sr, earlyDiff, reflectionSpreadMs, freqScatterMs);
-
         // 1-pole HPF on the centre-mic contributions only.
         // y[n] = α·(y[n-1] + x[n] - x[n-1]),  α = exp(-2π·fc/sr).
-        auto hp1pole = [sr](std::vector<double>& v, double fcHz)
+        auto hp1pole = [sr](Buffer& v, double fcHz)
         {
             if (v.empty()) return;
             const double a = std::exp(-2.0 * M_PI * fcHz / (double)sr);
             double xPrev = 0.0, yPrev = 0.0;
-            for (double& s : v)
+            for (Sample& s : v)
             {
                 double x = s;
                 double y = a * (yPrev + x - xPrev);
@@ -2636,11 +3621,12 @@ IRSynthResult IRSynthEngine::synthMainPath (const IRSynthParams& p, IRSynthProgr
 
     report(0.60, "Synthesising FDN reverb tail…");
 
-    std::vector<double> iLL, iRL, iLR, iRR;
+    Buffer iLL, iRL, iLR, iRR;
+    seedProbe.addItems ((size_t) irLen);
     if (!eo)
     {
         // Paired paths share FDN tail 50/50: LL+RL → left mic tail, LR+RR → right mic tail
-        std::vector<double> eL(irLen), eR(irLen);
+        Buffer eL(irLen), eR(irLen);
         for (int i = 0; i < irLen; ++i)
         {
             eL[(size_t)i] = eLL[(size_t)i] + eRL[(size_t)i];
@@ -2698,6 +3684,8 @@ IRSynthResult IRSynthEngine::synthMainPath (const IRSynthParams& p, IRSynthProgr
                 eR[(size_t)i] = dR.process(eR[(size_t)i]);
             }
         }
+        seedProbe.setBytes ((size_t) irLen * sizeof (Sample) * (size_t) (numRenders + 2));
+        seedProbe.finish();
 
         // Start FDN seeding at the first reflection arrival (t_first), not at
         // sample 0.  Before t_first the eL/eR signals are silent — seeding silence
@@ -2762,9 +3750,45 @@ IRSynthResult IRSynthEngine::synthMainPath (const IRSynthParams& p, IRSynthProgr
         const int fdnMaxRefCut = std::min(irLen,
             (int)std::ceil((ecFdn + fdnMaxMs * sr / 1000.0) * 1.1));
 
-        std::vector<double> tL = renderFDNTail(rt, irLen, ecFdn, eL, diff, sr, 100, p.width, p.depth, He, fdnMaxRefCut, &p);
-        std::vector<double> tR = renderFDNTail(rt, irLen, ecFdn, eR, diff, sr, 101, p.width, p.depth, He, fdnMaxRefCut, &p);
+        // Each tail is keyed by the renders that seed it: the left tail
+        // survives a move of the right mic.
+        auto fdnKey = [&] (SynthStageCache::Key a, SynthStageCache::Key b, uint32_t seed)
+        {
+            StageKey k ("fdn");
+            addShapeInputs (k, p);
+            k.add (a).add (b).add (p.main_decca_enabled).add (coincident).add (rt).add (irLen)
+             .add (ecFdn).add (diff).add (sr).add (seed).add (He).add (fdnMaxRefCut)
+             .add (p.fdn_vectorised);
+            if (p.main_decca_enabled)
+                k.add (kLC).add (kRC).add (p.decca_centre_gain);
+            return k.get();
+        };
+        RenderPtr tLp, tRp;
+        {
+            StageProbe fdnProbe (&res.profile, "main", "fdn");
+            bool computedL = false, computedR = false;
+            auto tail = [&] (const Buffer& seedBuf, uint32_t seed, bool& computed)
+            {
+                computed = true;
+                fdnProbe.addItems ((size_t) irLen);
+                return renderFDNTail(rt, irLen, ecFdn, seedBuf, diff, sr, seed, p.width, p.depth, He, fdnMaxRefCut, &p, cancel);
+            };
+            SynthTaskPool::TaskGroup fdnStage (SynthTaskPool::shared(), stageToken);
+            fdnStage.run (fdnProbe.task ([&] { tLp = cachedStage (fdnKey (kLL, kRL, 100), cancel, [&] { return tail (eL, 100, computedL); }); }));
+            fdnStage.run (fdnProbe.task ([&] { tRp = cachedStage (fdnKey (kLR, kRR, 101), cancel, [&] { return tail (eR, 101, computedR); }); }));
+            fdnStage.wait();
+            if (isCancelled (cancel))
+                return cancelledResult<Sample>();
+            for (bool computed : { computedL, computedR })
+                if (! computed)
+                    fdnProbe.addCacheHit();
+            fdnProbe.setBytes ((size_t) irLen * sizeof (Sample) * 2);
+            fdnProbe.finish();
+        }
+        const Buffer& tL = *tLp;
+        const Buffer& tR = *tRp;
 
+        StageProbe mixProbe (&res.profile, "main", "mix", StageProbe::onThisThread);
         iLL.resize((size_t)irLen);
         iRL.resize((size_t)irLen);
         iLR.resize((size_t)irLen);
@@ -2802,7 +3826,7 @@ IRSynthResult IRSynthEngine::synthMainPath (const IRSynthParams& p, IRSynthProgr
         const double kMinGain = 1.0 / kMaxGain; // floor: −24/−30 dB — allows tail attenuation to match ER at distance
         const double kMinRms  = 1e-7;           // silence guard
 
-        auto wRMS = [&](const std::vector<double>& v, int a, int b) -> double {
+        auto wRMS = [&](const Buffer& v, int a, int b) -> double {
             a = std::max(a, 0); b = std::min(b, irLen);
             if (b <= a) return 0.0;
             double s = 0.0;
@@ -2883,9 +3907,16 @@ IRSynthResult IRSynthEngine::synthMainPath (const IRSynthParams& p, IRSynthProgr
             iLR[(size_t)i] = eLR[(size_t)i] * bakedErGain * ef + tailR;
             iRR[(size_t)i] = eRR[(size_t)i] * bakedErGain * ef + tailR;
         }
+        mixProbe.addItems ((size_t) irLen);
+        mixProbe.setBytes ((size_t) irLen * sizeof (Sample) * 4);
+        mixProbe.finish();
     }
     else
     {
+        seedProbe.setBytes ((size_t) irLen * sizeof (Sample) * (size_t) numRenders);
+        seedProbe.finish();
+
+        StageProbe mixProbe (&res.profile, "main", "mix", StageProbe::onThisThread);
         iLL.resize((size_t)irLen);
         iRL.resize((size_t)irLen);
         iLR.resize((size_t)irLen);
@@ -2907,13 +3938,18 @@ IRSynthResult IRSynthEngine::synthMainPath (const IRSynthParams& p, IRSynthProgr
             iLR[(size_t)i] = eLR[(size_t)i] * bakedErGain * erFade;
             iRR[(size_t)i] = eRR[(size_t)i] * bakedErGain * erFade;
         }
+        mixProbe.addItems ((size_t) irLen);
+        mixProbe.setBytes ((size_t) irLen * sizeof (Sample) * 4);
+        mixProbe.finish();
     }
 
-    // Feature B — modal resonance boost (axial room modes 10–250 Hz).
+    // Feature B — modal resonance boost (room modes 10–250 Hz; axial unless
+    // p.modal_tangential_oblique). One fused pass over all four channels.
     // For polygon shapes the v2.9.0 equivalent-box branch (WI-5) uses the
     // polygon's horizontal area to derive (Wₑ, Dₑ) so the bank runs on an
     // area-preserving box approximation — see applyModalBank header comment.
     {
+        StageProbe modalProbe (&res.profile, "main", "modal", StageProbe::onThisThread);
         const double modalGain = 0.18;
         double polyArea = 0.0;
         if (p.shape != "Rectangular")
@@ -2922,49 +3958,77 @@ IRSynthResult IRSynthEngine::synthMainPath (const IRSynthParams& p, IRSynthProgr
             const auto wallsForArea = makeWalls2D (p, p.width, p.depth, zeroR);
             polyArea = polygonArea (wallsForArea);
         }
-        iLL = applyModalBank(iLL, p.width, p.depth, He, rt[0], modalGain, sr, p.shape, polyArea);
-        iRL = applyModalBank(iRL, p.width, p.depth, He, rt[0], modalGain, sr, p.shape, polyArea);
-        iLR = applyModalBank(iLR, p.width, p.depth, He, rt[0], modalGain, sr, p.shape, polyArea);
-        iRR = applyModalBank(iRR, p.width, p.depth, He, rt[0], modalGain, sr, p.shape, polyArea);
+        applyModalBank (iLL, iRL, iLR, iRR, p.width, p.depth, He, rt[0], modalGain, sr,
+                        p.shape, polyArea, p.modal_tangential_oblique);
+        if (isCancelled (cancel))
+            return cancelledResult<Sample>();
+        modalProbe.addItems ((size_t) irLen);
+        modalProbe.setBytes ((size_t) irLen * sizeof (Sample) * 4);
+        modalProbe.finish();
     }
 
     report(0.85, "Finishing…");
 
-    iLL = hpF(lpF(iLL, 18000.0, sr), 20.0, sr);
-    iRL = hpF(lpF(iRL, 18000.0, sr), 20.0, sr);
-    iLR = hpF(lpF(iLR, 18000.0, sr), 20.0, sr);
-    iRR = hpF(lpF(iRR, 18000.0, sr), 20.0, sr);
-
-    // Cosine fade-out over the last 500 ms so the tail eases to silence
-    // without a noticeable abrupt end (longer fade = smoother transition).
+    // Output: band-limit filters (one pool task per channel), end fade, trim
+    // and the path-cache insert. lpF / hpF each return a new buffer, so a
+    // channel peaks at three copies.
+    StageProbe outputProbe (&res.profile, "main", "output");
     {
-        const int endFade = (int)std::round(0.500 * sr);
-        const int fadeStart = std::max(0, irLen - endFade);
+        SynthTaskPool::TaskGroup filterStage (SynthTaskPool::shared(), stageToken);
         for (auto* v : { &iLL, &iRL, &iLR, &iRR })
-            for (int i = fadeStart; i < irLen; ++i)
-            {
-                double t = (double)(i - fadeStart) / (double)endFade;
-                (*v)[(size_t)i] *= 0.5 * (1.0 + std::cos(M_PI * t));
-            }
+            filterStage.run (outputProbe.task ([&, v] { *v = hpF(lpF(*v, 18000.0, sr), 20.0, sr); }));
+        filterStage.wait();
+        if (isCancelled (cancel))
+            return cancelledResult<Sample>();
     }
+    outputProbe.measure ([&]
+    {
+        // Cosine fade-out over the last 500 ms so the tail eases to silence
+        // without a noticeable abrupt end (longer fade = smoother transition).
+        {
+            const int endFade = (int)std::round(0.500 * sr);
+            const int fadeStart = std::max(0, irLen - endFade);
+            for (auto* v : { &iLL, &iRL, &iLR, &iRR })
+                for (int i = fadeStart; i < irLen; ++i)
+                {
+                    double t = (double)(i - fadeStart) / (double)endFade;
+                    (*v)[(size_t)i] *= 0.5 * (1.0 + std::cos(M_PI * t));
+                }
+        }
 
-    // Peak normalisation intentionally removed.
-    // IR amplitude now scales naturally with speaker-to-mic distance (1/r law),
-    // preserving the proximity effect: speakers placed close to mics produce a
-    // louder wet signal; speakers placed far away produce a quieter one.
-    // Clipping only occurs below ~85 cm (cardioid default), which is an
-    // implausible placement in any real room.  The host wet-level control
-    // gives the user full range to compensate for overall level.
+        // Peak normalisation intentionally removed.
+        // IR amplitude now scales naturally with speaker-to-mic distance (1/r law),
+        // preserving the proximity effect: speakers placed close to mics produce a
+        // louder wet signal; speakers placed far away produce a quieter one.
+        // Clipping only occurs below ~85 cm (cardioid default), which is an
+        // implausible placement in any real room.  The host wet-level control
+        // gives the user full range to compensate for overall level.
+
+        // Output level trim: +15 dB applied to all four channels at the very end,
+        // after all processing is complete.  This corrects for the observed level
+        // shortfall without touching any of the synthesis calculations.
+        {
+            const double gain15dB = std::pow(10.0, 15.0 / 20.0); // ≈ 5.6234
+            for (auto* v : { &iLL, &iRL, &iLR, &iRR })
+                for (Sample& s : *v)
+                    s *= gain15dB;
+        }
 
-    // Output level trim: +15 dB applied to all four channels at the very end,
-    // after all processing is complete.  This corrects for the observed level
-    // shortfall without touching any of the synthesis calculations.
-    {
-        const double gain15dB = std::pow(10.0, 15.0 / 20.0); // ≈ 5.6234
-        for (auto* v : { &iLL, &iRL, &iLR, &iRR })
-            for (double& s : *v)
-                s *= gain15dB;
-    }
+        if (cache.isEnabled())
+        {
+            auto entry = std::make_shared<MicIRChannelsT<Sample>>();
+            entry->LL = iLL;
+            entry->RL = iRL;
+            entry->LR = iLR;
+            entry->RR = iRR;
+            entry->irLen = irLen;
+            entry->synthesised = true;
+            cache.insert<MicIRChannelsT<Sample>> (pathKey, entry, cacheBytes (*entry));
+        }
+    });
+    outputProbe.addItems ((size_t) irLen);
+    outputProbe.setBytes ((size_t) irLen * sizeof (Sample) * 12);
+    outputProbe.finish();
 
     res.iLL = std::move(iLL);
     res.iRL = std::move(iRL);
@@ -2983,18 +4047,22 @@ IRSynthResult IRSynthEngine::synthMainPath (const IRSynthParams& p, IRSynthProgr
 // angles, seed base). Kept as an explicit duplicate so the MAIN body is frozen
 // for IR_14 bit-identity — do not factor out the shared body until a future
 // commit updates the golden digests.
-MicIRChannels IRSynthEngine::synthExtraPath (const IRSynthParams& p,
-                                             double rlxNorm, double rlyNorm,
-                                             double rrxNorm, double rryNorm,
-                                             double rzMetres,
-                                             double langle, double rangle,
-                                             const std::string& pattern,
-                                             uint32_t seedBase,
-                                             IRSynthProgressFn cb,
-                                             double ltilt,
-                                             double rtilt)
+template <typename Sample>
+MicIRChannelsT<Sample> IRSynthEngine::synthExtraPath (const IRSynthParams& p,
+                                                      double rlxNorm, double rlyNorm,
+                                                      double rrxNorm, double rryNorm,
+                                                      double rzMetres,
+                                                      double langle, double rangle,
+                                                      const std::string& pattern,
+                                                      uint32_t seedBase,
+                                                      IRSynthProgressFn cb,
+                                                      double ltilt,
+                                                      double rtilt,
+                                                      Cancel cancel,
+                                                      SynthProfile* profile)
 {
-    MicIRChannels out;
+    using Buffer = std::vector<Sample>;
+    MicIRChannelsT<Sample> out;
     int sr = p.sample_rate;
 
     auto report = [&](double frac, const std::string& msg) { if (cb) cb(frac, msg); };
@@ -3019,6 +4087,8 @@ MicIRChannels IRSynthEngine::synthExtraPath (const IRSynthParams& p,
     const double minDim    = std::min({ p.width, p.depth, He });
     const double maxRefDist = 1e9;
     int mo = std::min(60, std::max(3, (int)std::floor(rm * SPEED / minDim / 2.0)));
+    if (p.preview)
+        applyPreviewCaps (mo, irLen, sr);
 
     double ts = std::min(0.95, vs + p.organ_case * 0.35 + p.balconies * 0.25 + p.diffusion * 0.3);
     double oF = 1.0 - p.organ_case * 0.4;
@@ -3080,17 +4150,36 @@ MicIRChannels IRSynthEngine::synthExtraPath (const IRSynthParams& p,
     const double reflectionSpreadMs = 0.0;
 
     // Polygon ISM dispatch (v2.8.0) — see synthMainPath for rationale.
-    auto refsDispatch = [&] (double rxL, double ryL, double rzL,
+    // Rectangular rooms build each speaker's image lattice on first use; the
+    // speaker's second mic reads the same one.
+    ImageLattice latticeL, latticeR;
+    const char* pathName = seedBase == kOutrigSeedBase ? "outrig" : "ambient";
+    auto refsDispatch = [&] (StageProbe& probe, ImageLattice& lattice,
+                             double rxL, double ryL, double rzL,
                              double sxL, double syL, double szL,
                              uint32_t seed,
                              double spkAng, double micAng,
                              double micTilt,
                              double spkTilt) -> std::vector<Ref>
     {
+        std::vector<Ref> refs;
         if (p.shape == "Rectangular")
-            return calcRefs        (rxL, ryL, rzL, sxL, syL, szL, p, He, mo, rF, rC, rW, oF, vHfA, ts, eo, ec, sr, seed, pattern, spkAng, micAng, maxRefDist, jitterOrder01Ms, jitterOrder2PlusMs, micTilt, spkTilt);
+        {
+            if (lattice.mo < 0)
+            {
+                lattice = buildImageLattice (sxL, syL, szL, p, He, mo, rF, rC, rW, oF, vHfA, ts, sr, seed, jitterOrder01Ms, jitterOrder2PlusMs, cancel);
+                probe.setBytes (lattice.bytes());
+            }
+            refs = calcRefs        (rxL, ryL, rzL, lattice, p, eo, ec, sr, pattern, spkAng, micAng, maxRefDist, micTilt, spkTilt, cancel);
+        }
         else
-            return calcRefsPolygon (rxL, ryL, rzL, sxL, syL, szL, p, He, mo, rF, rC, rW, oF, vHfA, ts, eo, ec, sr, seed, pattern, spkAng, micAng, maxRefDist, jitterOrder01Ms, jitterOrder2PlusMs, micTilt, spkTilt);
+        {
+            size_t nodes = 0;
+            refs = calcRefsPolygon (rxL, ryL, rzL, sxL, syL, szL, p, He, mo, rF, rC, rW, oF, vHfA, ts, eo, ec, sr, seed, pattern, spkAng, micAng, maxRefDist, jitterOrder01Ms, jitterOrder2PlusMs, micTilt, spkTilt, cancel, &nodes);
+            probe.addNodes (nodes);
+        }
+        probe.addItems (refs.size());
+        return refs;
     };
 
     // Per-speaker salts (hash-keyed jitter scheme; see calcRT60 comment block).
@@ -3098,33 +4187,135 @@ MicIRChannels IRSynthEngine::synthExtraPath (const IRSynthParams& p,
     const uint32_t saltL = seedBase + 0;
     const uint32_t saltR = seedBase + 1;
 
-    std::vector<Ref> rLL = refsDispatch(rlx, rly, rz, slx, sly, sz, saltL, p.spkl_angle, langle, ltilt, p.spkl_tilt);
-    // Mono mode: rRL := rLL and rRR := rLR — see synthMainPath for the
-    // full rationale (linearity of convolution gives outL = IR_LL ⊛ (inL+inR)).
-    std::vector<Ref> rRL = p.mono_source ? rLL
-                                          : refsDispatch(rlx, rly, rz, srx, sry, sz, saltR, p.spkr_angle, langle, ltilt, p.spkr_tilt);
-    std::vector<Ref> rLR = refsDispatch(rrx, rry, rz, slx, sly, sz, saltL, p.spkl_angle, rangle, rtilt, p.spkl_tilt);
-    std::vector<Ref> rRR = p.mono_source ? rLR
-                                          : refsDispatch(rrx, rry, rz, srx, sry, sz, saltR, p.spkr_angle, rangle, rtilt, p.spkr_tilt);
-
-    report(0.30, "Rendering " + std::to_string(rLL.size() + rRL.size() + rLR.size() + rRR.size()) + " reflections…");
-
     double diff = p.diffusion;
     double earlyDiff = eo ? 0.0 : diff;
     if (eo && close)
         earlyDiff = 0.50;
     const double freqScatterMs = ts * 0.5;
-    std::vector<double> eLL = renderCh(rLL, irLen, den, sr, earlyDiff, reflectionSpreadMs, freqScatterMs);
-    std::vector<double> eRL = renderCh(rRL, irLen, den, sr, earlyDiff, reflectionSpreadMs, freqScatterMs);
-    std::vector<double> eLR = renderCh(rLR, irLen, den, sr, earlyDiff, reflectionSpreadMs, freqScatterMs);
-    std::vector<double> eRR = renderCh(rRR, irLen, den, sr, earlyDiff, reflectionSpreadMs, freqScatterMs);
+
+    // Stage-cache keys — same scheme as synthMainPath. The path key carries
+    // seedBase, so OUTRIG and AMBIENT never share an entry.
+    auto refsKey = [&] (double rxL, double ryL, double rzL,
+                        double sxL, double syL, double szL,
+                        uint32_t seed,
+                        double spkAng, double micAng,
+                        double micTilt,
+                        double spkTilt)
+    {
+        StageKey k ("refs");
+        addRefsInputs (k, p);
+        k.add (rxL).add (ryL).add (rzL).add (sxL).add (syL).add (szL)
+         .add (He).add (mo).add (rF).add (rC).add (rW).add (oF).add (vHfA).add (ts)
+         .add (eo).add (ec).add (sr).add (seed).add (pattern).add (spkAng).add (micAng)
+         .add (maxRefDist).add (jitterOrder01Ms).add (jitterOrder2PlusMs).add (micTilt).add (spkTilt);
+        return k.get();
+    };
+    auto renderKey = [&] (SynthStageCache::Key refs)
+    {
+        return StageKey ("render").add (refs).add (irLen).add (den).add (sr).add (earlyDiff)
+                                  .add (reflectionSpreadMs).add (freqScatterMs)
+                                  .add ((int) sizeof (Sample)).get();
+    };
+
+    const auto kRefsLL = refsKey (rlx, rly, rz, slx, sly, sz, saltL, p.spkl_angle, langle, ltilt, p.spkl_tilt);
+    const auto kRefsLR = refsKey (rrx, rry, rz, slx, sly, sz, saltL, p.spkl_angle, rangle, rtilt, p.spkl_tilt);
+    const auto kRefsRL = p.mono_source ? kRefsLL : refsKey (rlx, rly, rz, srx, sry, sz, saltR, p.spkr_angle, langle, ltilt, p.spkr_tilt);
+    const auto kRefsRR = p.mono_source ? kRefsLR : refsKey (rrx, rry, rz, srx, sry, sz, saltR, p.spkr_angle, rangle, rtilt, p.spkr_tilt);
+    const auto kLL = renderKey (kRefsLL), kRL = renderKey (kRefsRL);
+    const auto kLR = renderKey (kRefsLR), kRR = renderKey (kRefsRR);
+
+    StageKey pathKeyBuilder ("extraPath");
+    addShapeInputs (pathKeyBuilder, p);
+    pathKeyBuilder.add (kLL).add (kRL).add (kLR).add (kRR).add (seedBase)
+                  .add (eo).add (coincident).add (diff).add (rt).add (irLen).add (ec).add (sr).add (He)
+                  .add (bakedErGain).add (bakedTailGain).add (p.modal_tangential_oblique)
+                  .add (p.fdn_vectorised);
+    const auto pathKey = pathKeyBuilder.get();
+
+    auto& cache = SynthStageCache::shared();
+    if (auto cached = cache.find<MicIRChannelsT<Sample>> (pathKey))
+    {
+        StageProbe cachedProbe (profile, pathName, "cached", StageProbe::onThisThread);
+        cachedProbe.addCacheHit();
+        cachedProbe.setBytes (cacheBytes (*cached));
+        cachedProbe.finish();
+        report(1.0, "Done.");
+        return *cached;
+    }
+
+    // Image sources only for the channels whose band render missed.
+    using RenderPtr = std::shared_ptr<const Buffer>;
+    std::vector<Ref> rLL, rRL, rLR, rRR;
+    RenderPtr pLL, pRL, pLR, pRR;
+    StageProbe refsProbe (profile, pathName, "refs", StageProbe::onThisThread);
+    auto refsOrRender = [&] (SynthStageCache::Key kRender, std::vector<Ref>& refs,
+                             RenderPtr& render, auto&& computeRefs)
+    {
+        render = cache.find<Buffer> (kRender);
+        if (render == nullptr)
+            refs = computeRefs();
+        else
+            refsProbe.addCacheHit();
+    };
+    refsOrRender (kLL, rLL, pLL, [&] { return refsDispatch(refsProbe, latticeL, rlx, rly, rz, slx, sly, sz, saltL, p.spkl_angle, langle, ltilt, p.spkl_tilt); });
+    refsOrRender (kLR, rLR, pLR, [&] { return refsDispatch(refsProbe, latticeL, rrx, rry, rz, slx, sly, sz, saltL, p.spkl_angle, rangle, rtilt, p.spkl_tilt); });
+    // Mono mode: rRL := rLL and rRR := rLR — see synthMainPath for the
+    // full rationale (linearity of convolution gives outL = IR_LL ⊛ (inL+inR)).
+    if (p.mono_source)
+    {
+        rRL = rLL;  pRL = pLL;
+        rRR = rLR;  pRR = pLR;
+    }
+    else
+    {
+        refsOrRender (kRL, rRL, pRL, [&] { return refsDispatch(refsProbe, latticeR, rlx, rly, rz, srx, sry, sz, saltR, p.spkr_angle, langle, ltilt, p.spkr_tilt); });
+        refsOrRender (kRR, rRR, pRR, [&] { return refsDispatch(refsProbe, latticeR, rrx, rry, rz, srx, sry, sz, saltR, p.spkr_angle, rangle, rtilt, p.spkr_tilt); });
+    }
+    latticeL = {};   // release the per-image shift tables before rendering
+    latticeR = {};
+    if (isCancelled (cancel))
+        return {};
+    {
+        size_t refsBytes = 0;
+        for (const auto* refs : { &rLL, &rRL, &rLR, &rRR })
+            refsBytes += refs->capacity() * sizeof (Ref);
+        refsProbe.setBytes (refsBytes);
+        refsProbe.finish();
+    }
+
+    report(0.30, "Rendering " + std::to_string(rLL.size() + rRL.size() + rLR.size() + rRR.size()) + " reflections…");
+
+    StageProbe renderProbe (profile, pathName, "render", StageProbe::onThisThread);
+    auto render = [&] (SynthStageCache::Key kRender, const std::vector<Ref>& refs, RenderPtr& dst)
+    {
+        if (dst != nullptr)
+        {
+            renderProbe.addCacheHit();
+            return;
+        }
+        renderProbe.addItems (refs.size());
+        dst = cachedStage (kRender, cancel, [&] { return renderCh<Sample>(refs, irLen, den, sr, earlyDiff, reflectionSpreadMs, freqScatterMs, cancel); });
+    };
+    render (kLL, rLL, pLL);
+    render (kRL, rRL, pRL);
+    render (kLR, rLR, pLR);
+    render (kRR, rRR, pRR);
+    if (isCancelled (cancel))
+        return {};
+    renderProbe.setBytes ((size_t) irLen * sizeof (Sample) * 4);
+    renderProbe.finish();
+    const Buffer& eLL = *pLL;
+    const Buffer& eRL = *pRL;
+    const Buffer& eLR = *pLR;
+    const Buffer& eRR = *pRR;
 
     report(0.60, "Synthesising FDN reverb tail…");
 
-    std::vector<double> iLL, iRL, iLR, iRR;
+    Buffer iLL, iRL, iLR, iRR;
     if (!eo)
     {
-        std::vector<double> eL(irLen), eR(irLen);
+        StageProbe seedProbe (profile, pathName, "seed", StageProbe::onThisThread);
+        Buffer eL(irLen), eR(irLen);
         for (int i = 0; i < irLen; ++i)
         {
             eL[(size_t)i] = eLL[(size_t)i] + eRL[(size_t)i];
@@ -3173,6 +4364,9 @@ MicIRChannels IRSynthEngine::synthExtraPath (const IRSynthParams& p,
                 eR[(size_t)i] = dR.process(eR[(size_t)i]);
             }
         }
+        seedProbe.addItems ((size_t) irLen);
+        seedProbe.setBytes ((size_t) irLen * sizeof (Sample) * 2);
+        seedProbe.finish();
 
         // longest FDN delay line (same formula as inside renderFDNTail)
         double fdnVol, fdnSurf;
@@ -3211,9 +4405,31 @@ MicIRChannels IRSynthEngine::synthExtraPath (const IRSynthParams& p,
 
         // FDN seed derived from seedBase so OUTRIG (52 → 110/111) and AMBIENT (62 → 120/121)
         // have distinct diffuse fields from MAIN (100/101) and from each other.
-        std::vector<double> tL = renderFDNTail(rt, irLen, ecFdn, eL, diff, sr, seedBase + 58, p.width, p.depth, He, fdnMaxRefCut, &p);
-        std::vector<double> tR = renderFDNTail(rt, irLen, ecFdn, eR, diff, sr, seedBase + 59, p.width, p.depth, He, fdnMaxRefCut, &p);
-
+        auto fdnKey = [&] (SynthStageCache::Key a, SynthStageCache::Key b, uint32_t seed)
+        {
+            StageKey k ("fdn");
+            addShapeInputs (k, p);
+            k.add (a).add (b).add (false).add (coincident).add (rt).add (irLen)
+             .add (ecFdn).add (diff).add (sr).add (seed).add (He).add (fdnMaxRefCut)
+             .add (p.fdn_vectorised);
+            return k.get();
+        };
+        StageProbe fdnProbe (profile, pathName, "fdn", StageProbe::onThisThread);
+        auto tail = [&] (const Buffer& seedBuf, uint32_t seed)
+        {
+            fdnProbe.addItems ((size_t) irLen);
+            return renderFDNTail(rt, irLen, ecFdn, seedBuf, diff, sr, seed, p.width, p.depth, He, fdnMaxRefCut, &p, cancel);
+        };
+        const auto tLp = cachedStage (fdnKey (kLL, kRL, seedBase + 58), cancel, [&] { return tail (eL, seedBase + 58); });
+        const auto tRp = cachedStage (fdnKey (kLR, kRR, seedBase + 59), cancel, [&] { return tail (eR, seedBase + 59); });
+        if (isCancelled (cancel))
+            return {};
+        fdnProbe.setBytes ((size_t) irLen * sizeof (Sample) * 2);
+        fdnProbe.finish();
+        const Buffer& tL = *tLp;
+        const Buffer& tR = *tRp;
+
+        StageProbe mixProbe (profile, pathName, "mix", StageProbe::onThisThread);
         iLL.resize((size_t)irLen);
         iRL.resize((size_t)irLen);
         iLR.resize((size_t)irLen);
@@ -3226,7 +4442,7 @@ MicIRChannels IRSynthEngine::synthExtraPath (const IRSynthParams& p,
         const double kMinGain = 1.0 / kMaxGain;
         const double kMinRms  = 1e-7;
 
-        auto wRMS = [&](const std::vector<double>& v, int a, int b) -> double {
+        auto wRMS = [&](const Buffer& v, int a, int b) -> double {
             a = std::max(a, 0); b = std::min(b, irLen);
             if (b <= a) return 0.0;
             double s = 0.0;
@@ -3277,9 +4493,13 @@ MicIRChannels IRSynthEngine::synthExtraPath (const IRSynthParams& p,
             iLR[(size_t)i] = eLR[(size_t)i] * bakedErGain * ef + tailR;
             iRR[(size_t)i] = eRR[(size_t)i] * bakedErGain * ef + tailR;
         }
+        mixProbe.addItems ((size_t) irLen);
+        mixProbe.setBytes ((size_t) irLen * sizeof (Sample) * 4);
+        mixProbe.finish();
     }
     else
     {
+        StageProbe mixProbe (profile, pathName, "mix", StageProbe::onThisThread);
         iLL.resize((size_t)irLen);
         iRL.resize((size_t)irLen);
         iLR.resize((size_t)irLen);
@@ -3298,10 +4518,14 @@ MicIRChannels IRSynthEngine::synthExtraPath (const IRSynthParams& p,
             iLR[(size_t)i] = eLR[(size_t)i] * bakedErGain * erFade;
             iRR[(size_t)i] = eRR[(size_t)i] * bakedErGain * erFade;
         }
+        mixProbe.addItems ((size_t) irLen);
+        mixProbe.setBytes ((size_t) irLen * sizeof (Sample) * 4);
+        mixProbe.finish();
     }
 
     // Modal bank — skipped for non-rectangular shapes (axial-mode formula models a box).
     {
+        StageProbe modalProbe (profile, pathName, "modal", StageProbe::onThisThread);
         const double modalGain = 0.18;
         double polyArea = 0.0;
         if (p.shape != "Rectangular")
@@ -3310,14 +4534,16 @@ MicIRChannels IRSynthEngine::synthExtraPath (const IRSynthParams& p,
             const auto wallsForArea = makeWalls2D (p, p.width, p.depth, zeroR);
             polyArea = polygonArea (wallsForArea);
         }
-        iLL = applyModalBank(iLL, p.width, p.depth, He, rt[0], modalGain, sr, p.shape, polyArea);
-        iRL = applyModalBank(iRL, p.width, p.depth, He, rt[0], modalGain, sr, p.shape, polyArea);
-        iLR = applyModalBank(iLR, p.width, p.depth, He, rt[0], modalGain, sr, p.shape, polyArea);
-        iRR = applyModalBank(iRR, p.width, p.depth, He, rt[0], modalGain, sr, p.shape, polyArea);
+        applyModalBank (iLL, iRL, iLR, iRR, p.width, p.depth, He, rt[0], modalGain, sr,
+                        p.shape, polyArea, p.modal_tangential_oblique);
+        modalProbe.addItems ((size_t) irLen);
+        modalProbe.setBytes ((size_t) irLen * sizeof (Sample) * 4);
+        modalProbe.finish();
     }
 
     report(0.85, "Finishing…");
 
+    StageProbe outputProbe (profile, pathName, "output", StageProbe::onThisThread);
     iLL = hpF(lpF(iLL, 18000.0, sr), 20.0, sr);
     iRL = hpF(lpF(iRL, 18000.0, sr), 20.0, sr);
     iLR = hpF(lpF(iLR, 18000.0, sr), 20.0, sr);
@@ -3337,7 +4563,7 @@ MicIRChannels IRSynthEngine::synthExtraPath (const IRSynthParams& p,
     {
         const double gain15dB = std::pow(10.0, 15.0 / 20.0);
         for (auto* v : { &iLL, &iRL, &iLR, &iRR })
-            for (double& s : *v)
+            for (Sample& s : *v)
                 s *= gain15dB;
     }
 
@@ -3347,6 +4573,11 @@ MicIRChannels IRSynthEngine::synthExtraPath (const IRSynthParams& p,
     out.RR = std::move(iRR);
     out.irLen = irLen;
     out.synthesised = true;
+    if (cache.isEnabled())
+        cache.insert<MicIRChannelsT<Sample>> (pathKey, std::make_shared<MicIRChannelsT<Sample>> (out), cacheBytes (out));
+    outputProbe.addItems ((size_t) irLen);
+    outputProbe.setBytes ((size_t) irLen * sizeof (Sample) * 6);
+    outputProbe.finish();
     report(1.0, "Done.");
     return out;
 }
@@ -3359,10 +4590,13 @@ MicIRChannels IRSynthEngine::synthExtraPath (const IRSynthParams& p,
 //
 // D2: uses p.mic_pattern and p.micl_angle / p.micr_angle (inherits from MAIN).
 // er_only is implicitly honoured — order-0 arrivals are always within ec.
-MicIRChannels IRSynthEngine::synthDirectPath (const IRSynthParams& p)
+template <typename Sample>
+MicIRChannelsT<Sample> IRSynthEngine::synthDirectPath (const IRSynthParams& p, SynthProfile* profile)
 {
-    MicIRChannels out;
+    using Buffer = std::vector<Sample>;
+    MicIRChannelsT<Sample> out;
     int sr = p.sample_rate;
+    StageProbe probe (profile, "direct", "direct", StageProbe::onThisThread);
 
     auto& vp = getVP();
     auto vpIt = vp.find(p.vault_type);
@@ -3553,30 +4787,31 @@ MicIRChannels IRSynthEngine::synthDirectPath (const IRSynthParams& p)
         rRC = p.mono_source ? rLC
                             : refsDispatch(rcx, rcy, rz, srx, sry, sz, kDirectSaltR, p.spkr_angle, faceC, tiltC, p.spkr_tilt);
     }
+    probe.addItems (rLL.size() + rRL.size() + rLR.size() + rRR.size() + rLC.size() + rRC.size());
 
     // No diffusion, no frequency scatter, no reflection spread — just the bpF cascade.
     const double diff = 0.0;
     const double reflectionSpreadMs = 0.0;
     const double freqScatterMs = 0.0;
 
-    std::vector<double> iLL = renderCh(rLL, irLen, den, sr, diff, reflectionSpreadMs, freqScatterMs);
-    std::vector<double> iRL = renderCh(rRL, irLen, den, sr, diff, reflectionSpreadMs, freqScatterMs);
-    std::vector<double> iLR = renderCh(rLR, irLen, den, sr, diff, reflectionSpreadMs, freqScatterMs);
-    std::vector<double> iRR = renderCh(rRR, irLen, den, sr, diff, reflectionSpreadMs, freqScatterMs);
+    Buffer iLL = renderCh<Sample>(rLL, irLen, den, sr, diff, reflectionSpreadMs, freqScatterMs);
+    Buffer iRL = renderCh<Sample>(rRL, irLen, den, sr, diff, reflectionSpreadMs, freqScatterMs);
+    Buffer iLR = renderCh<Sample>(rLR, irLen, den, sr, diff, reflectionSpreadMs, freqScatterMs);
+    Buffer iRR = renderCh<Sample>(rRR, irLen, den, sr, diff, reflectionSpreadMs, freqScatterMs);
 
     // Decca combine (same formula as synthMainPath — see that function for the
     // derivation). The DIRECT path is order-0 only, so the combine applies to
     // the short direct-arrival impulse responses before they are band-limited.
     if (p.main_decca_enabled)
     {
-        std::vector<double> eLC = renderCh(rLC, irLen, den, sr, diff, reflectionSpreadMs, freqScatterMs);
-        std::vector<double> eRC = renderCh(rRC, irLen, den, sr, diff, reflectionSpreadMs, freqScatterMs);
-        auto hp1pole = [sr](std::vector<double>& v, double fcHz)
+        Buffer eLC = renderCh<Sample>(rLC, irLen, den, sr, diff, reflectionSpreadMs, freqScatterMs);
+        Buffer eRC = renderCh<Sample>(rRC, irLen, den, sr, diff, reflectionSpreadMs, freqScatterMs);
+        auto hp1pole = [sr](Buffer& v, double fcHz)
         {
             if (v.empty()) return;
             const double a = std::exp(-2.0 * M_PI * fcHz / (double)sr);
             double xPrev = 0.0, yPrev = 0.0;
-            for (double& s : v)
+            for (Sample& s : v)
             {
                 double x = s;
                 double y = a * (yPrev + x - xPrev);
@@ -3604,7 +4839,7 @@ MicIRChannels IRSynthEngine::synthDirectPath (const IRSynthParams& p)
 
     // Match MAIN's bakedErGain convention (applied to the ER portion in MAIN).
     for (auto* v : { &iLL, &iRL, &iLR, &iRR })
-        for (double& s : *v) s *= bakedErGain;
+        for (Sample& s : *v) s *= bakedErGain;
 
     // Light band-limiting to match MAIN's post-processing profile.
     iLL = hpF(lpF(iLL, 18000.0, sr), 20.0, sr);
@@ -3616,7 +4851,7 @@ MicIRChannels IRSynthEngine::synthDirectPath (const IRSynthParams& p)
     {
         const double gain15dB = std::pow(10.0, 15.0 / 20.0);
         for (auto* v : { &iLL, &iRL, &iLR, &iRR })
-            for (double& s : *v)
+            for (Sample& s : *v)
                 s *= gain15dB;
     }
 
@@ -3626,16 +4861,19 @@ MicIRChannels IRSynthEngine::synthDirectPath (const IRSynthParams& p)
     out.RR = std::move(iRR);
     out.irLen = irLen;
     out.synthesised = true;
+    probe.setBytes ((size_t) irLen * sizeof (Sample) * (p.main_decca_enabled ? 8 : 6));
+    probe.finish();
     return out;
 }
 
 // ── makeWav — 24-bit quad (iLL,iRL,iLR,iRR), little-endian ────────────────
 // Writes WAVE_FORMAT_EXTENSIBLE (tag 0xFFFE) with a 40-byte fmt chunk.
 // Plain PCM (tag 0x0001) is rejected by JUCE's WavAudioFormat for 4-channel files.
-std::vector<uint8_t> IRSynthEngine::makeWav (const std::vector<double>& iLL,
-                                              const std::vector<double>& iRL,
-                                              const std::vector<double>& iLR,
-                                              const std::vector<double>& iRR,
+template <typename Sample>
+std::vector<uint8_t> IRSynthEngine::makeWav (const std::vector<Sample>& iLL,
+                                              const std::vector<Sample>& iRL,
+                                              const std::vector<Sample>& iLR,
+                                              const std::vector<Sample>& iRR,
                                               int sampleRate)
 {
     size_t N = std::min({iLL.size(), iRL.size(), iLR.size(), iRR.size()});
@@ -3679,9 +4917,9 @@ std::vector<uint8_t> IRSynthEngine::makeWav (const std::vector<double>& iLL,
 
     for (size_t i = 0; i < N; ++i)
     {
-        for (const double* s : { &iLL[i], &iRL[i], &iLR[i], &iRR[i] })
+        for (const Sample* s : { &iLL[i], &iRL[i], &iLR[i], &iRR[i] })
         {
-            int32_t x = (int32_t)std::round(std::max(-1.0, std::min(1.0, *s)) * 8388607.0);
+            int32_t x = (int32_t)std::round(std::max(-1.0, std::min(1.0, (double)*s)) * 8388607.0);
             p[0] = (uint8_t)(x & 0xff);
             p[1] = (uint8_t)((x >> 8) & 0xff);
             p[2] = (uint8_t)((x >> 16) & 0xff);
@@ -3690,3 +4928,26 @@ std::vector<uint8_t> IRSynthEngine::makeWav (const std::vector<double>& iLL,
     }
     return buf;
 }
+
+// ── Explicit instantiations — double (factory rebakes, tools) and float ──
+#define PING_INSTANTIATE_SYNTH(Sample)                                                        \
+    template IRSynthResultT<Sample> IRSynthEngine::synthIR<Sample> (                          \
+        const IRSynthParams&, IRSynthProgressFn, SynthTaskPool::CancellationToken);           \
+    template IRSynthResultT<Sample> IRSynthEngine::synthPreviewIR<Sample> (                   \
+        const IRSynthParams&, IRSynthProgressFn, SynthTaskPool::CancellationToken);           \
+    template std::vector<uint8_t> IRSynthEngine::makeWav<Sample> (                            \
+        const std::vector<Sample>&, const std::vector<Sample>&,                               \
+        const std::vector<Sample>&, const std::vector<Sample>&, int);                         \
+    template std::vector<Sample> IRSynthEngine::renderCh<Sample> (                            \
+        const std::vector<Ref>&, int, double, int, double, double, double, Cancel, int*);     \
+    template std::vector<Sample> IRSynthEngine::renderFDNTail<Sample> (                       \
+        const std::vector<double>&, int, int, const std::vector<Sample>&, double, int,        \
+        uint32_t, double, double, double, int, const IRSynthParams*, Cancel);                 \
+    template void IRSynthEngine::applyModalBank<Sample> (                                     \
+        std::vector<Sample>&, std::vector<Sample>&, std::vector<Sample>&, std::vector<Sample>&, \
+        double, double, double, double, double, int, const std::string&, double, bool);
+
+PING_INSTANTIATE_SYNTH (double)
+PING_INSTANTIATE_SYNTH (float)
+
+#undef PING_INSTANTIATE_SYNTH
@@ -18,6 +18,11 @@
   #include <array>
 #endif
 
+#include "BandAmpKernel.h"
+#include "FdnKernel.h"
+#include "SynthProfile.h"
+#include "SynthTaskPool.h"
+
 /**
  * Source radiation pattern (instrument directivity) — per-octave-band model.
  *
@@ -401,32 +406,70 @@ struct IRSynthParams
     // here so it round-trips through the .ping sidecar with the rest of the
     // floor-plan UI state.
     int         mirror_axis       = 0;
+
+    // Preview pass (engine-only — never serialised). When true the engine
+    // caps the image-source order at IRSynthEngine::kPreviewMaxOrder and the
+    // IR length at kPreviewMaxSeconds, which shortens the FDN run to match.
+    // Used by the IR Synth page to load a rough IR in ≤ ~100 ms before the full
+    // one renders; see IRSynthEngine::synthPreviewIR.
+    bool        preview           = false;
+
+    // FDN kernel (engine-only — never serialised). When true renderFDNTail
+    // runs the vectorised 16-line core in FdnKernel.h instead of the
+    // reference per-line loop: same network, tail within IR_52's decay /
+    // band-energy bounds but not bit-identical. false (default) keeps the
+    // reference path, so golden tests and factory IRs are unchanged; the IR
+    // Synth page turns it on.
+    bool        fdn_vectorised    = false;
+
+    // Modal bank mode set (engine-only — never serialised). When true the
+    // bank adds the tangential and oblique room modes below 250 Hz to the
+    // axial ones (IRSynthEngine::roomModes). false (default) is the axial
+    // bank golden tests and factory IRs were made with.
+    bool        modal_tangential_oblique = false;
 };
 
+// ── Sample type ──────────────────────────────────────────────────────────────
+// The engine's signal buffers (band renders, FDN tails, mic-path channels and
+// the result) are std::vector<Sample>. Sample = double is the reference
+// engine: factory rebakes, the Tools and the golden tests use it. Sample =
+// float halves the memory a synthesis holds (a 4-path, 30 s IR is 16 × 1.4 M
+// samples plus its intermediates) and is what the plugin loads anyway.
+// Recursive state (filters, diffusers, FDN lines, modal bank) and every
+// gain / envelope computation stay double in both, so the float build only
+// rounds each buffer as it is stored. IR_55 bounds the deviation.
+
 /** Per-path 4-channel IR (LL/RL/LR/RR) used for DIRECT/OUTRIG/AMBIENT results. */
-struct MicIRChannels
+template <typename Sample>
+struct MicIRChannelsT
 {
-    std::vector<double> LL, RL, LR, RR;
+    std::vector<Sample> LL, RL, LR, RR;
     int  irLen       = 0;
     bool synthesised = false;   // false = path was disabled, empty vectors
 };
 
-struct IRSynthResult
+using MicIRChannels  = MicIRChannelsT<double>;
+using MicIRChannelsF = MicIRChannelsT<float>;
+
+template <typename Sample>
+struct IRSynthResultT
 {
     // MAIN path — existing fields, unchanged layout.
-    std::vector<double> iLL, iRL, iLR, iRR;  // L->L, R->L, L->R, R->R
+    std::vector<Sample> iLL, iRL, iLR, iRR;  // L->L, R->L, L->R, R->R
     std::vector<double> rt60;                // 8 bands: 125 250 500 1k 2k 4k 8k 16k
     int   irLen      = 0;
     int   sampleRate = 0;
     bool  success    = false;
+    bool  cancelled  = false;   // synthIR stopped early by its cancellation token (success == false)
+    bool  preview    = false;   // synthesised with IRSynthParams::preview (low order, shortened)
     std::string errorMessage;
 
     // Additional mic paths (feature/multi-mic-paths).
     // synthesised == false for any path that was not requested in IRSynthParams;
     // the vectors stay empty in that case.
-    MicIRChannels direct;
-    MicIRChannels outrig;
-    MicIRChannels ambient;
+    MicIRChannelsT<Sample> direct;
+    MicIRChannelsT<Sample> outrig;
+    MicIRChannelsT<Sample> ambient;
 
     // ── Output gain telemetry (v2.14.2) ────────────────────────────────────
     // Populated by synthIR after all paths have rendered and the optional
@@ -439,8 +482,15 @@ struct IRSynthResult
     // engine.
     double measured_peak_dbfs = -120.0;  // "silence" sentinel
     double applied_gain_db    = 0.0;
+
+    // Wall / CPU time, buffer bytes and item counts per stage of each path
+    // (SynthProfile.h). Filled by every synthIR call that completes.
+    SynthProfile profile;
 };
 
+using IRSynthResult  = IRSynthResultT<double>;
+using IRSynthResultF = IRSynthResultT<float>;
+
 /**
  * Progress callback: (fraction 0..1, message string)
  * Called from the synthesis thread — must be thread-safe.
@@ -474,6 +524,21 @@ struct Wall2D
     std::array<double, 8> rAbs{};       // reflection coefficient per band
 };
 
+/**
+ * One node of the polygon image-source tree (calcRefsPolygon). The tree is a
+ * flat arena in depth-first order; a node's reflection chain is recovered by
+ * walking parent indices back to the real source, so building the tree does
+ * no per-node heap allocation.
+ */
+struct ImageSourceNode2D
+{
+    double x = 0.0, y = 0.0;            // image position (metres)
+    std::array<double, 8> cumAbs{};     // accumulated reflection coeffs
+    int parent = -1;                    // arena index of the previous image (-1 = real source)
+    int wall   = -1;                    // wall reflected through to reach this image (-1 = real source)
+    int order  = 0;                     // walls in the chain
+};
+
 /**
  * Pure C++ port of the IR Synthesiser v5 acoustic engine.
  * All methods are static — no state, fully re-entrant.
@@ -481,17 +546,40 @@ struct Wall2D
 class IRSynthEngine
 {
 public:
-    /** Main entry point. Runs synchronously — call from a background thread. */
-    static IRSynthResult synthIR (const IRSynthParams& p, IRSynthProgressFn cb);
+    /** Main entry point. Runs synchronously — call from a background thread.
+        Cancelling `cancel` from any thread makes synthIR return within a few
+        milliseconds with success == false and cancelled == true; its queued
+        pool tasks are dropped without running. synthIR<float> stores every
+        signal buffer as float (see "Sample type" above). */
+    template <typename Sample = double>
+    static IRSynthResultT<Sample> synthIR (const IRSynthParams& p, IRSynthProgressFn cb,
+                                           SynthTaskPool::CancellationToken cancel = {});
+
+    /** Fast low-order pass for interactive editing: synthIR with
+        p.preview = true. The result keeps the full IR's early field (same
+        image sources up to kPreviewMaxOrder, same seeds) but is at most
+        kPreviewMaxSeconds long. */
+    template <typename Sample = double>
+    static IRSynthResultT<Sample> synthPreviewIR (const IRSynthParams& p, IRSynthProgressFn cb,
+                                                  SynthTaskPool::CancellationToken cancel = {});
+
+    static constexpr int    kPreviewMaxOrder   = 6;
+    static constexpr double kPreviewMaxSeconds = 1.0;
+
+    /** Optional cancellation token threaded through the stage functions below.
+        nullptr = never cancelled. A stage that sees it cancelled returns early
+        with a partial (or empty) result, which the caller discards. */
+    using Cancel = const SynthTaskPool::CancellationToken*;
 
     /** Compute RT60 at 8 bands without doing a full synthesis. */
     static std::vector<double> calcRT60 (const IRSynthParams& p);
 
     /** Encode stereo IR to 24-bit WAV bytes. */
-    static std::vector<uint8_t> makeWav (const std::vector<double>& iLL,
-                                         const std::vector<double>& iRL,
-                                         const std::vector<double>& iLR,
-                                         const std::vector<double>& iRR,
+    template <typename Sample>
+    static std::vector<uint8_t> makeWav (const std::vector<Sample>& iLL,
+                                         const std::vector<Sample>& iRL,
+                                         const std::vector<Sample>& iLR,
+                                         const std::vector<Sample>& iRR,
                                          int sampleRate);
 
     // ── 2D polygon geometry utilities (v2.8.0) ────────────────────────────
@@ -527,11 +615,176 @@ public:
                                             double W, double D,
                                             const std::array<double, 8>& rWPerBand);
 
+    /** Polygon image-source tree for a source at (sx, sy) heard at (rx, ry):
+        every image within maxDist2D whose reflection chain the receiver can
+        see, up to maxOrder walls, in depth-first order. Stops descending once
+        acceptedBudget images are accepted. Node 0 is the real source. This is
+        calcRefsPolygon's generator, public for PingPolygonTests (IR_49, IR_56).
+        chainChecks, if given, receives the number of candidates that reached
+        full chain validation (the rest were culled by the beam test). */
+    static std::vector<ImageSourceNode2D> buildImageSources2D (const std::vector<Wall2D>& walls,
+                                                               double sx, double sy,
+                                                               double rx, double ry,
+                                                               double maxDist2D, int maxOrder,
+                                                               size_t acceptedBudget,
+                                                               size_t* chainChecks = nullptr);
+
+    /** One image-source arrival: sample index, per-band amplitude, azimuth. */
+    struct Ref { int t; std::array<double,8> amps; double az; };
+
+    /** Band-split render of a reflection list: per-band impulses → octave
+        band-pass → sum → deferred ER allpass (diffusion > 0.02). Sparse —
+        working memory follows the reflection count, not irLen. Public for
+        PingEngineTests (IR_51). */
+    template <typename Sample = double>
+    static std::vector<Sample> renderCh (
+        const std::vector<Ref>& refs,
+        int irLen, double den, int sr, double diffusion,
+        double reflectionSpreadMs = 0.0,
+        double freqScatterMs = 0.0,   // per-band time scatter (0 = off); higher bands scatter more
+        Cancel cancel = nullptr,      // checked once per render chunk
+        int* filteredChunks = nullptr);   // out: band × chunk blocks the biquads ran (profiling)
+
+    // Mean free path uses room volume / surface area. For rectangular rooms the
+    // formulas vol = W·D·H and surf = 2(WD + DH + WH) apply verbatim. For polygon
+    // shapes pass `paramsForShape != nullptr` so the function can compute
+    // vol = polyArea·H and surf = 2·polyArea + polyPerim·H from makeWalls2D.
+    // When the pointer is null OR the shape is "Rectangular" the original
+    // rectangular formula is used unchanged (preserves IR_11 / IR_14 bit-identity).
+    // paramsForShape->fdn_vectorised selects the FdnKernel core (null → the
+    // reference loop). The tail has erIR's sample type. Public for
+    // PingEngineTests (IR_52).
+    template <typename Sample>
+    static std::vector<Sample> renderFDNTail (
+        const std::vector<double>& rt60s,
+        int irLen, int erCut,
+        const std::vector<Sample>& erIR,
+        double diffusion, int sr, uint32_t seed,
+        double roomW, double roomD, double roomH,
+        int maxRefCut = -1,                              // -1 → same as erCut (old behaviour)
+        const IRSynthParams* paramsForShape = nullptr,   // null → rectangular formula
+        Cancel cancel = nullptr);                        // checked every 8192 samples
+
+    // The 16-line network renderFDNTail builds for these inputs: prime delays
+    // spread over the mean free path, geometric LFO rates, per-line LFO depths
+    // and one-pole loss filters from rt60s (125 Hz and 16 kHz bands). seed 101
+    // (the MAIN right tail) starts its LFOs half a cycle out.
+    static FdnKernel::Config designFDN (const std::vector<double>& rt60s, int sr, uint32_t seed,
+                                        double roomW, double roomD, double roomH,
+                                        const IRSynthParams* paramsForShape = nullptr);
+
+    /** Mic path whose FDN tail designPathFDN describes. */
+    enum class TailPath { Main, Outrig, Ambient };
+
+    // Seed bases synthIR passes to synthExtraPath; the path's FDN seeds are
+    // seedBase + 58 / + 59 (OUTRIG 110/111, AMBIENT 120/121; MAIN uses 100/101).
+    static constexpr uint32_t kOutrigSeedBase  = 52;
+    static constexpr uint32_t kAmbientSeedBase = 62;
+
+    /** The two networks (left mic, right mic) synthIR runs for a path's
+        tail, designed at sample rate sr: same calcRT60 bands, vaulted height
+        and seeds. Used by the plugin's live tail (LiveFdnTail.h). */
+    static std::array<FdnKernel::Config, 2> designPathFDN (const IRSynthParams& p, TailPath path, int sr);
+
+    /** A room mode below 250 Hz: frequency and amplitude weight (axial 1,
+        tangential √½, oblique ½ — the −3 dB / −6 dB energy steps). */
+    struct RoomMode { double fc; double weight; };
+
+    // Modes of an L × W × H box, n = 0 … 4 per dimension, 10 < f < 250 Hz.
+    // Axial modes come first, in the order the modal bank has always used
+    // (n outer, then x, y, z); tangentialOblique appends the tangential and
+    // oblique modes after them.
+    static std::vector<RoomMode> roomModes (double L, double W, double H, bool tangentialOblique);
+
+    // Modal resonance boost: parallel IIR resonators tuned to the room modes
+    // below ~250 Hz, added in place to all four channels in one pass of
+    // ModalBankKernel. Axial modes only unless tangentialOblique
+    // (IRSynthParams::modal_tangential_oblique).
+    // Axial modes (f_n = c·n/(2L)) are physically meaningful only for rectangular rooms.
+    //
+    // For non-rectangular shapes the function behaviour depends on the build:
+    //   - PING_POLYGON_MODAL_BANK undefined (v2.8.0 behaviour): early-returns unchanged.
+    //   - PING_POLYGON_MODAL_BANK defined (default v2.9.0): computes an
+    //     equivalent-box approximation — a rectangle with dimensions
+    //     Wₑ = √polygonAreaM2, Dₑ = polygonAreaM2 / Wₑ, Hₑ = He — and runs the
+    //     same mode formula on those equivalent dimensions. The exact
+    //     frequencies are not physical but the psychoacoustic LF solidity is.
+    //     Caller must supply polygonAreaM2 > 0 to activate the branch.
+    //
+    // Default `polygonAreaM2 = 0.0` preserves the v2.8.0 skip-for-polygon
+    // behaviour for any caller that hasn't updated. All four channels must
+    // be the same length. Public for PingEngineTests (IR_54).
+    template <typename Sample>
+    static void applyModalBank (std::vector<Sample>& iLL, std::vector<Sample>& iRL,
+                                std::vector<Sample>& iLR, std::vector<Sample>& iRR,
+                                double W, double D, double He,
+                                double rt60_125, double gain, int sr,
+                                const std::string& shape = "Rectangular",
+                                double polygonAreaM2 = 0.0,
+                                bool tangentialOblique = false);
+
+    // Image sources of one source / receiver pair: arrival sample, band
+    // amplitudes and azimuth per reflection (builds the source's image
+    // lattice, then runs the receiver pass). Public for PingBenchmarks.
+    static std::vector<Ref> calcRefs (
+        double rx, double ry, double rz,
+        double sx, double sy, double sz,
+        const IRSynthParams& p,
+        double He, int mo,
+        const std::array<double,8>& rF,
+        const std::array<double,8>& rC,
+        const std::array<double,8>& rW,
+        double oF, double vHfA, double ts,
+        bool eo, int ec, int sr,
+        uint32_t seed,
+        const std::string& micPat,
+        double spkFaceAngle, double micFaceAngle,
+        double maxRefDist,
+        double minJitterMs = 0.0,
+        double highOrderJitterMs = 0.0,   // jitter for order 2+ (when close, breaks periodic echo)
+        double micFaceTilt = 0.0,         // mic elevation tilt in radians (0 = horizontal); see directivityCos
+        double spkFaceTilt = 0.0,         // source elevation tilt (v2.12); only consumed when source_radiation kind != LegacyCardioid
+        Cancel cancel = nullptr);         // checked once per (nx, ny) column
+
+    // calcRefsPolygon — polygon image-source method for non-rectangular shapes.
+    // Structurally mirrors calcRefs parameter-for-parameter so the two can be
+    // swapped through a dispatch lambda at each call site. Horizontal
+    // reflections are computed by a recursive 2D Borish tree with full chain
+    // validation; vertical reflections use the same nz loop as calcRefs.
+    // The Rectangular path NEVER routes here — this function is only invoked
+    // when p.shape is one of Fan / Shoebox, Octagonal, Circular Hall, Cathedral.
+    // Reflection order is capped per-shape by orderLimitForShape (internal).
+    // Public for PingBenchmarks.
+    static std::vector<Ref> calcRefsPolygon (
+        double rx, double ry, double rz,
+        double sx, double sy, double sz,
+        const IRSynthParams& p,
+        double He, int mo,
+        const std::array<double,8>& rF,
+        const std::array<double,8>& rC,
+        const std::array<double,8>& rW,
+        double oF, double vHfA, double ts,
+        bool eo, int ec, int sr,
+        uint32_t seed,
+        const std::string& micPat,
+        double spkFaceAngle, double micFaceAngle,
+        double maxRefDist,
+        double minJitterMs = 0.0,
+        double highOrderJitterMs = 0.0,
+        double micFaceTilt = 0.0,
+        double spkFaceTilt = 0.0,
+        Cancel cancel = nullptr,          // checked per accepted 2D image
+        size_t* acceptedImages = nullptr);  // out: 2D image-source tree size (profiling)
+
 private:
     // ── constants ──────────────────────────────────────────────────────────
     static const double SPEED;      // 343.0
     static const int    N_BANDS;    // 8
     static const int    BANDS[8];   // {125,250,500,1000,2000,4000,8000,16000}
+    // FDN LFO depth range: LF-dominated lines (alpha → 1) swing the full
+    // ±1.2 ms, HF-attenuated lines (alpha → 0) only ±0.3 ms (designFDN).
+    static constexpr double kFdnLfoDepthMaxMs = 1.2;
+    static constexpr double kFdnLfoDepthMinMs = 0.3;
 
     // Material absorption coefficients [14 materials × 8 bands]
     static const std::map<std::string, std::array<double,8>>& getMats();
@@ -563,6 +816,13 @@ private:
     // produced by directivityCos. Hoisted out of the band loop so the
     // 3D math runs once per reflection rather than once per (reflection × band).
     static double micG  (int band, const std::string& pat, double cosTheta);
+
+    // micG for all 8 bands at once. calcRefs resolves the pattern once per
+    // call (findMicPattern; nullptr = unknown pattern → unity gain) so the
+    // per-reflection cost is 8 multiply-adds, not 8 map lookups.
+    using MicPattern = std::array<std::pair<double,double>, 8>;
+    static const MicPattern* findMicPattern (const std::string& pat);
+    static void micGains (const MicPattern* pattern, double cosTheta, double* out) noexcept;
     static double spkG  (double faceAngle, double azToReceiver);
 
     // Seeded RNG (matches JS mkRng)
@@ -570,78 +830,65 @@ private:
     static Rng mkRng (uint32_t seed);
     static double rU  (Rng& rng, double lo, double hi);
 
-    struct Ref { int t; std::array<double,8> amps; double az; };
+    // The receiver-independent half of calcRefs for one source and salt:
+    // image coordinates per lattice axis, each image's hash-keyed time
+    // offsets, and the per-order absorption tables. Every mic of a speaker
+    // reads the same lattice, so the rolls and tables are made once per
+    // speaker instead of once per (speaker, mic) path.
+    struct ImageLattice
+    {
+        int mo = -1;                         // < 0: not built
+        double sx = 0.0, sy = 0.0, sz = 0.0;
+        double ts = 0.0, minJitterMs = 0.0, highOrderJitterMs = 0.0;
+        uint32_t salt = 0;
+        std::vector<double> ix, iy, iz;      // image coordinate of index n at [n + mo]
+        // Per image, (nx, ny, nz) order: the ts-jitter and order-jitter shifts
+        // in samples. Empty when that jitter is off (ts <= 0.05 / no jitter).
+        std::vector<int> tsShift, jitterShift;
+        int minShift = 0;                    // most negative tsShift + jitterShift (≤ 0)
+        BandAmpKernel::PowerTable powF, powC, powW, powO, powV;
+
+        size_t bytes() const noexcept
+        {
+            return (ix.size() + iy.size() + iz.size()) * sizeof (double)
+                 + (tsShift.size() + jitterShift.size()) * sizeof (int)
+                 + powF.bytes() + powC.bytes() + powW.bytes() + powO.bytes() + powV.bytes();
+        }
+    };
 
-    static std::vector<Ref> calcRefs (
-        double rx, double ry, double rz,
+    // calcRefs' image loop before any receiver term. Same arguments as
+    // calcRefs less the receiver, mic and speaker orientation. Returns an
+    // unbuilt lattice (mo < 0) if cancelled.
+    static ImageLattice buildImageLattice (
         double sx, double sy, double sz,
         const IRSynthParams& p,
         double He, int mo,
         const std::array<double,8>& rF,
         const std::array<double,8>& rC,
         const std::array<double,8>& rW,
-        double oF, double vHfA, double ts,
-        bool eo, int ec, int sr,
+        double oF, double vHfA, double ts, int sr,
         uint32_t seed,
-        const std::string& micPat,
-        double spkFaceAngle, double micFaceAngle,
-        double maxRefDist,
         double minJitterMs = 0.0,
-        double highOrderJitterMs = 0.0,   // jitter for order 2+ (when close, breaks periodic echo)
-        double micFaceTilt = 0.0,         // mic elevation tilt in radians (0 = horizontal); see directivityCos
-        double spkFaceTilt = 0.0);        // source elevation tilt (v2.12); only consumed when source_radiation kind != LegacyCardioid
+        double highOrderJitterMs = 0.0,
+        Cancel cancel = nullptr);
 
-    // calcRefsPolygon — polygon image-source method for non-rectangular shapes.
-    // Structurally mirrors calcRefs parameter-for-parameter so the two can be
-    // swapped through a dispatch lambda at each call site. Horizontal
-    // reflections are computed by a recursive 2D Borish tree with full chain
-    // validation; vertical reflections use the same nz loop as calcRefs.
-    // The Rectangular path NEVER routes here — this function is only invoked
-    // when p.shape is one of Fan / Shoebox, Octagonal, Circular Hall, Cathedral.
-    // Reflection order is capped per-shape by orderLimitForShape (internal).
-    static std::vector<Ref> calcRefsPolygon (
+    // calcRefs for one receiver of a prebuilt lattice. Bit-identical to the
+    // full overload (which builds the lattice and calls this).
+    static std::vector<Ref> calcRefs (
         double rx, double ry, double rz,
-        double sx, double sy, double sz,
+        const ImageLattice& lattice,
         const IRSynthParams& p,
-        double He, int mo,
-        const std::array<double,8>& rF,
-        const std::array<double,8>& rC,
-        const std::array<double,8>& rW,
-        double oF, double vHfA, double ts,
         bool eo, int ec, int sr,
-        uint32_t seed,
         const std::string& micPat,
         double spkFaceAngle, double micFaceAngle,
         double maxRefDist,
-        double minJitterMs = 0.0,
-        double highOrderJitterMs = 0.0,
         double micFaceTilt = 0.0,
-        double spkFaceTilt = 0.0);
-
-    static std::vector<double> bpF  (const std::vector<double>& buf, double fc, int sr);
-    static std::vector<double> bpFQ (const std::vector<double>& buf, double fc, double Q, int sr);
-    static std::vector<double> lpF  (const std::vector<double>& buf, double fc, int sr);
-    static std::vector<double> hpF  (const std::vector<double>& buf, double fc, int sr);
+        double spkFaceTilt = 0.0,
+        Cancel cancel = nullptr);
 
-    // Modal resonance boost: parallel IIR resonators tuned to axial modes below ~250 Hz.
-    // Axial modes (f_n = c·n/(2L)) are physically meaningful only for rectangular rooms.
-    //
-    // For non-rectangular shapes the function behaviour depends on the build:
-    //   - PING_POLYGON_MODAL_BANK undefined (v2.8.0 behaviour): early-returns unchanged.
-    //   - PING_POLYGON_MODAL_BANK defined (default v2.9.0): computes an
-    //     equivalent-box approximation — a rectangle with dimensions
-    //     Wₑ = √polygonAreaM2, Dₑ = polygonAreaM2 / Wₑ, Hₑ = He — and runs the
-    //     same axial-mode formula on those equivalent dimensions. The exact
-    //     frequencies are not physical but the psychoacoustic LF solidity is.
-    //     Caller must supply polygonAreaM2 > 0 to activate the branch.
-    //
-    // Default `polygonAreaM2 = 0.0` preserves the v2.8.0 skip-for-polygon
-    // behaviour for any caller that hasn't updated.
-    static std::vector<double> applyModalBank (const std::vector<double>& buf,
-                                               double W, double D, double He,
-                                               double rt60_125, double gain, int sr,
-                                               const std::string& shape = "Rectangular",
-                                               double polygonAreaM2 = 0.0);
+    template <typename Sample> static std::vector<Sample> bpF (const std::vector<Sample>& buf, double fc, int sr);
+    template <typename Sample> static std::vector<Sample> lpF (const std::vector<Sample>& buf, double fc, int sr);
+    template <typename Sample> static std::vector<Sample> hpF (const std::vector<Sample>& buf, double fc, int sr);
 
     // Allpass diffuser (matches JS makeAllpassDiffuser + inline processing)
     struct AllpassDiffuser
@@ -656,33 +903,19 @@ private:
     /** ER diffusion: shorter incommensurate delays to avoid the 17.1 ms repeat from the default allpass. */
     static AllpassDiffuser makeAllpassDiffuserForER (int sr, double diffusion);
 
-    static std::vector<double> renderCh (
-        const std::vector<Ref>& refs,
-        int irLen, double den, int sr, double diffusion,
-        double reflectionSpreadMs = 0.0,
-        double freqScatterMs = 0.0);  // per-band time scatter (0 = off); higher bands scatter more
-
-    // Mean free path uses room volume / surface area. For rectangular rooms the
-    // formulas vol = W·D·H and surf = 2(WD + DH + WH) apply verbatim. For polygon
-    // shapes pass `paramsForShape != nullptr` so the function can compute
-    // vol = polyArea·H and surf = 2·polyArea + polyPerim·H from makeWalls2D.
-    // When the pointer is null OR the shape is "Rectangular" the original
-    // rectangular formula is used unchanged (preserves IR_11 / IR_14 bit-identity).
-    static std::vector<double> renderFDNTail (
-        const std::vector<double>& rt60s,
-        int irLen, int erCut,
-        const std::vector<double>& erIR,
-        double diffusion, int sr, uint32_t seed,
-        double roomW, double roomD, double roomH,
-        int maxRefCut = -1,                              // -1 → same as erCut (old behaviour)
-        const IRSynthParams* paramsForShape = nullptr);  // null → rectangular formula
-
     // ── Multi-mic path synthesis (feature/multi-mic-paths, Phase 1.3) ──────
     // synthMainPath is the historical body of synthIR, unchanged (bit-identity
     // guarded by IR_14). synthExtraPath / synthDirectPath are sibling helpers
     // used for OUTRIG, AMBIENT and DIRECT mic pairs. The parallel dispatcher
-    // (C5) fans synthIR out across these helpers using std::async.
-    static IRSynthResult synthMainPath (const IRSynthParams& p, IRSynthProgressFn cb);
+    // (C5) fans synthIR out across these helpers as SynthTaskPool tasks.
+    // synthMainPath / synthExtraPath take synthIR's cancellation token; a
+    // cancelled path returns early with success / synthesised == false.
+    // (synthDirectPath is short enough that dropping its queued task suffices.)
+    // synthMainPath profiles into its result; the other two append their
+    // stages to `profile` when it is non-null.
+    template <typename Sample>
+    static IRSynthResultT<Sample> synthMainPath (const IRSynthParams& p, IRSynthProgressFn cb,
+                                                 Cancel cancel = nullptr);
 
     // synthExtraPath — OUTRIG / AMBIENT. Identical engine to synthMainPath but
     // reads an independent mic pair (normalised 0–1 receiver positions,
@@ -695,21 +928,25 @@ private:
     //   langle/rangle: mic face angles (same convention as p.micl_angle/p.micr_angle).
     //   pattern: mic polar pattern string (same keys as p.mic_pattern).
     //   seedBase: base seed for calcRefs (4 consecutive seeds consumed) and FDN (+58, +59).
-    static MicIRChannels synthExtraPath (const IRSynthParams& p,
-                                         double rlxNorm, double rlyNorm,
-                                         double rrxNorm, double rryNorm,
-                                         double rzMetres,
-                                         double langle, double rangle,
-                                         const std::string& pattern,
-                                         uint32_t seedBase,
-                                         IRSynthProgressFn cb,
-                                         double ltilt = 0.0,
-                                         double rtilt = 0.0);
+    template <typename Sample>
+    static MicIRChannelsT<Sample> synthExtraPath (const IRSynthParams& p,
+                                                  double rlxNorm, double rlyNorm,
+                                                  double rrxNorm, double rryNorm,
+                                                  double rzMetres,
+                                                  double langle, double rangle,
+                                                  const std::string& pattern,
+                                                  uint32_t seedBase,
+                                                  IRSynthProgressFn cb,
+                                                  double ltilt = 0.0,
+                                                  double rtilt = 0.0,
+                                                  Cancel cancel = nullptr,
+                                                  SynthProfile* profile = nullptr);
 
     // synthDirectPath — order-0-only IR (direct arrivals only, no reflections,
     // no diffusion, no FDN tail, no modal bank, no end fade). Shares MAIN's
     // mic pattern + angles + receiver positions (D2). Returns a very short IR
     // (~2–60 ms depending on room size) sufficient for the direct ray plus
     // the 8-band bandpass-filter impulse-response tail.
-    static MicIRChannels synthDirectPath (const IRSynthParams& p);
+    template <typename Sample>
+    static MicIRChannelsT<Sample> synthDirectPath (const IRSynthParams& p, SynthProfile* profile = nullptr);
 };
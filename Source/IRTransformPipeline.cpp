@@ -0,0 +1,382 @@
+#include "IRTransformPipeline.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+namespace
+{
+    // 10^(-90/20) ≈ 3.162e-5 — used both as (peak × factor) relative threshold
+    // and as an absolute −90 dBFS floor cap (for synth IRs whose peak > 1.0).
+    constexpr float kSilenceFactor = 3.1622777e-5f;
+    constexpr float kPi = 3.14159265358979323846f;
+
+    // Runs fn (c) for c in [0, numChannels), in parallel when there is more
+    // than one channel.
+    template <typename Fn>
+    void forEachChannel (int numChannels, Fn&& fn)
+    {
+        if (numChannels == 1)
+        {
+            fn (0);
+            return;
+        }
+        SynthTaskPool::TaskGroup group (IRTransformPipeline::pool());
+        for (int c = 0; c < numChannels; ++c)
+            group.run ([&fn, c] { fn (c); });
+        group.wait();
+    }
+}
+
+SynthTaskPool& IRTransformPipeline::pool()
+{
+    static SynthTaskPool p (std::min (3, SynthTaskPool::defaultNumThreads()));
+    return p;
+}
+
+// ── Stage storage ────────────────────────────────────────────────────────────
+
+void IRTransformPipeline::Stage::own (int numChannels, int len)
+{
+    store.resize ((size_t) numChannels);
+    out.resize ((size_t) numChannels);
+    for (int c = 0; c < numChannels; ++c)
+    {
+        store[(size_t) c].resize ((size_t) len);
+        out[(size_t) c] = store[(size_t) c].data();
+    }
+    length = len;
+}
+
+void IRTransformPipeline::Stage::passThrough (const std::vector<const float*>& channels, int offset, int len)
+{
+    out.resize (channels.size());
+    for (size_t c = 0; c < channels.size(); ++c)
+        out[c] = channels[c] + offset;
+    length = len;
+}
+
+void IRTransformPipeline::release()
+{
+    for (auto* s : { &input, &reversed, &stretched, &decayed, &trimmed, &expanded })
+        *s = Stage();
+    for (auto* v : { &er, &tail })
+        for (auto& ch : *v)
+            std::vector<float>().swap (ch);
+    std::vector<float>().swap (envelope);
+    splitValid = false;
+}
+
+// ── Silence trim ─────────────────────────────────────────────────────────────
+
+int IRTransformPipeline::findTrimLength (const float* const* channels, int numChannels, int numSamples,
+                                         double sampleRate)
+{
+    std::vector<float> peaks ((size_t) numChannels, 1.0e-6f);
+    forEachChannel (numChannels, [&] (int c)
+    {
+        const float* p = channels[c];
+        float peak = 1.0e-6f;
+        for (int i = 0; i < numSamples; ++i)
+            peak = std::max (peak, std::abs (p[i]));
+        peaks[(size_t) c] = peak;
+    });
+    const float peak = *std::max_element (peaks.begin(), peaks.end());
+    const float threshold = std::min (peak * kSilenceFactor, kSilenceFactor);
+
+    std::vector<int> last ((size_t) numChannels, 0);
+    forEachChannel (numChannels, [&] (int c)
+    {
+        const float* p = channels[c];
+        for (int i = numSamples - 1; i >= 0; --i)
+            if (std::abs (p[i]) > threshold)
+            {
+                last[(size_t) c] = i;
+                break;
+            }
+    });
+    const int lastSignificant = *std::max_element (last.begin(), last.end());
+
+    const int safetyTail = (int) (0.5 * sampleRate); // 500 ms (also fade length)
+    const int minLen     = (int) (0.3 * sampleRate); // 300 ms floor
+    int newLen = std::min (lastSignificant + safetyTail + 1, numSamples);
+    newLen     = std::max (newLen, minLen);
+    return std::min (newLen, numSamples);
+}
+
+void IRTransformPipeline::fadeOutEnd (float* const* channels, int numChannels, int length, double sampleRate)
+{
+    // Cosine fade over the last 500 ms, smoothing the cut. Callers fade only
+    // when they actually truncated, so reloading an already-trimmed IR is
+    // bit-identical instead of compounding (cos², cos³, …).
+    const int fadeSamps = std::min ((int) (0.5 * sampleRate), length);
+    const int fadeStart = length - fadeSamps;
+    std::vector<float> gain ((size_t) fadeSamps);
+    for (int i = 0; i < fadeSamps; ++i)
+    {
+        const float t = (float) i / (float) std::max (fadeSamps, 1);
+        gain[(size_t) i] = 0.5f * (1.0f + std::cos (kPi * t));
+    }
+    forEachChannel (numChannels, [&] (int c)
+    {
+        float* p = channels[c] + fadeStart;
+        for (int i = 0; i < fadeSamps; ++i)
+            p[i] *= gain[(size_t) i];
+    });
+}
+
+int IRTransformPipeline::trimTrailingSilence (float* const* channels, int numChannels, int numSamples,
+                                              double sampleRate)
+{
+    const int newLen = findTrimLength (channels, numChannels, numSamples, sampleRate);
+    if (newLen < numSamples)
+        fadeOutEnd (channels, numChannels, newLen, sampleRate);
+    return newLen;
+}
+
+// ── Input ────────────────────────────────────────────────────────────────────
+
+bool IRTransformPipeline::updateInput (const float* const* channels, int numChannels, int numSamples,
+                                       double rate)
+{
+    if (input.valid && (int) input.out.size() == numChannels && input.length == numSamples && sampleRate == rate)
+    {
+        std::vector<char> same ((size_t) numChannels, 0);
+        forEachChannel (numChannels, [&] (int c)
+        {
+            same[(size_t) c] = std::memcmp (input.out[(size_t) c], channels[c],
+                                            (size_t) numSamples * sizeof (float)) == 0;
+        });
+        if (std::all_of (same.begin(), same.end(), [] (char s) { return s != 0; }))
+            return false;
+    }
+
+    input.own (numChannels, numSamples);
+    forEachChannel (numChannels, [&] (int c)
+    {
+        std::memcpy (input.store[(size_t) c].data(), channels[c], (size_t) numSamples * sizeof (float));
+    });
+    sampleRate = rate;
+    input.key = SynthStageCache::KeyBuilder ("input").add ((uint64_t) ++inputGeneration).get();
+    input.valid = true;
+    return true;
+}
+
+// ── Chain ────────────────────────────────────────────────────────────────────
+
+void IRTransformPipeline::run (const float* const* channels, int numChannels, int numSamples,
+                               double rate, const Settings& s)
+{
+    lastRun = {};
+    lastRun.input = updateInput (channels, numChannels, numSamples, rate);
+
+    // Reverse: sample order reversed per channel.
+    {
+        const Key key = SynthStageCache::KeyBuilder ("reverse").add (input.key).add (s.reverse).get();
+        if (! reversed.valid || reversed.key != key)
+        {
+            if (s.reverse)
+            {
+                reversed.own (numChannels, input.length);
+                forEachChannel (numChannels, [&] (int c)
+                {
+                    std::reverse_copy (input.out[(size_t) c], input.out[(size_t) c] + input.length,
+                                       reversed.store[(size_t) c].begin());
+                });
+            }
+            else
+            {
+                reversed.passThrough (input.out, 0, input.length);
+            }
+            reversed.key = key;
+            reversed.valid = lastRun.reverse = true;
+        }
+    }
+
+    // Reverse trim: skip the start of the reversed IR (initial silence / long
+    // tail), keeping at least 64 samples.
+    int trimStart = 0;
+    if (s.reverse && s.reverseTrim > 0.001f)
+    {
+        const int n = reversed.length;
+        const int startIdx = (int) (s.reverseTrim * (float) n);
+        if (startIdx > 0 && startIdx < n && n - startIdx >= 64)
+            trimStart = startIdx;
+    }
+
+    // Stretch: time-scale to stretch × length by linear interpolation.
+    {
+        const Key key = SynthStageCache::KeyBuilder ("stretch").add (reversed.key)
+                            .add (trimStart).add ((double) s.stretch).get();
+        if (! stretched.valid || stretched.key != key)
+        {
+            const int origLen = reversed.length - trimStart;
+            int newLen = (int) ((float) origLen * s.stretch);
+            if (newLen < 64) newLen = 64;
+            if (newLen != origLen)
+            {
+                stretched.own (numChannels, newLen);
+                forEachChannel (numChannels, [&] (int c)
+                {
+                    const float* src = reversed.out[(size_t) c] + trimStart;
+                    float* dst = stretched.store[(size_t) c].data();
+                    for (int i = 0; i < newLen; ++i)
+                    {
+                        float srcIdx = (float) i * (float) origLen / (float) newLen;
+                        int i0 = (int) srcIdx;
+                        int i1 = std::min (i0 + 1, origLen - 1);
+                        float f = srcIdx - (float) i0;
+                        dst[i] = src[i0] * (1.0f - f) + src[i1] * f;
+                    }
+                });
+            }
+            else
+            {
+                stretched.passThrough (reversed.out, trimStart, origLen);
+            }
+            stretched.key = key;
+            stretched.valid = lastRun.stretch = true;
+        }
+    }
+
+    // Decay: exponential fade-out exp (−decay × 6 × i / N). One envelope
+    // serves every channel.
+    {
+        const Key key = SynthStageCache::KeyBuilder ("decay").add (stretched.key).add ((double) s.decay).get();
+        if (! decayed.valid || decayed.key != key)
+        {
+            const int N = stretched.length;
+            if (s.decay > 0.001f && N > 0)
+            {
+                envelope.resize ((size_t) N);
+                for (int i = 0; i < N; ++i)
+                {
+                    float t = (float) i / (float) N;
+                    envelope[(size_t) i] = std::exp (-s.decay * 6.0f * t);
+                }
+                decayed.own (numChannels, N);
+                forEachChannel (numChannels, [&] (int c)
+                {
+                    const float* src = stretched.out[(size_t) c];
+                    float* dst = decayed.store[(size_t) c].data();
+                    for (int i = 0; i < N; ++i)
+                        dst[i] = src[i] * envelope[(size_t) i];
+                });
+            }
+            else
+            {
+                decayed.passThrough (stretched.out, 0, N);
+            }
+            decayed.key = key;
+            decayed.valid = lastRun.decay = true;
+        }
+    }
+
+    // Silence trim: drop the tail below −90 dB re peak (plus 500 ms). Synth
+    // IRs were trimmed before their raw copy was kept, so for them this only
+    // scans.
+    {
+        const Key key = SynthStageCache::KeyBuilder ("trim").add (decayed.key).add (sampleRate).get();
+        if (! trimmed.valid || trimmed.key != key)
+        {
+            const int n = decayed.length;
+            const int newLen = findTrimLength (decayed.out.data(), numChannels, n, sampleRate);
+            if (newLen < n)
+            {
+                trimmed.own (numChannels, newLen);
+                forEachChannel (numChannels, [&] (int c)
+                {
+                    std::memcpy (trimmed.store[(size_t) c].data(), decayed.out[(size_t) c],
+                                 (size_t) newLen * sizeof (float));
+                });
+                std::vector<float*> dst ((size_t) numChannels);
+                for (int c = 0; c < numChannels; ++c)
+                    dst[(size_t) c] = trimmed.store[(size_t) c].data();
+                fadeOutEnd (dst.data(), numChannels, newLen, sampleRate);
+            }
+            else
+            {
+                trimmed.passThrough (decayed.out, 0, n);
+            }
+            trimmed.key = key;
+            trimmed.valid = lastRun.trim = true;
+        }
+    }
+
+    // Expansion: mono / stereo → true-stereo LL, RL, LR, RR. The cross
+    // channels are zero; LL / RR are scaled ×0.5 to cancel processBlock's ×2
+    // true-stereo wet gain, then −15 dB (juce::Decibels::decibelsToGain) trims
+    // file IRs to the synth IRs' level.
+    {
+        const Key key = SynthStageCache::KeyBuilder ("expand").add (trimmed.key).get();
+        if (! expanded.valid || expanded.key != key)
+        {
+            const int n = trimmed.length;
+            if (numChannels < 4)
+            {
+                const float fileGain = std::pow (10.0f, -15.0f * 0.05f);
+                const int srcR = numChannels >= 2 ? 1 : 0;
+                expanded.own (4, n);
+                forEachChannel (4, [&] (int c)
+                {
+                    float* dst = expanded.store[(size_t) c].data();
+                    if (c == 1 || c == 2)
+                    {
+                        std::fill (dst, dst + n, 0.0f);
+                        return;
+                    }
+                    const float* src = trimmed.out[(size_t) (c == 0 ? 0 : srcR)];
+                    for (int i = 0; i < n; ++i)
+                        dst[i] = (src[i] * 0.5f) * fileGain;
+                });
+            }
+            else
+            {
+                std::vector<const float*> first4 (trimmed.out.begin(), trimmed.out.begin() + 4);
+                expanded.passThrough (first4, 0, n);
+            }
+            expanded.key = key;
+            expanded.valid = lastRun.expand = true;
+        }
+    }
+
+    // ER / Tail split at the crossover: ER runs on fadeSeconds past it with a
+    // linear fade-out, the Tail starts there with the matching fade-in. ER-only
+    // synth IRs put everything in the ER and leave a short silent Tail.
+    {
+        const int fullLen = expanded.length;
+        crossoverSamples = s.erOnly ? fullLen : (int) (s.crossoverSeconds * sampleRate);
+        const int fadeLength = (int) (s.fadeSeconds * sampleRate);
+        const Key key = SynthStageCache::KeyBuilder ("split").add (expanded.key)
+                            .add (crossoverSamples).add (fadeLength).add (s.erOnly).get();
+        if (! splitValid || splitKey != key)
+        {
+            const int xo = crossoverSamples;
+            forEachChannel (4, [&] (int c)
+            {
+                const float* src = expanded.out[(size_t) c];
+
+                auto& e = er[(size_t) c];
+                const int erLen = fullLen <= xo ? fullLen : xo + fadeLength;
+                e.assign ((size_t) erLen, 0.0f);
+                std::copy (src, src + std::min (erLen, fullLen), e.begin());
+                if (fullLen > xo)
+                    for (int i = 0; i < fadeLength && (xo + i) < erLen; ++i)
+                        e[(size_t) (xo + i)] *= 1.0f - (float) i / (float) fadeLength;
+
+                auto& t = tail[(size_t) c];
+                if (s.erOnly || fullLen <= xo)
+                {
+                    t.assign ((size_t) std::max (64, fadeLength * 2), 0.0f);
+                    return;
+                }
+                const int tailLen = fullLen - xo;
+                t.assign (src + xo, src + fullLen);
+                for (int i = 0; i < std::min (fadeLength, tailLen); ++i)
+                    t[(size_t) i] *= (float) i / (float) fadeLength;
+            });
+            splitKey = key;
+            splitValid = lastRun.split = true;
+        }
+    }
+}
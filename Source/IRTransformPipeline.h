@@ -0,0 +1,140 @@
+#pragma once
+
+#include "SynthStageCache.h"
+#include "SynthTaskPool.h"
+#include <array>
+#include <cstdint>
+#include <vector>
+
+// ── IRTransformPipeline ─────────────────────────────────────────────────────
+// The IR transform chain of PingProcessor::loadIRFromBuffer (Docs §4) for one
+// mic path, as a chain of memoised stages:
+//
+//   input → reverse → stretch → decay → silence trim → 4-channel expansion
+//         → ER / Tail split
+//
+// Reverse trim is not a stage of its own: it is an offset into the reversed
+// buffer that the stretch stage reads from.
+//
+// Each stage keeps its output from the previous run() together with a key
+// (SynthStageCache::KeyBuilder) of the upstream stage's key plus the
+// settings it reads. A stage whose key is unchanged is reused, so dragging
+// Decay reruns decay onwards from the cached stretched buffer, and moving
+// Reverse Trim re-stretches from the cached reversed buffer. The input stage
+// compares the new samples with the last ones, so reloading the same file or
+// raw synth buffer costs one compare.
+//
+// A stage that would not change its input (reverse off, stretch 1.0, no
+// decay, nothing to trim, a 4-channel IR) passes its input's channels
+// through without copying. Stage storage is kept between runs and only grows,
+// so a parameter sweep over one IR does not allocate after the first call.
+// release() frees it; PingProcessor calls it wherever it unloads the path's
+// convolver kernels (clearMicPath, hibernation).
+//
+// The per-channel loops of every stage run in parallel on pool(), a small
+// pool of its own: waiting on the shared SynthTaskPool from the message
+// thread could pick up a whole mic-path synthesis task. Every channel is
+// computed by the same code in any order, so results are bit-identical to a
+// serial run. Not thread-safe; each instance belongs to one mic path and
+// is run from the message thread.
+//
+// Pure C++ — no JUCE dependency — so PingTests checks it against the serial
+// chain (DSP_26).
+// ───────────────────────────────────────────────────────────────────────────
+class IRTransformPipeline
+{
+public:
+    struct Settings
+    {
+        bool   reverse = false;
+        float  reverseTrim = 0.0f;      // 0..0.95 of the reversed IR skipped
+        float  stretch = 1.0f;          // 0.5..2.0
+        float  decay = 0.0f;            // damping, 1 − UI Decay (0 = flat)
+        double crossoverSeconds = 0.080;
+        double fadeSeconds = 0.010;
+        bool   erOnly = false;          // synth ER-only IR: all ER, empty tail
+    };
+
+    /** Which stages the last run() computed; false = reused. */
+    struct RunStats
+    {
+        bool input = false, reverse = false, stretch = false, decay = false,
+             trim = false, expand = false, split = false;
+    };
+
+    IRTransformPipeline() = default;
+
+    /** Runs the chain on numChannels planar channels of numSamples each
+        (numSamples > 0). Stages whose inputs are unchanged since the last
+        run are reused. */
+    void run (const float* const* channels, int numChannels, int numSamples,
+              double sampleRate, const Settings& settings);
+
+    /** The trimmed IR before expansion (the waveform display's copy). */
+    int getNumDisplayChannels() const noexcept          { return (int) trimmed.out.size(); }
+    const float* getDisplayChannel (int c) const noexcept { return trimmed.out[(size_t) c]; }
+
+    /** Length of the final IR, and of the IR after stretch (the decay
+        envelope's length). */
+    int getLength() const noexcept          { return trimmed.length; }
+    int getStretchedLength() const noexcept { return stretched.length; }
+    int getCrossoverSamples() const noexcept { return crossoverSamples; }
+
+    /** ER and Tail kernels in true-stereo order LL, RL, LR, RR, at the
+        input's sample rate. */
+    const std::vector<float>& getEr (int c) const noexcept   { return er[(size_t) c]; }
+    const std::vector<float>& getTail (int c) const noexcept { return tail[(size_t) c]; }
+
+    const RunStats& getLastRun() const noexcept { return lastRun; }
+
+    /** Frees every stage's storage; the next run() computes everything. */
+    void release();
+
+    /** Trims trailing silence (below −90 dB re peak, +500 ms, at least
+        300 ms) in place and fades the new end out over 500 ms. Returns the
+        new length; equal to numSamples (and nothing faded) when there is
+        nothing to trim. */
+    static int trimTrailingSilence (float* const* channels, int numChannels, int numSamples,
+                                    double sampleRate);
+
+    /** Pool the per-channel work runs on: up to three workers plus the
+        calling thread, one per true-stereo channel. */
+    static SynthTaskPool& pool();
+
+private:
+    using Key = SynthStageCache::Key;
+
+    struct Stage
+    {
+        std::vector<std::vector<float>> store;   // own output, when not passing through
+        std::vector<const float*> out;           // output channels (own or upstream)
+        int length = 0;
+        Key key = 0;
+        bool valid = false;
+
+        // Sizes store to numChannels × length (never shrinking capacity) and
+        // points out at it.
+        void own (int numChannels, int length);
+        // Points out at the given channels without copying.
+        void passThrough (const std::vector<const float*>& channels, int offset, int length);
+    };
+
+    static int findTrimLength (const float* const* channels, int numChannels, int numSamples,
+                               double sampleRate);
+    static void fadeOutEnd (float* const* channels, int numChannels, int length, double sampleRate);
+
+    bool updateInput (const float* const* channels, int numChannels, int numSamples, double sampleRate);
+
+    Stage input, reversed, stretched, decayed, trimmed, expanded;
+    Key splitKey = 0;
+    bool splitValid = false;
+    uint64_t inputGeneration = 0;
+    double sampleRate = 0.0;
+    int crossoverSamples = 0;
+    std::vector<float> envelope;
+    std::array<std::vector<float>, 4> er, tail;
+    RunStats lastRun;
+
+    IRTransformPipeline (const IRTransformPipeline&) = delete;
+    IRTransformPipeline& operator= (const IRTransformPipeline&) = delete;
+};
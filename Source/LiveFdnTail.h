@@ -0,0 +1,340 @@
+#pragma once
+
+#include "FdnKernel.h"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <memory>
+#include <vector>
+
+// ── LiveFdnTail ─────────────────────────────────────────────────────────────
+// Real-time stand-in for the convolved tail of a synthesised IR (PingProcessor
+// live-tail mode). Instead of convolving the input with the FDN tail that
+// renderFDNTail rendered offline, the same network runs on the audio:
+//
+//   in L + R ─► seed diffusion ─┬─► Lines16 (left mic)  ─► diffuser ─► × gainL ─► += out L
+//                               └─► Lines16 (right mic) ─► diffuser ─► × gainR ─► += out R
+//
+//   • The two networks are IRSynthEngine::designPathFDN's — the delays, LFOs
+//     and loss filters synthIR used for the path, from the same calcRT60
+//     bands. Designing at (processing rate × Stretch) stretches the tail
+//     exactly as the IR Stretch control resamples it; the Decay control
+//     becomes extra per-line loss (Design::extraDecayPerSample).
+//   • Both networks take L + R: synthIR adds the left tail equally to iLL
+//     and iRL, so the convolved tail bus is (L + R) ∗ tail. The seed
+//     diffusion is synthMainPath's three-stage cascade (short 0.8 → long
+//     g 0.62 → short 0.8), shared by both sides because their input is
+//     identical; the output diffuser is makeAllpassDiffuser (diffusion).
+//   • The right network reads its output from line 1 rather than line 0 so
+//     the two sides stay decorrelated (offline they are seeded by different
+//     mic signals).
+//   • Level: the offline tail is further scaled by the ER/tail level match,
+//     the modal bank and the output gain. calibrate() folds all of that into
+//     one gain per side by matching the network's impulse-response energy
+//     to the tail kernel's over a window once the longest line has cycled.
+//
+// Not reproduced: the modal bank's low-frequency resonances, the ER residual
+// floor (erFloor) and the offline warm-up, so the live tail builds up from
+// the first recirculation instead of starting dense at the ER crossover.
+// IR_53 bounds the decay-curve deviation against the convolved tail.
+//
+// Cost is two Lines16 steps and eight allpass stages per sample, whatever
+// the RT60. Pure header — no JUCE dependency — so the test binary links it.
+// ───────────────────────────────────────────────────────────────────────────
+class LiveFdnTail
+{
+public:
+    /** Four-stage Schroeder allpass — same recursion as
+        IRSynthEngine::AllpassDiffuser::process. */
+    class Allpass4
+    {
+    public:
+        void prepare (double gain, const std::array<double, 4>& delaySeconds, double sampleRate)
+        {
+            g = gain;
+            for (size_t i = 0; i < 4; ++i)
+            {
+                const int d = std::max (1, (int) std::round (sampleRate * delaySeconds[i]));
+                bufs[i].assign ((size_t) d, 0.0);
+                ptrs[i] = 0;
+            }
+        }
+
+        void reset()
+        {
+            for (size_t i = 0; i < 4; ++i)
+            {
+                std::fill (bufs[i].begin(), bufs[i].end(), 0.0);
+                ptrs[i] = 0;
+            }
+        }
+
+        double process (double x) noexcept
+        {
+            double s = x;
+            for (size_t i = 0; i < 4; ++i)
+            {
+                auto& buf = bufs[i];
+                const int p = ptrs[i];
+                const double delayed = buf[(size_t) p];
+                const double w = s + g * delayed;
+                buf[(size_t) p] = w;
+                ptrs[i] = (p + 1 == (int) buf.size()) ? 0 : p + 1;
+                s = -g * w + delayed;
+            }
+            return s;
+        }
+
+    private:
+        double g = 0.0;
+        std::array<std::vector<double>, 4> bufs;
+        std::array<int, 4> ptrs {};
+    };
+
+    struct Design
+    {
+        std::array<FdnKernel::Config, 2> lines;   // left, right (IRSynthEngine::designPathFDN)
+        double designRate = 48000.0;              // rate the lines were designed at
+        double diffusion = 0.0;                   // IRSynthParams::diffusion
+        double extraDecayPerSample = 0.0;         // nepers per processed sample (Decay control)
+        int onsetSamples = 0;                     // input delay: the ER / Tail crossover, processed samples
+    };
+
+    /** Message thread. Builds the networks and diffusers and clears all state. */
+    void prepare (const Design& d)
+    {
+        design = d;
+        for (size_t s = 0; s < 2; ++s)
+            for (int i = 0; i < FdnKernel::kNumLines; ++i)
+                design.lines[s].gain[(size_t) i] *= std::exp (-d.extraDecayPerSample * design.lines[s].delay[(size_t) i]);
+
+        const double sr = d.designRate;
+        const double shortG = 0.5 + 0.80 * 0.25;   // makeAllpassDiffuser (sr, 0.80)
+        seedShortA.prepare (shortG, kShortDelays, sr);
+        seedLong  .prepare (0.62,   kLongDelays,  sr);
+        seedShortB.prepare (shortG, kShortDelays, sr);
+        postDiffuse = d.diffusion > 0.02;
+        for (auto& ap : post)
+            ap.prepare (0.5 + d.diffusion * 0.25, kShortDelays, sr);
+
+        splitCoeff = 1.0 - std::exp (-2.0 * 3.141592653589793 * kSplitHz / sr);
+
+        longestDelay = 0;
+        for (const auto& c : design.lines)
+            for (int i = 0; i < FdnKernel::kNumLines; ++i)
+                longestDelay = std::max (longestDelay, c.delay[(size_t) i]);
+
+        onset.assign ((size_t) std::max (0, d.onsetSamples), 0.0);
+
+        reset();
+        prepared = true;
+    }
+
+    /** Clears the networks and diffusers; keeps the design and gains. */
+    void reset()
+    {
+        for (size_t s = 0; s < 2; ++s)
+            lines[s].prepare (design.lines[s]);
+        lines[1].setOutputLine (1);
+        seedShortA.reset();
+        seedLong.reset();
+        seedShortB.reset();
+        for (auto& ap : post)
+            ap.reset();
+        low = {};
+        std::fill (onset.begin(), onset.end(), 0.0);
+        onsetPos = 0;
+    }
+
+    bool isPrepared() const noexcept { return prepared; }
+
+    /** Output level of one side, below and above kSplitHz (calibrate()). */
+    static constexpr double kSplitHz = 1000.0;
+    struct SideGain { double low = 1.0, high = 1.0; };
+    void setOutputGains (SideGain left, SideGain right) noexcept { gain = { left, right }; }
+    std::array<SideGain, 2> getOutputGains() const noexcept { return gain; }
+
+    /** Longest delay line, in samples (calibration window start). */
+    int getLongestDelay() const noexcept { return longestDelay; }
+
+    /** Audio thread. Adds the tail of (inL + inR) into outL / outR, starting
+        Design::onsetSamples after the input, where the convolved Tail starts. */
+    void process (const float* inL, const float* inR, float* outL, float* outR, int numSamples) noexcept
+    {
+        for (int n = 0; n < numSamples; ++n)
+        {
+            double x = (double) inL[n] + (double) inR[n];
+            if (! onset.empty())
+            {
+                std::swap (x, onset[(size_t) onsetPos]);
+                if (++onsetPos == (int) onset.size())
+                    onsetPos = 0;
+            }
+            const auto y = tick (x);
+            outL[n] += (float) y[0];
+            outR[n] += (float) y[1];
+        }
+    }
+
+    /** Left / right response to a unit impulse on one input, numSamples
+        long, without the onset delay (aligned with the tail kernels). Runs
+        the live state, so call reset() afterwards. */
+    std::array<std::vector<double>, 2> impulseResponse (int numSamples)
+    {
+        std::array<std::vector<double>, 2> h;
+        h[0].resize ((size_t) numSamples);
+        h[1].resize ((size_t) numSamples);
+        for (int n = 0; n < numSamples; ++n)
+        {
+            const auto y = tick (n == 0 ? 1.0 : 0.0);
+            h[0][(size_t) n] = y[0];
+            h[1][(size_t) n] = y[1];
+        }
+        return h;
+    }
+
+    /** Sets the output gains so the live tail carries the same energy as the
+        convolved tail kernels refL (LL: left input → left bus) and refR (LR:
+        left input → right bus), below and above kSplitHz, over ~0.5 s
+        starting once every line has recirculated twice (at least 150 ms).
+        The two-band match restores the spectral tilt of the offline seed
+        (image sources after wall and air absorption) that a white input
+        lacks; without it the broadband decay runs 10–20 % fast because the
+        quickly decaying HF lines carry too much of the early energy. Both
+        kernels are at the processing rate. Leaves the state cleared. */
+    void calibrate (const float* refL, int refLenL, const float* refR, int refLenR, double processRate)
+    {
+        gain = { SideGain{}, SideGain{} };
+        const int refLen = std::min (refLenL, refLenR);
+        int start = std::max ((int) std::round (0.15 * processRate), 2 * longestDelay);
+        int end   = std::min (refLen, start + (int) std::round (0.5 * processRate));
+        if (end - start < (int) std::round (0.05 * processRate))
+        {
+            // Short tail: use whatever follows the FDN's first output.
+            start = std::min (longestDelay, std::max (refLen - 1, 0));
+            end   = refLen;
+        }
+
+        const auto h = impulseResponse (std::max (end, 1));
+        const float* ref[2] = { refL, refR };
+        auto ratio = [] (double eRef, double eLive) { return eLive > 1e-30 ? std::sqrt (eRef / eLive) : 0.0; };
+        for (size_t s = 0; s < 2; ++s)
+        {
+            double lpRef = 0.0, lpLive = 0.0;
+            double eRef[2] {}, eLive[2] {};
+            for (int n = 0; n < end; ++n)
+            {
+                const double r = ref[s][n], v = h[s][(size_t) n];
+                lpRef  += splitCoeff * (r - lpRef);
+                lpLive += splitCoeff * (v - lpLive);
+                if (n < start)
+                    continue;
+                eRef[0]  += lpRef * lpRef;
+                eRef[1]  += (r - lpRef) * (r - lpRef);
+                eLive[0] += lpLive * lpLive;
+                eLive[1] += (v - lpLive) * (v - lpLive);
+            }
+            gain[s] = { ratio (eRef[0], eLive[0]), ratio (eRef[1], eLive[1]) };
+        }
+        reset();
+    }
+
+private:
+    std::array<double, 2> tick (double x) noexcept
+    {
+        const double seed = seedShortB.process (seedLong.process (seedShortA.process (x)));
+        std::array<double, 2> y;
+        for (size_t s = 0; s < 2; ++s)
+        {
+            double v = lines[s].step (seed);
+            if (postDiffuse)
+                v = post[s].process (v);
+            low[s] += splitCoeff * (v - low[s]);
+            y[s] = low[s] * gain[s].low + (v - low[s]) * gain[s].high;
+        }
+        return y;
+    }
+
+    // makeAllpassDiffuser (17.1 / 6.3 / 2.3 / 0.8 ms) and synthMainPath's
+    // long seed stage (31.7 / 17.3 / 11.2 / 5.7 ms).
+    static constexpr std::array<double, 4> kShortDelays { 0.0171, 0.0063, 0.0023, 0.0008 };
+    static constexpr std::array<double, 4> kLongDelays  { 0.0317, 0.0173, 0.0112, 0.0057 };
+
+    Design design;
+    std::array<FdnKernel::Lines16, 2> lines;
+    Allpass4 seedShortA, seedLong, seedShortB;
+    std::array<Allpass4, 2> post;
+    bool postDiffuse = false, prepared = false;
+    int longestDelay = 0;
+    double splitCoeff = 1.0;                 // one-pole low-pass at kSplitHz
+    std::array<double, 2> low {};
+    std::array<SideGain, 2> gain {};
+    std::vector<double> onset;               // input delay line (Design::onsetSamples)
+    int onsetPos = 0;
+};
+
+// ── LiveFdnTailSlot ─────────────────────────────────────────────────────────
+// One mic path's live tail, handed from the message thread to the audio
+// thread with the same pending / retired hand-off as ScratchArena and
+// TrueStereoConvolver: publish() fills `pending`, the audio thread swaps it
+// in at the top of a block (adoptPending) and parks the old one in
+// `retired`, which the message thread frees (releaseRetired). A pending
+// tail is not adopted while `retired` is still occupied, so nothing is ever
+// freed on the audio thread. Publishing an unprepared tail switches the
+// path back to plain convolution.
+// ───────────────────────────────────────────────────────────────────────────
+class LiveFdnTailSlot
+{
+public:
+    LiveFdnTailSlot() = default;
+    ~LiveFdnTailSlot()
+    {
+        delete pending.exchange (nullptr);
+        delete retired.exchange (nullptr);
+        delete active;
+    }
+
+    /** Message thread. Replaces any tail not yet adopted. */
+    void publish (std::unique_ptr<LiveFdnTail> tail)
+    {
+        published = tail != nullptr && tail->isPrepared();
+        delete pending.exchange (tail.release(), std::memory_order_acq_rel);
+    }
+
+    /** Message thread: whether the last publish() switched the live tail on. */
+    bool isPublished() const noexcept { return published; }
+
+    /** Message thread. */
+    void releaseRetired()
+    {
+        delete retired.exchange (nullptr, std::memory_order_acq_rel);
+    }
+
+    /** Audio thread, top of the block. */
+    void adoptPending() noexcept
+    {
+        if (retired.load (std::memory_order_acquire) != nullptr)
+            return;
+        auto* fresh = pending.exchange (nullptr, std::memory_order_acq_rel);
+        if (fresh == nullptr)
+            return;
+        retired.store (active, std::memory_order_release);
+        active = fresh;
+    }
+
+    /** Audio thread. The live tail to run, or nullptr (convolved tail). */
+    LiveFdnTail* get() const noexcept
+    {
+        return active != nullptr && active->isPrepared() ? active : nullptr;
+    }
+
+private:
+    std::atomic<LiveFdnTail*> pending { nullptr }, retired { nullptr };
+    LiveFdnTail* active = nullptr;   // audio thread only
+    bool published = false;          // message thread only
+
+    LiveFdnTailSlot (const LiveFdnTailSlot&) = delete;
+    LiveFdnTailSlot& operator= (const LiveFdnTailSlot&) = delete;
+};
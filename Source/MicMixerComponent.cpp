@@ -275,6 +275,34 @@ void MicMixerComponent::layoutStrip (Strip& s, juce::Rectangle<int> area)
     s.hpBtn  .setBounds (b3);
 }
 
+// ── Path hibernation menu ───────────────────────────────────────────────────
+// Name labels and readouts pass clicks through, so a right-click anywhere
+// outside the controls lands here.
+void MicMixerComponent::mouseDown (const juce::MouseEvent& e)
+{
+    if (e.mods.isPopupMenu())
+        showHibernateMenu();
+}
+
+void MicMixerComponent::showHibernateMenu()
+{
+    static constexpr double kSeconds[] { 0.0, 10.0, 30.0, 60.0, 300.0 };
+    static const char* const kLabels[] { "Never", "After 10 s", "After 30 s", "After 1 min", "After 5 min" };
+
+    juce::PopupMenu menu;
+    menu.addSectionHeader ("Release IR of switched-off strips");
+    const double current = processor.getPathHibernateSeconds();
+    for (int i = 0; i < 5; ++i)
+        menu.addItem (i + 1, kLabels[i], true, current == kSeconds[i]);
+
+    menu.showMenuAsync (juce::PopupMenu::Options().withTargetComponent (this),
+                        [safe = juce::Component::SafePointer<MicMixerComponent> (this)] (int result)
+                        {
+                            if (safe != nullptr && result > 0)
+                                safe->processor.setPathHibernateSeconds (kSeconds[result - 1]);
+                        });
+}
+
 // ── Timer ───────────────────────────────────────────────────────────────────
 void MicMixerComponent::timerCallback()
 {
@@ -15,6 +15,9 @@
  * All controls bind to APVTS parameters added in C7. Peak meters are driven
  * from the processor's per-path atomic peaks at ~30 Hz via an internal timer.
  *
+ * Right-clicking the mixer sets how long a switched-off DIRECT / OUTRIG /
+ * AMBIENT strip keeps its IR loaded (PingProcessor path hibernation).
+ *
  * Layout is fixed for 300×153 (the former OutputLevelMeter footprint) but
  * scales proportionally if resized.
  */
@@ -27,6 +30,7 @@ public:
 
     void paint    (juce::Graphics&) override;
     void resized()                   override;
+    void mouseDown (const juce::MouseEvent& e) override;
 
 private:
     void timerCallback() override;
@@ -82,6 +86,7 @@ private:
     void layoutStrip (Strip& s, juce::Rectangle<int> area);
     void paintStripChrome (juce::Graphics& g, const Strip& s, const StripIDs& ids);
     void paintMeters (juce::Graphics& g, const Strip& s);
+    void showHibernateMenu();
 
     PingProcessor& processor;
     std::array<Strip, 4>    strips;
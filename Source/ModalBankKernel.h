@@ -0,0 +1,213 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+#if defined(__AVX__)
+ #include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64)
+ #include <emmintrin.h>
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+ #include <arm_neon.h>
+#endif
+
+// ── ModalBankKernel ─────────────────────────────────────────────────────────
+// Fused modal resonator bank for IRSynthEngine::applyModalBank.
+//
+// The bank is a set of high-Q bandpass biquads (one per room mode) run in
+// parallel on each IR channel and summed back into it:
+//
+//     out = x + norm · Σₘ gainₘ · bpₘ(x)
+//
+// The engine used to run one full-length biquad pass per mode per channel,
+// each into a freshly allocated buffer. This kernel does the whole bank in
+// one streaming pass over the channels:
+//
+//   • The four channels (LL, RL, LR, RR) are the four lanes of one vector
+//     (AVX: 1 × 4, SSE2 / NEON: 2 × 2, else scalar). A mode's coefficients
+//     are broadcast, so each mode costs one vector biquad for all channels.
+//   • The channels are processed in blocks of kBlock frames. Input frames
+//     and the mode sum for a block live on the stack (L1); modes run over the
+//     block kModeGroup at a time with their y history held in registers, so
+//     the groups' recursions overlap instead of stalling on one chain.
+//   • The input history (x₁, x₂) is shared by every mode; only y₁, y₂ are
+//     per mode. There is no buffer the size of the IR.
+//
+// Per sample, each lane evaluates y = b0·x + b2·x₂ − a1·y₁ − a2·y₂ and adds
+// y · gain to the mode sum in mode order, which is exactly the old
+// per-mode loop; IR_54 checks the result against it. Pure header — no JUCE
+// dependency — so the test binary links it directly.
+// ───────────────────────────────────────────────────────────────────────────
+namespace ModalBankKernel
+{
+    constexpr int kNumChannels = 4;
+    constexpr int kBlock       = 256;   // frames per streaming block
+    constexpr int kModeGroup   = 4;     // modes whose state shares registers
+
+    /** One resonator: bandpass coefficients (b1 = 0) and its output gain. */
+    struct Resonator
+    {
+        double b0 = 0.0, b2 = 0.0, a1 = 0.0, a2 = 0.0;
+        double gain = 0.0;
+    };
+
+    /** Bandpass at fc with quality Q (the RBJ constant-peak design the engine
+        uses for its octave filters, with an explicit Q). */
+    inline Resonator design (double fc, double Q, double gain, int sr) noexcept
+    {
+        const double K = std::tan (3.141592653589793 * fc / (double) sr);
+        const double n = 1.0 / (1.0 + K / Q + K * K);
+        Resonator r;
+        r.b0 = K / Q * n;
+        r.b2 = -r.b0;
+        r.a1 = 2.0 * (K * K - 1.0) * n;
+        r.a2 = (1.0 - K / Q + K * K) * n;
+        r.gain = gain;
+        return r;
+    }
+
+    /** Four lanes of doubles, one per channel. */
+    struct V4
+    {
+       #if defined(__AVX__)
+        __m256d v;
+        static V4 load (const double* p) noexcept          { return { _mm256_load_pd (p) }; }
+        static V4 set1 (double x) noexcept                 { return { _mm256_set1_pd (x) }; }
+        void store (double* p) const noexcept              { _mm256_store_pd (p, v); }
+        friend V4 operator+ (V4 a, V4 b) noexcept          { return { _mm256_add_pd (a.v, b.v) }; }
+        friend V4 operator- (V4 a, V4 b) noexcept          { return { _mm256_sub_pd (a.v, b.v) }; }
+        friend V4 operator* (V4 a, V4 b) noexcept          { return { _mm256_mul_pd (a.v, b.v) }; }
+       #elif defined(__SSE2__) || defined(_M_X64)
+        __m128d lo, hi;
+        static V4 load (const double* p) noexcept          { return { _mm_load_pd (p), _mm_load_pd (p + 2) }; }
+        static V4 set1 (double x) noexcept                 { return { _mm_set1_pd (x), _mm_set1_pd (x) }; }
+        void store (double* p) const noexcept              { _mm_store_pd (p, lo); _mm_store_pd (p + 2, hi); }
+        friend V4 operator+ (V4 a, V4 b) noexcept          { return { _mm_add_pd (a.lo, b.lo), _mm_add_pd (a.hi, b.hi) }; }
+        friend V4 operator- (V4 a, V4 b) noexcept          { return { _mm_sub_pd (a.lo, b.lo), _mm_sub_pd (a.hi, b.hi) }; }
+        friend V4 operator* (V4 a, V4 b) noexcept          { return { _mm_mul_pd (a.lo, b.lo), _mm_mul_pd (a.hi, b.hi) }; }
+       #elif defined(__ARM_NEON) && defined(__aarch64__)
+        float64x2_t lo, hi;
+        static V4 load (const double* p) noexcept          { return { vld1q_f64 (p), vld1q_f64 (p + 2) }; }
+        static V4 set1 (double x) noexcept                 { return { vdupq_n_f64 (x), vdupq_n_f64 (x) }; }
+        void store (double* p) const noexcept              { vst1q_f64 (p, lo); vst1q_f64 (p + 2, hi); }
+        friend V4 operator+ (V4 a, V4 b) noexcept          { return { vaddq_f64 (a.lo, b.lo), vaddq_f64 (a.hi, b.hi) }; }
+        friend V4 operator- (V4 a, V4 b) noexcept          { return { vsubq_f64 (a.lo, b.lo), vsubq_f64 (a.hi, b.hi) }; }
+        friend V4 operator* (V4 a, V4 b) noexcept          { return { vmulq_f64 (a.lo, b.lo), vmulq_f64 (a.hi, b.hi) }; }
+       #else
+        double v[4];
+        static V4 load (const double* p) noexcept          { return { { p[0], p[1], p[2], p[3] } }; }
+        static V4 set1 (double x) noexcept                 { return { { x, x, x, x } }; }
+        void store (double* p) const noexcept              { for (int i = 0; i < 4; ++i) p[i] = v[i]; }
+        friend V4 operator+ (V4 a, V4 b) noexcept          { for (int i = 0; i < 4; ++i) a.v[i] += b.v[i]; return a; }
+        friend V4 operator- (V4 a, V4 b) noexcept          { for (int i = 0; i < 4; ++i) a.v[i] -= b.v[i]; return a; }
+        friend V4 operator* (V4 a, V4 b) noexcept          { for (int i = 0; i < 4; ++i) a.v[i] *= b.v[i]; return a; }
+       #endif
+    };
+
+    /** Runs G consecutive modes over one block. xb holds two history frames
+        followed by the block's nb input frames; acc gets y · gain per mode. */
+    template <int G>
+    inline void runGroup (const Resonator* r, V4* y1s, V4* y2s,
+                          const double* xb, double* acc, int nb) noexcept
+    {
+        V4 b0[G], b2[G], a1[G], a2[G], g[G], y1[G], y2[G];
+        for (int m = 0; m < G; ++m)
+        {
+            b0[m] = V4::set1 (r[m].b0);
+            b2[m] = V4::set1 (r[m].b2);
+            a1[m] = V4::set1 (r[m].a1);
+            a2[m] = V4::set1 (r[m].a2);
+            g[m]  = V4::set1 (r[m].gain);
+            y1[m] = y1s[m];
+            y2[m] = y2s[m];
+        }
+        for (int f = 0; f < nb; ++f)
+        {
+            const V4 x  = V4::load (xb + (f + 2) * kNumChannels);
+            const V4 x2 = V4::load (xb + f * kNumChannels);
+            V4 a = V4::load (acc + f * kNumChannels);
+            for (int m = 0; m < G; ++m)
+            {
+                const V4 y = b0[m] * x + b2[m] * x2 - a1[m] * y1[m] - a2[m] * y2[m];
+                y2[m] = y1[m];
+                y1[m] = y;
+                a = a + y * g[m];
+            }
+            a.store (acc + f * kNumChannels);
+        }
+        for (int m = 0; m < G; ++m)
+        {
+            y1s[m] = y1[m];
+            y2s[m] = y2[m];
+        }
+    }
+
+    /** In place: ch[c][i] += norm · Σ gain · bp(ch[c]) for the first numCh
+        (1 … 4) channels, each n samples long. Unused lanes run on silence.
+        Float channels are widened on load and rounded once on store; the
+        recursion itself always runs in double. */
+    template <typename Sample>
+    inline void process (const std::vector<Resonator>& modes, double norm,
+                         Sample* const* ch, int numCh, size_t n)
+    {
+        numCh = std::clamp (numCh, 0, kNumChannels);
+        if (modes.empty() || numCh == 0)
+            return;
+
+        const int numModes = (int) modes.size();
+        std::vector<V4> y1 ((size_t) numModes, V4::set1 (0.0));
+        std::vector<V4> y2 ((size_t) numModes, V4::set1 (0.0));
+
+        alignas (32) double xb[(kBlock + 2) * kNumChannels] = {};
+        alignas (32) double acc[kBlock * kNumChannels];
+        const V4 vNorm = V4::set1 (norm);
+
+        for (size_t start = 0; start < n; start += kBlock)
+        {
+            const int nb = (int) std::min<size_t> (kBlock, n - start);
+            for (int f = 0; f < nb; ++f)
+                for (int c = 0; c < kNumChannels; ++c)
+                    xb[(f + 2) * kNumChannels + c] = c < numCh ? (double) ch[c][start + (size_t) f] : 0.0;
+            std::fill (acc, acc + nb * kNumChannels, 0.0);
+
+            int m = 0;
+            for (; m + kModeGroup <= numModes; m += kModeGroup)
+                runGroup<kModeGroup> (&modes[(size_t) m], &y1[(size_t) m], &y2[(size_t) m], xb, acc, nb);
+            switch (numModes - m)
+            {
+                case 3:  runGroup<3> (&modes[(size_t) m], &y1[(size_t) m], &y2[(size_t) m], xb, acc, nb); break;
+                case 2:  runGroup<2> (&modes[(size_t) m], &y1[(size_t) m], &y2[(size_t) m], xb, acc, nb); break;
+                case 1:  runGroup<1> (&modes[(size_t) m], &y1[(size_t) m], &y2[(size_t) m], xb, acc, nb); break;
+                default: break;
+            }
+
+            alignas (32) double out[kNumChannels];
+            for (int f = 0; f < nb; ++f)
+            {
+                const V4 x = V4::load (xb + (f + 2) * kNumChannels);
+                (x + V4::load (acc + f * kNumChannels) * vNorm).store (out);
+                for (int c = 0; c < numCh; ++c)
+                    ch[c][start + (size_t) f] = (Sample) out[c];
+            }
+
+            // The last two input frames are the next block's x₂ / x₁.
+            std::copy (xb + nb * kNumChannels, xb + (nb + 2) * kNumChannels, xb);
+        }
+    }
+
+    /** Instruction set V4 was compiled for (benchmarks / test logs). */
+    inline const char* isaName() noexcept
+    {
+       #if defined(__AVX__)
+        return "AVX";
+       #elif defined(__SSE2__) || defined(_M_X64)
+        return "SSE2";
+       #elif defined(__ARM_NEON) && defined(__aarch64__)
+        return "NEON";
+       #else
+        return "scalar";
+       #endif
+    }
+}
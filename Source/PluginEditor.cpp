@@ -118,6 +118,11 @@ PingEditor::PingEditor (PingProcessor& p)
       eqGraph (p.getAPVTS(), &p),
       waveformComponent (p)
 {
+    // Stretch / Decay / Reverse / trim edits reload the selected IR file and
+    // its siblings; keep their decoded audio so those reloads skip the disk.
+    // Process-wide and idempotent, so every editor instance may set it.
+    DecodedIRCache::shared().setBudgetBytes (DecodedIRCache::kInteractiveBudgetBytes);
+
     // Load images before setSize() so resized() can use them when it fires.
     bgTexture = juce::ImageCache::getFromMemory (BinaryData::texture_bg_jpg,
                                                   BinaryData::texture_bg_jpgSize);
@@ -231,6 +236,32 @@ PingEditor::PingEditor (PingProcessor& p)
         loadSelectedIR();
     };
 
+    // Live tail: synth IRs run their FDN tail on the audio instead of convolving it.
+    addAndMakeVisible (liveTailButton);
+    liveTailButton.setComponentID ("LiveTail");
+    liveTailButton.setClickingTogglesState (true);
+    liveTailButton.setColour (juce::TextButton::buttonColourId, juce::Colour (0xff1a1a1a));
+    liveTailButton.setColour (juce::TextButton::textColourOffId, juce::Colours::white);
+    liveTailButton.setColour (juce::TextButton::textColourOnId, juce::Colours::white);
+    liveTailButton.onClick = [this]
+    {
+        pingProcessor.setLiveTail (liveTailButton.getToggleState());
+        loadSelectedIR();
+    };
+
+    // Live shape: Decay and Stretch are applied by the convolver instead of reloading.
+    addAndMakeVisible (liveShapeButton);
+    liveShapeButton.setComponentID ("LiveShape");
+    liveShapeButton.setClickingTogglesState (true);
+    liveShapeButton.setColour (juce::TextButton::buttonColourId, juce::Colour (0xff1a1a1a));
+    liveShapeButton.setColour (juce::TextButton::textColourOffId, juce::Colours::white);
+    liveShapeButton.setColour (juce::TextButton::textColourOnId, juce::Colours::white);
+    liveShapeButton.onClick = [this]
+    {
+        pingProcessor.setLiveShape (liveShapeButton.getToggleState());
+        loadSelectedIR();
+    };
+
     addAndMakeVisible (irSynthButton);
     irSynthButton.setComponentID ("IRSynth");
     irSynthButton.setButtonText ("IR SYNTH");
@@ -268,21 +299,30 @@ PingEditor::PingEditor (PingProcessor& p)
     pingProcessor.setIRReplacedFromFileCallback ([this]
     {
         irSynthComponent.invalidatePendingSynth();
+        synthPreviewLoaded = false;
     });
 
-    irSynthComponent.setOnComplete ([this] (const IRSynthResult& result)
+    // The synth component renders in float (IRSynthResultF), the convolvers'
+    // own sample type, so the channels copy straight into the buffer.
+    irSynthComponent.setOnComplete ([this] (const IRSynthResultF& result)
     {
         if (! result.success || result.iLL.empty() || result.iRL.empty() || result.iLR.empty() || result.iRR.empty())
             return;
         const size_t N = result.iLL.size();
         juce::AudioBuffer<float> buf (4, (int) N);
-        for (size_t i = 0; i < N; ++i)
-        {
-            buf.setSample (0, (int) i, (float) result.iLL[i]);
-            buf.setSample (1, (int) i, (float) result.iRL[i]);
-            buf.setSample (2, (int) i, (float) result.iLR[i]);
-            buf.setSample (3, (int) i, (float) result.iRR[i]);
-        }
+        buf.copyFrom (0, 0, result.iLL.data(), (int) N);
+        buf.copyFrom (1, 0, result.iRL.data(), (int) N);
+        buf.copyFrom (2, 0, result.iLR.data(), (int) N);
+        buf.copyFrom (3, 0, result.iRR.data(), (int) N);
+
+        // Calculate IR delivers a quick preview first, then the full IR. The
+        // full one only refines what is already playing, so it is loaded as a
+        // refinement: a short shallow dip instead of the usual fade from
+        // silence.
+        const bool refinesPreview = synthPreviewLoaded && ! result.preview;
+        synthPreviewLoaded = result.preview;
+        pingProcessor.setIRLoadIsRefinement (refinesPreview);
+
         pingProcessor.setLastIRSynthParams (irSynthComponent.getLastRenderParams());
         pingProcessor.loadIRFromBuffer (std::move (buf), (double) result.sampleRate, true);
 
@@ -299,25 +339,23 @@ PingEditor::PingEditor (PingProcessor& p)
         // path was not synthesised (synthesised == false) we leave its raw buffer
         // and convolvers untouched — the processBlock mixer gates on the
         // *OnRaw APVTS flags, so unused convolvers are silent.
-        auto loadMicPath = [this, &result] (const MicIRChannels& mic, PingProcessor::MicPath path)
+        auto loadMicPath = [this, &result] (const MicIRChannelsF& mic, PingProcessor::MicPath path)
         {
             if (! mic.synthesised) return;
             if (mic.LL.empty() || mic.RL.empty() || mic.LR.empty() || mic.RR.empty()) return;
             const size_t M = mic.LL.size();
             juce::AudioBuffer<float> b (4, (int) M);
-            for (size_t i = 0; i < M; ++i)
-            {
-                b.setSample (0, (int) i, (float) mic.LL[i]);
-                b.setSample (1, (int) i, (float) mic.RL[i]);
-                b.setSample (2, (int) i, (float) mic.LR[i]);
-                b.setSample (3, (int) i, (float) mic.RR[i]);
-            }
+            b.copyFrom (0, 0, mic.LL.data(), (int) M);
+            b.copyFrom (1, 0, mic.RL.data(), (int) M);
+            b.copyFrom (2, 0, mic.LR.data(), (int) M);
+            b.copyFrom (3, 0, mic.RR.data(), (int) M);
             pingProcessor.loadIRFromBuffer (std::move (b), (double) result.sampleRate,
                                             /*fromSynth=*/true, /*deferConvolverLoad=*/false, path);
         };
         loadMicPath (result.direct,  PingProcessor::MicPath::Direct);
         loadMicPath (result.outrig,  PingProcessor::MicPath::Outrig);
         loadMicPath (result.ambient, PingProcessor::MicPath::Ambient);
+        pingProcessor.setIRLoadIsRefinement (false);
 
         irSynthComponent.setDirty (true);
         pingProcessor.setIRSynthDirty (true);
@@ -734,6 +772,8 @@ PingEditor::PingEditor (PingProcessor& p)
     refreshIRList();     // populates combo and restores selection (display only — no IR reload)
     refreshPresetList();
     reverseButton.setToggleState (pingProcessor.getReverse(), juce::dontSendNotification);
+    liveTailButton.setToggleState (pingProcessor.getLiveTail(), juce::dontSendNotification);
+    liveShapeButton.setToggleState (pingProcessor.getLiveShape(), juce::dontSendNotification);
     startTimerHz (8);
 }
 
@@ -757,7 +797,8 @@ void PingEditor::parameterChanged (const juce::String& parameterID, float)
     if (pingProcessor.getIsRestoringState())
         return;
 
-    if (parameterID == "stretch" || parameterID == "decay")
+    // Live shape: the convolver follows Stretch and Decay itself (processChunk).
+    if ((parameterID == "stretch" || parameterID == "decay") && ! pingProcessor.getLiveShape())
         loadSelectedIR();
 }
 
@@ -1393,6 +1434,11 @@ void PingEditor::resized()
             importIRButton.setBounds (irEiRightEdge - irEiBtnW, revBtnY, irEiBtnW, irEiBtnH);
             exportIRButton.setBounds (importIRButton.getX() - 4 - irEiBtnW, revBtnY, irEiBtnW, irEiBtnH);
 
+            // LIVE TAIL / LIVE SHAPE share the gap between REVERSE and Export IR.
+            const int liveBtnW = juce::jmin (revBtnW, (exportIRButton.getX() - reverseButton.getRight() - 12) / 2);
+            liveTailButton.setBounds  (reverseButton.getRight() + 4, revBtnY, liveBtnW, revBtnH);
+            liveShapeButton.setBounds (liveTailButton.getRight() + 4, revBtnY, liveBtnW, revBtnH);
+
             waveformComponent.setBounds (waveCentreX - wavePanelW / 2, waveformY,
                                          wavePanelW, wavePanelH);
         }
@@ -1783,6 +1829,8 @@ void PingEditor::loadPreset (const juce::String& name)
             pingProcessor.setLastPresetName (name);
             pingProcessor.snapshotCleanState();
             reverseButton.setToggleState (pingProcessor.getReverse(), juce::dontSendNotification);
+            liveTailButton.setToggleState (pingProcessor.getLiveTail(), juce::dontSendNotification);
+            liveShapeButton.setToggleState (pingProcessor.getLiveShape(), juce::dontSendNotification);
             irSynthComponent.setParams (pingProcessor.getLastIRSynthParams());
             updateIRComboSelection();
             updateWaveform();
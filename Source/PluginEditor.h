@@ -55,6 +55,8 @@ private:
     juce::TextButton importPresetButton { "Import" };
     juce::Label presetLabel;
     juce::TextButton reverseButton { "REVERSE" };
+    juce::TextButton liveTailButton { "LIVE TAIL" };
+    juce::TextButton liveShapeButton { "LIVE SHAPE" };
     juce::TextButton irSynthButton { "IR SYNTH" };
     juce::TextButton exportIRButton { "Export IR" };
     juce::TextButton importIRButton { "Import IR" };
@@ -138,6 +140,7 @@ private:
 
     WaveformComponent waveformComponent;
     IRSynthComponent irSynthComponent;
+    bool synthPreviewLoaded = false;   // the convolvers hold a Calculate IR preview awaiting its full pass
     MicMixerComponent micMixerComponent { pingProcessor };
     juce::Label licenceLabel;
     juce::Label versionLabel;
@@ -1,6 +1,7 @@
 #include "PluginProcessor.h"
 #include "PluginEditor.h"
 #include "PingBinaryData.h"
+#include "AllocationTrap.h"
 #include <sys/stat.h>
 
 // ── Source-radiation JSON loader (Phase 2 measured-instrument data) ───────
@@ -386,24 +387,39 @@ PingProcessor::PingProcessor()
 {
     for (auto* param : getParameters())
         param->addListener (this);
+    pathOnParamIndex[(size_t) MicPath::Direct]  = apvts.getParameter (IDs::directOn)->getParameterIndex();
+    pathOnParamIndex[(size_t) MicPath::Outrig]  = apvts.getParameter (IDs::outrigOn)->getParameterIndex();
+    pathOnParamIndex[(size_t) MicPath::Ambient] = apvts.getParameter (IDs::ambientOn)->getParameterIndex();
     irManager.refresh();
     loadStoredLicence();
 
     // Load measured-instrument radiation profiles (Phase 2). Idempotent on
     // name across repeated PluginProcessor instances within one process.
     loadInstrumentRadiationJson();
+
+    // Message-thread service for the processBlock scratch arena (frees retired arenas,
+    // publishes a larger one after an oversized host block).
+    startTimer (kScratchServiceIntervalMs);
 }
 
 PingProcessor::~PingProcessor()
 {
+    stopTimer();
     for (auto* param : getParameters())
         param->removeListener (this);
 }
 
-void PingProcessor::parameterValueChanged (int, float)
+void PingProcessor::parameterValueChanged (int parameterIndex, float newValue)
 {
     if (! isRestoringState.load())
         presetDirty.store (true);
+
+    // An aux strip switched on may be hibernated. This may run on the audio thread
+    // (automation), where posting a message could lock or allocate, so it only raises
+    // a flag; timerCallback wakes the path on the message thread.
+    if (newValue > 0.5f
+        && std::find (pathOnParamIndex.begin(), pathOnParamIndex.end(), parameterIndex) != pathOnParamIndex.end())
+        pathWakeRequested.store (true);
 }
 
 void PingProcessor::snapshotCleanState()
@@ -551,32 +567,25 @@ void PingProcessor::prepareToPlay (double sampleRate, int samplesPerBlock)
     spec.maximumBlockSize = (juce::uint32) samplesPerBlock;
     spec.numChannels = 2;
 
-    spec.numChannels = 1;  // True stereo convolvers are mono
-    tsErConvLL.reset(); tsErConvRL.reset(); tsErConvLR.reset(); tsErConvRR.reset();
-    tsTailConvLL.reset(); tsTailConvRL.reset(); tsTailConvLR.reset(); tsTailConvRR.reset();
-    tsErConvLL.prepare (spec); tsErConvRL.prepare (spec); tsErConvLR.prepare (spec); tsErConvRR.prepare (spec);
-    tsTailConvLL.prepare (spec); tsTailConvRL.prepare (spec); tsTailConvLR.prepare (spec); tsTailConvRR.prepare (spec);
-
-    // Multi-mic path convolvers (feature/multi-mic-paths) — reset + prepare with the same spec.
-    tsDirectConvLL.reset();   tsDirectConvRL.reset();   tsDirectConvLR.reset();   tsDirectConvRR.reset();
-    tsDirectConvLL.prepare (spec); tsDirectConvRL.prepare (spec); tsDirectConvLR.prepare (spec); tsDirectConvRR.prepare (spec);
-    tsOutrigErConvLL.reset();   tsOutrigErConvRL.reset();   tsOutrigErConvLR.reset();   tsOutrigErConvRR.reset();
-    tsOutrigTailConvLL.reset(); tsOutrigTailConvRL.reset(); tsOutrigTailConvLR.reset(); tsOutrigTailConvRR.reset();
-    tsOutrigErConvLL.prepare (spec);   tsOutrigErConvRL.prepare (spec);   tsOutrigErConvLR.prepare (spec);   tsOutrigErConvRR.prepare (spec);
-    tsOutrigTailConvLL.prepare (spec); tsOutrigTailConvRL.prepare (spec); tsOutrigTailConvLR.prepare (spec); tsOutrigTailConvRR.prepare (spec);
-    tsAmbErConvLL.reset();   tsAmbErConvRL.reset();   tsAmbErConvLR.reset();   tsAmbErConvRR.reset();
-    tsAmbTailConvLL.reset(); tsAmbTailConvRL.reset(); tsAmbTailConvLR.reset(); tsAmbTailConvRR.reset();
-    tsAmbErConvLL.prepare (spec);   tsAmbErConvRL.prepare (spec);   tsAmbErConvLR.prepare (spec);   tsAmbErConvRR.prepare (spec);
-    tsAmbTailConvLL.prepare (spec); tsAmbTailConvRL.prepare (spec); tsAmbTailConvLR.prepare (spec); tsAmbTailConvRR.prepare (spec);
-    spec.numChannels = 2;
-    tailConvolver.reset();
-    tailConvolver.prepare (spec);
+    // True-stereo convolution for every mic path. prepare() drops any loaded kernels
+    // and per-path workspaces; the callAsync at the end of this function reloads them
+    // at the new block size, skipping hibernated paths (they rebuild when woken).
+    trueStereoConv.prepare (samplesPerBlock);
 
-    // All convolvers were just reset + re-prepared — they are back to unity pass-through
-    // until loadImpulseResponse fires again via the callAsync posted at the end of this
+    // The tail workers are normal-priority threads. If one is starved past a tail
+    // deadline, wait at most a quarter of a block for it; after that the stage
+    // drops one partition rather than stall the callback (TrueStereoConvolver.h).
+    trueStereoConv.setTailWaitLimit (juce::roundToInt (0.25e6 * samplesPerBlock / sampleRate));
+
+    // Every per-block intermediate (dry copy, convolver I/O, Plate/Bloom/Cloud/Shimmer
+    // bridges) comes from this arena — processBlock itself never allocates.
+    scratch.prepare (samplesPerBlock);
+
+    // All convolvers were just reset + re-prepared — the mic paths carry no kernels
+    // until loadIRFromBuffer fires again via the callAsync posted at the end of this
     // function. Clear the per-path IR-loaded gates so processBlock's MAIN / Direct /
-    // Outrig / Ambient strips don't feed a full-level pass-through signal into the wet
-    // bus during the window between here and the async IR reload completing. Each flag
+    // Outrig / Ambient strips stay out of the wet bus during the window between here
+    // and the async IR reload completing. Each flag
     // will be re-asserted by its corresponding loadIRFromBuffer call, which also arms
     // irLoadFadeSamplesRemaining for the wet fade-in that masks the NUPC partial-swap.
     // Without this, a re-prepare (sample-rate change, PDC recompute, Logic track-switch
@@ -592,17 +601,23 @@ void PingProcessor::prepareToPlay (double sampleRate, int samplesPerBlock)
     // through the load path that re-arms the convolvers.
     for (auto& s : pathDisplayName) s = "<empty>";
 
-    // Reset the per-path convolver-ready trackers too. After reset() the convolvers
-    // are back to unity pass-through with no real engine installed, so their next
+    // Reset the per-path convolver-ready trackers too. After prepare() no path has
+    // kernels installed, so their next
     // readiness transition (once the deferred loadIRFromBuffer fires from the
     // callAsync at the end of prepareToPlay) will correctly re-arm the wet fade.
     mainConvPrevReady   .store (false);
     directConvPrevReady .store (false);
     outrigConvPrevReady .store (false);
     ambientConvPrevReady.store (false);
+    for (auto& w : pathWaking) w.store (false);
+    pathWakeFadeRemaining.fill (0);
 
     erLevelSmoothed.reset (sampleRate, 0.02);
     tailLevelSmoothed.reset (sampleRate, 0.02);
+    shapeDampingSmoothed.reset (sampleRate, 0.05);
+    shapeStretchSmoothed.reset (sampleRate, 0.05);
+    shapeDampingSmoothed.setCurrentAndTargetValue (1.0f - apvts.getRawParameterValue (IDs::decay)->load());
+    shapeStretchSmoothed.setCurrentAndTargetValue (apvts.getRawParameterValue (IDs::stretch)->load());
 
     // Per-path mixer strips — initialise current/target to the knob's linear gain so the
     // SmoothedValue does not create a 20 ms ramp on the very first processBlock call.
@@ -678,8 +693,6 @@ void PingProcessor::prepareToPlay (double sampleRate, int samplesPerBlock)
             }
         plateShelfState.fill (0.f);
     }
-    plateBuffer.setSize (2, samplesPerBlock);
-    plateBuffer.clear();
 
     // Bloom hybrid: 6 allpass stages with separate L/R prime delay sets.
     // Incommensurate primes produce genuinely independent L/R textures after feedback cycles.
@@ -708,8 +721,6 @@ void PingProcessor::prepareToPlay (double sampleRate, int samplesPerBlock)
             bloomFbWritePtrs[ch] = 0;
         }
     }
-    bloomBuffer.setSize (2, samplesPerBlock);
-    bloomBuffer.clear();
 
     // Cloud Granular Delay: 3-second capture buffer, variable-length grains.
     {
@@ -732,8 +743,6 @@ void PingProcessor::prepareToPlay (double sampleRate, int samplesPerBlock)
         cloudNextGrainSlot             = 0;
         cloudSpawnSeed                 = 12345u;
         cloudFbSamples.fill (0.f);
-        cloudBuffer.setSize (2, samplesPerBlock);
-        cloudBuffer.clear();
 
         // 4-stage all-pass diffusion cascade (Clouds TEXTURE-style grain-boundary smearing).
         // Delays are prime-number spaced and sub-15 ms to avoid audible echo.
@@ -796,8 +805,6 @@ void PingProcessor::prepareToPlay (double sampleRate, int samplesPerBlock)
             shimApLfoPhase[v] = (float)v * lfoPhaseStep * 1.3f;
         }
     }
-    shimBuffer.setSize (2, samplesPerBlock);
-    shimBuffer.clear();
     shimRng = 0x92d68ca2u;
     shimOnsetCounters.fill (0);
     shimWasEnabled = false;
@@ -859,6 +866,40 @@ void PingProcessor::releaseResources() {}
 void PingProcessor::processBlock (juce::AudioBuffer<float>& buffer, juce::MidiBuffer&)
 {
     juce::ScopedNoDenormals noDenormals;
+    ScopedAllocationTrap allocationTrap; // debug builds: assert on any heap access below
+
+    scratch.adoptPending();
+    trueStereoConv.adoptPending();   // kernels published by loadIRFromBuffer
+    for (auto* t : { &mainLiveTail, &outrigLiveTail, &ambientLiveTail })
+        t->adoptPending();           // live tails published by loadIRFromBuffer
+    const int numSamples = buffer.getNumSamples();
+    const int capacity   = scratch.capacity();
+    if (numSamples <= capacity)
+    {
+        processChunk (buffer);
+        return;
+    }
+
+    // Host block is larger than samplesPerBlock promised. Never reallocate here: ask the
+    // message thread for a bigger arena (picked up by adoptPending on a later block) and
+    // process this one in arena-sized slices. The non-owning sub-buffers use JUCE's
+    // preallocated channel-pointer space, so slicing is allocation-free.
+    scratch.requestCapacity (numSamples);
+    if (capacity <= 0)
+    {
+        buffer.clear();
+        return;
+    }
+    for (int start = 0; start < numSamples; start += capacity)
+    {
+        juce::AudioBuffer<float> chunk (buffer.getArrayOfWritePointers(), buffer.getNumChannels(),
+                                        start, juce::jmin (capacity, numSamples - start));
+        processChunk (chunk);
+    }
+}
+
+void PingProcessor::processChunk (juce::AudioBuffer<float>& buffer)
+{
     const int numSamples = buffer.getNumSamples();
     const int numChannels = buffer.getNumChannels();
     if (numChannels < 2) return;
@@ -869,6 +910,7 @@ void PingProcessor::processBlock (juce::AudioBuffer<float>& buffer, juce::MidiBu
         return;
     }
 
+    stageTimer.start();
     updateGains();
     updatePredelay();
     updateEQ();
@@ -883,8 +925,14 @@ void PingProcessor::processBlock (juce::AudioBuffer<float>& buffer, juce::MidiBu
             peakStore.store (current * 0.95f);
     };
 
+    // Per-block scratch views (non-owning — all storage is preallocated in prepareToPlay).
+    juce::AudioBuffer<float> dryBuffer   (scratch.channels (ScratchArena::DryL),   2, numSamples);
+    juce::AudioBuffer<float> plateBuffer (scratch.channels (ScratchArena::PlateL), 2, numSamples);
+    juce::AudioBuffer<float> bloomBuffer (scratch.channels (ScratchArena::BloomL), 2, numSamples);
+    juce::AudioBuffer<float> cloudBuffer (scratch.channels (ScratchArena::CloudL), 2, numSamples);
+    juce::AudioBuffer<float> shimBuffer  (scratch.channels (ScratchArena::ShimL),  2, numSamples);
+
     // Dry copy
-    juce::AudioBuffer<float> dryBuffer (numChannels, numSamples);
     dryBuffer.copyFrom (0, 0, buffer, 0, 0, numSamples);
     if (numChannels > 1)
         dryBuffer.copyFrom (1, 0, buffer, 1, 0, numSamples);
@@ -949,6 +997,7 @@ void PingProcessor::processBlock (juce::AudioBuffer<float>& buffer, juce::MidiBu
             buffer.setSample (ch, i, out);
         }
     }
+    stageTimer.lap (ProcessStageTimer::Input);
 
     // ——————————————————————————————————————————————————————————————————
     // Plate onset: parallel allpass diffuser cascade
@@ -1009,6 +1058,7 @@ void PingProcessor::processBlock (juce::AudioBuffer<float>& buffer, juce::MidiBu
         // plateBuffer not needed this block — zero it so post-convolution injection is silent
         plateBuffer.clear();
     }
+    stageTimer.lap (ProcessStageTimer::Plate);
 
     // ——————————————————————————————————————————————————————————————————
     // Bloom hybrid: pre-convolution allpass cascade (self-contained feedback loop)
@@ -1026,9 +1076,6 @@ void PingProcessor::processBlock (juce::AudioBuffer<float>& buffer, juce::MidiBu
         const float bloomTimeMs = juce::jlimit (50.f, 500.f, apvts.getRawParameterValue (IDs::bloomTime)->load());
         const float irFeed     = apvts.getRawParameterValue (IDs::bloomIRFeed)->load();
 
-        // Reallocate bloomBuffer if host delivers a larger-than-expected block
-        if (numSamples > bloomBuffer.getNumSamples())
-            bloomBuffer.setSize (2, numSamples, false, true, true);
         bloomBuffer.clear();
 
         // Separate L/R primes for stereo independence — same values as prepareToPlay
@@ -1079,9 +1126,9 @@ void PingProcessor::processBlock (juce::AudioBuffer<float>& buffer, juce::MidiBu
     else
     {
         // bloomBuffer not needed this block — zero it so post-convolution injection is silent
-        if (numSamples <= bloomBuffer.getNumSamples())
-            bloomBuffer.clear();
+        bloomBuffer.clear();
     }
+    stageTimer.lap (ProcessStageTimer::Bloom);
 
     // ——————————————————————————————————————————————————————————————————
     // Cloud Granular Delay: variable-length Hann-windowed grains read from
@@ -1114,8 +1161,6 @@ void PingProcessor::processBlock (juce::AudioBuffer<float>& buffer, juce::MidiBu
                                     apvts.getRawParameterValue (IDs::cloudFeedback)->load());
         const float cirFeed   = apvts.getRawParameterValue (IDs::cloudIRFeed)->load();
 
-        if (numSamples > cloudBuffer.getNumSamples())
-            cloudBuffer.setSize (2, numSamples, false, true, true);
         cloudBuffer.clear();
 
         const int   capBufSamps = (int)cloudCaptureBufs[0].size();
@@ -1298,6 +1343,7 @@ void PingProcessor::processBlock (juce::AudioBuffer<float>& buffer, juce::MidiBu
         cloudBuffer.clear();
         cloudFbSamples.fill (0.f);
     }
+    stageTimer.lap (ProcessStageTimer::Cloud);
 
     // ——————————————————————————————————————————————————————————————————
     // Shimmer: 8-voice harmonic cloud (no feedback loop).
@@ -1380,8 +1426,6 @@ void PingProcessor::processBlock (juce::AudioBuffer<float>& buffer, juce::MidiBu
         static constexpr float semiOff[kNumShimVoices]  = { 0.f, 0.f, 0.f, 0.f, 0.f, 0.f,
                                                              3.f / 100.f, 6.f / 100.f };
 
-        if (numSamples > shimBuffer.getNumSamples())
-            shimBuffer.setSize (2, numSamples, false, true, true);
         shimBuffer.clear();
 
         auto hannW = [](float p) -> float {
@@ -1555,6 +1599,7 @@ void PingProcessor::processBlock (juce::AudioBuffer<float>& buffer, juce::MidiBu
                 shimDelayPtrs[v][ch] = 0;
             }
     }
+    stageTimer.lap (ProcessStageTimer::Shimmer);
 
     float erDb = apvts.getRawParameterValue (IDs::erLevel)->load();
     float tailDb = apvts.getRawParameterValue (IDs::tailLevel)->load();
@@ -1563,11 +1608,12 @@ void PingProcessor::processBlock (juce::AudioBuffer<float>& buffer, juce::MidiBu
 
     // ── Multi-mic mixer ─────────────────────────────────────────────────────
     // Per-path convolution + HP + gain + pan mixer. Up to four paths contribute:
-    //   MAIN    — 8 convolvers (tsEr* + tsTail*) with optional ER/Tail crossfeed,
+    //   MAIN    — 8 kernels (ER + Tail) on separate buses, with optional ER/Tail crossfeed,
     //             summed through erLevel/tailLevel × trueStereoWetGain. Always present.
-    //   DIRECT  — 4 convolvers (tsDirectConv*). Order-0 path with no ER/Tail split.
-    //   OUTRIG  — 8 convolvers (tsOutrigEr* + tsOutrigTail*). ER + Tail summed 1:1.
-    //   AMBIENT — 8 convolvers (tsAmbEr*    + tsAmbTail*).    ER + Tail summed 1:1.
+    //   DIRECT  — 4 kernels. Order-0 path with no ER/Tail split.
+    //   OUTRIG  — 8 kernels (ER + Tail), summed 1:1 onto one bus inside the convolver.
+    //   AMBIENT — 8 kernels (ER + Tail), summed 1:1 onto one bus inside the convolver.
+    // All four run through a single trueStereoConv.process() call per block.
     // Each strip applies its own 110 Hz 2nd-order HP (enabled flag only — the biquad
     // updates state every sample regardless so toggling is click-free), a smoothed
     // linear gain, and a constant-power pan. The four mono outputs are summed into the
@@ -1575,7 +1621,7 @@ void PingProcessor::processBlock (juce::AudioBuffer<float>& buffer, juce::MidiBu
     //
     // Mute / Solo / per-path On switches are folded into the smoothed target gain:
     // when a strip is gated off the target becomes 0 and the SmoothedValue ramps down
-    // over 20 ms. Convolvers are skipped entirely when their path On flag is false,
+    // over 20 ms. A path's kernels are skipped entirely when its On flag is false,
     // which is the behaviour expected from a switched-off mic send.
     //
     // Defaults (mainOn=true, mainGain=0 dB, mainPan=0, mainHP off, mainMute=mainSolo=
@@ -1586,7 +1632,8 @@ void PingProcessor::processBlock (juce::AudioBuffer<float>& buffer, juce::MidiBu
     // straight into the wet buffer. This is consistent with the multi-mic brief
     // specification and matches typical mixer pan behaviour.
     {
-        juce::AudioBuffer<float> lIn (1, numSamples), rIn (1, numSamples);
+        juce::AudioBuffer<float> lIn (scratch.channels (ScratchArena::ConvInL), 1, numSamples);
+        juce::AudioBuffer<float> rIn (scratch.channels (ScratchArena::ConvInR), 1, numSamples);
         lIn.copyFrom (0, 0, buffer, 0, 0, numSamples);
         rIn.copyFrom (0, 0, buffer, 1, 0, numSamples);
 
@@ -1657,32 +1704,26 @@ void PingProcessor::processBlock (juce::AudioBuffer<float>& buffer, juce::MidiBu
         panCoeffs (outrigPanRaw,  outrigPanL,  outrigPanR);
         panCoeffs (ambientPanRaw, ambientPanL, ambientPanR);
 
-        // Shared convolver-temp buffer. Use explicit 3-arg AudioBlock constructor so its
-        // size matches numSamples exactly (see CLAUDE.md note on convTmp / NUPC state corruption).
-        juce::AudioBuffer<float> tmp (1, numSamples);
-        juce::dsp::AudioBlock<float> tmpBlock (tmp.getArrayOfWritePointers(), 1, (size_t) numSamples);
-
-        auto runFour = [&] (juce::dsp::Convolution& cLL,
-                             juce::dsp::Convolution& cRL,
-                             juce::dsp::Convolution& cLR,
-                             juce::dsp::Convolution& cRR,
-                             juce::AudioBuffer<float>& outL,
-                             juce::AudioBuffer<float>& outR)
-        {
-            tmp.copyFrom (0, 0, lIn, 0, 0, numSamples);
-            cLL.process (juce::dsp::ProcessContextReplacing<float> (tmpBlock));
-            outL.copyFrom (0, 0, tmp, 0, 0, numSamples);
-            tmp.copyFrom (0, 0, rIn, 0, 0, numSamples);
-            cRL.process (juce::dsp::ProcessContextReplacing<float> (tmpBlock));
-            outL.addFrom (0, 0, tmp, 0, 0, numSamples);
-
-            tmp.copyFrom (0, 0, lIn, 0, 0, numSamples);
-            cLR.process (juce::dsp::ProcessContextReplacing<float> (tmpBlock));
-            outR.copyFrom (0, 0, tmp, 0, 0, numSamples);
-            tmp.copyFrom (0, 0, rIn, 0, 0, numSamples);
-            cRR.process (juce::dsp::ProcessContextReplacing<float> (tmpBlock));
-            outR.addFrom (0, 0, tmp, 0, 0, numSamples);
+        // Convolver output buses — one mono view per TrueStereoConvolver::Bus. MAIN keeps
+        // ER and Tail apart (level / crossfeed / meters); OUTRIG and AMBIENT arrive with
+        // ER + Tail already summed 1:1; DIRECT has no split.
+        static_assert (ScratchArena::ConvBusLast - ScratchArena::ConvBus0 + 1 == TrueStereoConvolver::kNumBuses,
+                       "one scratch slot per convolver bus");
+        auto busView = [&] (TrueStereoConvolver::Bus b)
+        {
+            return juce::AudioBuffer<float> (scratch.channels ((ScratchArena::Slot) (ScratchArena::ConvBus0 + b)),
+                                             1, numSamples);
         };
+        juce::AudioBuffer<float> mainErL   = busView (TrueStereoConvolver::MainErL);
+        juce::AudioBuffer<float> mainErR   = busView (TrueStereoConvolver::MainErR);
+        juce::AudioBuffer<float> mainTailL = busView (TrueStereoConvolver::MainTailL);
+        juce::AudioBuffer<float> mainTailR = busView (TrueStereoConvolver::MainTailR);
+        juce::AudioBuffer<float> directL   = busView (TrueStereoConvolver::DirectL);
+        juce::AudioBuffer<float> directR   = busView (TrueStereoConvolver::DirectR);
+        juce::AudioBuffer<float> outrigL   = busView (TrueStereoConvolver::OutrigL);
+        juce::AudioBuffer<float> outrigR   = busView (TrueStereoConvolver::OutrigR);
+        juce::AudioBuffer<float> ambientL  = busView (TrueStereoConvolver::AmbientL);
+        juce::AudioBuffer<float> ambientR  = busView (TrueStereoConvolver::AmbientR);
 
         // From here on the buffer holds the accumulated wet signal. Clear it and add
         // each strip's contribution.
@@ -1690,71 +1731,47 @@ void PingProcessor::processBlock (juce::AudioBuffer<float>& buffer, juce::MidiBu
         const float trueStereoWetGain = 2.0f;
 
         // ── Convolver readiness gating & fade re-arm ────────────────────────
-        // juce::dsp::Convolution defaults to a unity (pass-through) IR until the NUPC
-        // background thread kicked off by loadImpulseResponse() has actually published
-        // a real engine — typically tens to hundreds of ms after loadImpulseResponse()
-        // returns. Two independent problems follow from that:
-        //
-        //   1. If we open the wet path the moment loadImpulseResponse() returns
-        //      (checking only mainIRLoaded etc.), the wet bus contains pass-through
-        //      of the post-predelay dry signal at high gain (trueStereoWetGain = 2.0,
-        //      summed across 4–8 mono convolvers) until JUCE swaps in the real IR.
-        //      When that swap happens, the audible content changes abruptly — click.
-        //
-        //   2. The irLoadFadeSamplesRemaining wet-bus fade is armed at loadImpulseResponse()
-        //      time. For a newly-instantiated plugin the fade may have already expired
-        //      (or be near full gain) by the moment the convolvers are actually ready,
-        //      so the step from "wet bus muted because we're gating on readiness" to
-        //      "wet bus at full real-convolved gain" is not covered by the fade.
+        // A path's kernels are built on the message thread by loadIRFromBuffer() and
+        // only become live when trueStereoConv.adoptPending() picks them up at the top of
+        // a later block. The irLoadFadeSamplesRemaining wet-bus fade is armed at load
+        // time, so for a newly-instantiated plugin (or a slow load) the fade may already
+        // have expired by the moment the kernels are actually installed, and the step
+        // from "wet bus muted because we're gating on readiness" to "wet bus at full
+        // real-convolved gain" would not be covered by the fade.
         //
-        // Fix: (a) AND all of a path's convolvers into a single readiness flag (every
-        // convolver must have a real IR, otherwise summing mixes real output with unity
-        // pass-through from the laggards); (b) when a path transitions not-ready → ready
-        // between two blocks, re-arm irLoadFadeSamplesRemaining to full so the real
-        // signal ramps in smoothly. getCurrentIRSize() returns 0 until the real engine
-        // is installed; it's safe to read from the audio thread because currentEngine
-        // is only mutated from this same thread inside processSamples → installPendingEngine.
-        const bool mainReady = tsErConvLL  .getCurrentIRSize() > 0
-                            && tsErConvRL  .getCurrentIRSize() > 0
-                            && tsErConvLR  .getCurrentIRSize() > 0
-                            && tsErConvRR  .getCurrentIRSize() > 0
-                            && tsTailConvLL.getCurrentIRSize() > 0
-                            && tsTailConvRL.getCurrentIRSize() > 0
-                            && tsTailConvLR.getCurrentIRSize() > 0
-                            && tsTailConvRR.getCurrentIRSize() > 0;
-        const bool directReady = tsDirectConvLL.getCurrentIRSize() > 0
-                              && tsDirectConvRL.getCurrentIRSize() > 0
-                              && tsDirectConvLR.getCurrentIRSize() > 0
-                              && tsDirectConvRR.getCurrentIRSize() > 0;
-        const bool outrigReady = tsOutrigErConvLL  .getCurrentIRSize() > 0
-                              && tsOutrigErConvRL  .getCurrentIRSize() > 0
-                              && tsOutrigErConvLR  .getCurrentIRSize() > 0
-                              && tsOutrigErConvRR  .getCurrentIRSize() > 0
-                              && tsOutrigTailConvLL.getCurrentIRSize() > 0
-                              && tsOutrigTailConvRL.getCurrentIRSize() > 0
-                              && tsOutrigTailConvLR.getCurrentIRSize() > 0
-                              && tsOutrigTailConvRR.getCurrentIRSize() > 0;
-        const bool ambientReady = tsAmbErConvLL  .getCurrentIRSize() > 0
-                               && tsAmbErConvRL  .getCurrentIRSize() > 0
-                               && tsAmbErConvLR  .getCurrentIRSize() > 0
-                               && tsAmbErConvRR  .getCurrentIRSize() > 0
-                               && tsAmbTailConvLL.getCurrentIRSize() > 0
-                               && tsAmbTailConvRL.getCurrentIRSize() > 0
-                               && tsAmbTailConvLR.getCurrentIRSize() > 0
-                               && tsAmbTailConvRR.getCurrentIRSize() > 0;
+        // Fix: gate each path on isPathReady() as well as its *IRLoaded flag, and when a
+        // path transitions not-ready → ready between two blocks, re-arm
+        // irLoadFadeSamplesRemaining to full so the real signal ramps in smoothly.
+        const bool mainReady    = trueStereoConv.isPathReady (TrueStereoConvolver::Main);
+        const bool directReady  = trueStereoConv.isPathReady (TrueStereoConvolver::Direct);
+        const bool outrigReady  = trueStereoConv.isPathReady (TrueStereoConvolver::Outrig);
+        const bool ambientReady = trueStereoConv.isPathReady (TrueStereoConvolver::Ambient);
 
         const bool mainJustReady    = mainReady    && ! mainConvPrevReady   .load (std::memory_order_relaxed);
         const bool directJustReady  = directReady  && ! directConvPrevReady .load (std::memory_order_relaxed);
         const bool outrigJustReady  = outrigReady  && ! outrigConvPrevReady .load (std::memory_order_relaxed);
         const bool ambientJustReady = ambientReady && ! ambientConvPrevReady.load (std::memory_order_relaxed);
 
+        // A path woken from hibernation ramps in on its own (pathWakeFadeRemaining)
+        // instead of re-muting the whole wet bus.
+        auto wokeThisBlock = [this] (MicPath p, bool justReady)
+        {
+            if (! justReady || ! pathWaking[(size_t) p].exchange (false, std::memory_order_relaxed))
+                return false;
+            pathWakeFadeRemaining[(size_t) p] = kPathWakeFadeSamples;
+            return true;
+        };
+        const bool directWoke  = wokeThisBlock (MicPath::Direct,  directJustReady);
+        const bool outrigWoke  = wokeThisBlock (MicPath::Outrig,  outrigJustReady);
+        const bool ambientWoke = wokeThisBlock (MicPath::Ambient, ambientJustReady);
+
         // If any active path's convolvers transitioned to ready this block, arm (or
         // re-arm, taking the max with whatever is already counting down) the wet fade.
         // Inactive paths don't need the fade — their contribution is gated off anyway.
         const bool anyActivePathJustReady = (mainOnRaw    && mainJustReady)
-                                         || (directOnRaw  && directJustReady)
-                                         || (outrigOnRaw  && outrigJustReady)
-                                         || (ambientOnRaw && ambientJustReady);
+                                         || (directOnRaw  && directJustReady  && ! directWoke)
+                                         || (outrigOnRaw  && outrigJustReady  && ! outrigWoke)
+                                         || (ambientOnRaw && ambientJustReady && ! ambientWoke);
         if (anyActivePathJustReady)
         {
             const int cur = irLoadFadeSamplesRemaining.load (std::memory_order_relaxed);
@@ -1767,15 +1784,70 @@ void PingProcessor::processBlock (juce::AudioBuffer<float>& buffer, juce::MidiBu
         outrigConvPrevReady .store (outrigReady,  std::memory_order_relaxed);
         ambientConvPrevReady.store (ambientReady, std::memory_order_relaxed);
 
+        // One pass for every enabled path: L and R are forward-transformed once and
+        // each bus gets a single inverse FFT.
+        const bool mainActive    = mainOnRaw    && mainIRLoaded.load()    && mainReady;
+        const bool directActive  = directOnRaw  && directIRLoaded.load()  && directReady;
+        const bool outrigActive  = outrigOnRaw  && outrigIRLoaded.load()  && outrigReady;
+        const bool ambientActive = ambientOnRaw && ambientIRLoaded.load() && ambientReady;
+        const bool pathActive[TrueStereoConvolver::kNumPaths] { mainActive, directActive, outrigActive, ambientActive };
+
+        // Live shape: Decay and Stretch reach the shaped paths' kernels here, once per
+        // chunk (paths loaded without live shape ignore them).
+        shapeDampingSmoothed.setTargetValue (1.0f - apvts.getRawParameterValue (IDs::decay)->load());
+        shapeStretchSmoothed.setTargetValue (apvts.getRawParameterValue (IDs::stretch)->load());
+        const float shapeDamping = shapeDampingSmoothed.skip (numSamples);
+        const float shapeStretch = shapeStretchSmoothed.skip (numSamples);
+        for (auto shapedPath : { TrueStereoConvolver::Main, TrueStereoConvolver::Outrig, TrueStereoConvolver::Ambient })
+            trueStereoConv.setPathShape (shapedPath, shapeDamping, shapeStretch);
+
+        trueStereoConv.process (lIn.getReadPointer (0), rIn.getReadPointer (0), numSamples, pathActive,
+                                scratch.channels (ScratchArena::ConvBus0));
+        stageTimer.lap (ProcessStageTimer::Convolve);
+
+        // Live tail: the path's FDN adds the tail the convolver no longer carries —
+        // into MAIN's Tail buses, and into OUTRIG / AMBIENT's combined buses.
+        auto addLiveTail = [&] (const LiveFdnTailSlot& slot, bool active,
+                                juce::AudioBuffer<float>& busL, juce::AudioBuffer<float>& busR)
+        {
+            if (auto* t = slot.get(); t != nullptr && active)
+                t->process (lIn.getReadPointer (0), rIn.getReadPointer (0),
+                            busL.getWritePointer (0), busR.getWritePointer (0), numSamples);
+        };
+        addLiveTail (mainLiveTail,    mainActive,    mainTailL, mainTailR);
+        addLiveTail (outrigLiveTail,  outrigActive,  outrigL,   outrigR);
+        addLiveTail (ambientLiveTail, ambientActive, ambientL,  ambientR);
+        stageTimer.lap (ProcessStageTimer::LiveTail);
+
+        // Wake ramp: a linear fade-in on the woken strip's own buses.
+        auto applyWakeFade = [&] (MicPath p, bool active,
+                                  juce::AudioBuffer<float>& busL, juce::AudioBuffer<float>& busR)
+        {
+            int& remaining = pathWakeFadeRemaining[(size_t) p];
+            if (remaining <= 0 || ! active)
+                return;
+            float* l = busL.getWritePointer (0);
+            float* r = busR.getWritePointer (0);
+            for (int i = 0; i < numSamples && remaining > 0; ++i, --remaining)
+            {
+                const float g = 1.0f - (float) remaining / (float) kPathWakeFadeSamples;
+                l[i] *= g;
+                r[i] *= g;
+            }
+        };
+        applyWakeFade (MicPath::Direct,  directActive,  directL,  directR);
+        applyWakeFade (MicPath::Outrig,  outrigActive,  outrigL,  outrigR);
+        applyWakeFade (MicPath::Ambient, ambientActive, ambientL, ambientR);
+
         // ── MAIN ────────────────────────────────────────────────────────────
         float mainPkL = 0.f, mainPkR = 0.f;
         float erPkL = 0.f, erPkR = 0.f, tailPkL = 0.f, tailPkR = 0.f;
-        if (mainOnRaw && mainIRLoaded.load() && mainReady)
+        if (mainActive)
         {
-            juce::AudioBuffer<float> lEr (1, numSamples), rEr (1, numSamples);
-            juce::AudioBuffer<float> lTail (1, numSamples), rTail (1, numSamples);
-            runFour (tsErConvLL,   tsErConvRL,   tsErConvLR,   tsErConvRR,   lEr,   rEr);
-            runFour (tsTailConvLL, tsTailConvRL, tsTailConvLR, tsTailConvRR, lTail, rTail);
+            auto& lEr   = mainErL;
+            auto& rEr   = mainErR;
+            auto& lTail = mainTailL;
+            auto& rTail = mainTailR;
 
             if (apvts.getRawParameterValue (IDs::erCrossfeedOn)->load() > 0.5f && crossfeedMaxSamples > 0)
             {
@@ -1873,14 +1945,13 @@ void PingProcessor::processBlock (juce::AudioBuffer<float>& buffer, juce::MidiBu
         updatePeak (mainPeakR,      mainPkR);
 
         // ── DIRECT ──────────────────────────────────────────────────────────
-        // Gated on directIRLoaded AND directReady (precomputed above from all 4 direct
-        // convolvers' getCurrentIRSize() > 0) — see the readiness block above for
+        // Gated on directIRLoaded AND directReady — see the readiness block above for
         // rationale.
         float directPkL = 0.f, directPkR = 0.f;
-        if (directOnRaw && directIRLoaded.load() && directReady)
+        if (directActive)
         {
-            juce::AudioBuffer<float> dL (1, numSamples), dR (1, numSamples);
-            runFour (tsDirectConvLL, tsDirectConvRL, tsDirectConvLR, tsDirectConvRR, dL, dR);
+            auto& dL = directL;
+            auto& dR = directR;
 
             float* bL = buffer.getWritePointer (0);
             float* bR = buffer.getWritePointer (1);
@@ -1913,23 +1984,17 @@ void PingProcessor::processBlock (juce::AudioBuffer<float>& buffer, juce::MidiBu
         // ── OUTRIG ──────────────────────────────────────────────────────────
         // Gated on outrigIRLoaded AND outrigReady — see the readiness block above.
         float outrigPkL = 0.f, outrigPkR = 0.f;
-        if (outrigOnRaw && outrigIRLoaded.load() && outrigReady)
+        if (outrigActive)
         {
-            juce::AudioBuffer<float> oEL (1, numSamples), oER (1, numSamples);
-            juce::AudioBuffer<float> oTL (1, numSamples), oTR (1, numSamples);
-            runFour (tsOutrigErConvLL,   tsOutrigErConvRL,   tsOutrigErConvLR,   tsOutrigErConvRR,   oEL, oER);
-            runFour (tsOutrigTailConvLL, tsOutrigTailConvRL, tsOutrigTailConvLR, tsOutrigTailConvRR, oTL, oTR);
-
+            // ER + Tail were summed 1:1 inside the convolver (shared bus).
             float* bL = buffer.getWritePointer (0);
             float* bR = buffer.getWritePointer (1);
-            const float* elp = oEL.getReadPointer (0);
-            const float* erp = oER.getReadPointer (0);
-            const float* tlp = oTL.getReadPointer (0);
-            const float* trp = oTR.getReadPointer (0);
+            const float* lp = outrigL.getReadPointer (0);
+            const float* rp = outrigR.getReadPointer (0);
             for (int i = 0; i < numSamples; ++i)
             {
-                float sL = (elp[i] + tlp[i]) * trueStereoWetGain;
-                float sR = (erp[i] + trp[i]) * trueStereoWetGain;
+                float sL = lp[i] * trueStereoWetGain;
+                float sR = rp[i] * trueStereoWetGain;
                 sL = outrigHP.process (sL, 0);
                 sR = outrigHP.process (sR, 1);
                 const float g = outrigGainSmoothed.getNextValue();
@@ -1953,23 +2018,17 @@ void PingProcessor::processBlock (juce::AudioBuffer<float>& buffer, juce::MidiBu
         // ── AMBIENT ─────────────────────────────────────────────────────────
         // Gated on ambientIRLoaded AND ambientReady — see the readiness block above.
         float ambientPkL = 0.f, ambientPkR = 0.f;
-        if (ambientOnRaw && ambientIRLoaded.load() && ambientReady)
+        if (ambientActive)
         {
-            juce::AudioBuffer<float> aEL (1, numSamples), aER (1, numSamples);
-            juce::AudioBuffer<float> aTL (1, numSamples), aTR (1, numSamples);
-            runFour (tsAmbErConvLL,   tsAmbErConvRL,   tsAmbErConvLR,   tsAmbErConvRR,   aEL, aER);
-            runFour (tsAmbTailConvLL, tsAmbTailConvRL, tsAmbTailConvLR, tsAmbTailConvRR, aTL, aTR);
-
+            // ER + Tail were summed 1:1 inside the convolver (shared bus).
             float* bL = buffer.getWritePointer (0);
             float* bR = buffer.getWritePointer (1);
-            const float* elp = aEL.getReadPointer (0);
-            const float* erp = aER.getReadPointer (0);
-            const float* tlp = aTL.getReadPointer (0);
-            const float* trp = aTR.getReadPointer (0);
+            const float* lp = ambientL.getReadPointer (0);
+            const float* rp = ambientR.getReadPointer (0);
             for (int i = 0; i < numSamples; ++i)
             {
-                float sL = (elp[i] + tlp[i]) * trueStereoWetGain;
-                float sR = (erp[i] + trp[i]) * trueStereoWetGain;
+                float sL = lp[i] * trueStereoWetGain;
+                float sR = rp[i] * trueStereoWetGain;
                 sL = ambientHP.process (sL, 0);
                 sR = ambientHP.process (sR, 1);
                 const float g = ambientGainSmoothed.getNextValue();
@@ -1990,6 +2049,7 @@ void PingProcessor::processBlock (juce::AudioBuffer<float>& buffer, juce::MidiBu
         updatePeak (ambientPeakL, ambientPkL);
         updatePeak (ambientPeakR, ambientPkR);
     }
+    stageTimer.lap (ProcessStageTimer::Mixer);
 
     // EQ: low shelf → peak 1 → peak 2 → peak 3 → high shelf
     lowShelfBand.process (context);
@@ -2067,6 +2127,8 @@ void PingProcessor::processBlock (juce::AudioBuffer<float>& buffer, juce::MidiBu
         }
     }
 
+    stageTimer.lap (ProcessStageTimer::Post);
+
     // (Cloud Insertion 2 removed — Cloud now runs pre-convolution above.
     //  cloudVolume is applied post-blend below, alongside bloomVolume.)
 
@@ -2116,7 +2178,8 @@ void PingProcessor::processBlock (juce::AudioBuffer<float>& buffer, juce::MidiBu
     for (int ch = 0; ch < numChannels; ++ch)
     {
         buffer.applyGain (ch, 0, numSamples, wet);
-        buffer.addFrom (ch, 0, dryBuffer, ch, 0, numSamples, dry);
+        if (ch < dryBuffer.getNumChannels())
+            buffer.addFrom (ch, 0, dryBuffer, ch, 0, numSamples, dry);
     }
 
     // ——————————————————————————————————————————————————————————————————
@@ -2124,7 +2187,7 @@ void PingProcessor::processBlock (juce::AudioBuffer<float>& buffer, juce::MidiBu
     // of the plugin's wet/dry control. Behaves like the direct output of a Bloom pedal
     // in parallel with the dry/wet-controlled reverb signal.
     // ——————————————————————————————————————————————————————————————————
-    if (apvts.getRawParameterValue (IDs::bloomOn)->load() > 0.5f && numSamples <= bloomBuffer.getNumSamples())
+    if (apvts.getRawParameterValue (IDs::bloomOn)->load() > 0.5f)
     {
         const float bloomVol = apvts.getRawParameterValue (IDs::bloomVolume)->load();
         if (bloomVol > 0.f)
@@ -2146,7 +2209,7 @@ void PingProcessor::processBlock (juce::AudioBuffer<float>& buffer, juce::MidiBu
     if (apvts.getRawParameterValue (IDs::cloudOn)->load() > 0.5f)
     {
         const float cloudVol = apvts.getRawParameterValue (IDs::cloudVolume)->load();
-        if (cloudVol > 0.f && numSamples <= cloudBuffer.getNumSamples())
+        if (cloudVol > 0.f)
         {
             for (int ch = 0; ch < numChannels; ++ch)
             {
@@ -2170,6 +2233,7 @@ void PingProcessor::processBlock (juce::AudioBuffer<float>& buffer, juce::MidiBu
     }
     updatePeak (outputLevelPeakL, peakL);
     updatePeak (outputLevelPeakR, peakR);
+    stageTimer.lap (ProcessStageTimer::Output);
 }
 
 float PingProcessor::getOutputLevelDb (int channel) const
@@ -2259,11 +2323,15 @@ void PingProcessor::updateEQ()
     auto freq = [this] (const juce::String& id) { return apvts.getRawParameterValue (id)->load(); };
     auto gain = [this] (const juce::String& id) { return juce::Decibels::decibelsToGain (apvts.getRawParameterValue (id)->load()); };
     auto q    = [this] (const juce::String& id) { return apvts.getRawParameterValue (id)->load(); };
-    *lowShelfBand.state = *juce::dsp::IIR::Coefficients<float>::makeLowShelf  (currentSampleRate, freq (IDs::band3Freq), q (IDs::band3Q), gain (IDs::band3Gain));
-    *lowBand.state      = *juce::dsp::IIR::Coefficients<float>::makePeakFilter (currentSampleRate, freq (IDs::band0Freq), q (IDs::band0Q), gain (IDs::band0Gain));
-    *midBand.state      = *juce::dsp::IIR::Coefficients<float>::makePeakFilter (currentSampleRate, freq (IDs::band1Freq), q (IDs::band1Q), gain (IDs::band1Gain));
-    *highBand.state     = *juce::dsp::IIR::Coefficients<float>::makePeakFilter (currentSampleRate, freq (IDs::band2Freq), q (IDs::band2Q), gain (IDs::band2Gain));
-    *highShelfBand.state= *juce::dsp::IIR::Coefficients<float>::makeHighShelf (currentSampleRate, freq (IDs::band4Freq), q (IDs::band4Q), gain (IDs::band4Gain));
+    // ArrayCoefficients returns plain std::arrays that are copied into the existing
+    // Coefficients objects — called every block, so it must not allocate (the
+    // Coefficients::make* factories heap-allocate a new object per call).
+    using ArrayCoeffs = juce::dsp::IIR::ArrayCoefficients<float>;
+    *lowShelfBand.state = ArrayCoeffs::makeLowShelf   (currentSampleRate, freq (IDs::band3Freq), q (IDs::band3Q), gain (IDs::band3Gain));
+    *lowBand.state      = ArrayCoeffs::makePeakFilter (currentSampleRate, freq (IDs::band0Freq), q (IDs::band0Q), gain (IDs::band0Gain));
+    *midBand.state      = ArrayCoeffs::makePeakFilter (currentSampleRate, freq (IDs::band1Freq), q (IDs::band1Q), gain (IDs::band1Gain));
+    *highBand.state     = ArrayCoeffs::makePeakFilter (currentSampleRate, freq (IDs::band2Freq), q (IDs::band2Q), gain (IDs::band2Gain));
+    *highShelfBand.state= ArrayCoeffs::makeHighShelf  (currentSampleRate, freq (IDs::band4Freq), q (IDs::band4Q), gain (IDs::band4Gain));
 }
 
 void PingProcessor::applyWidth (juce::AudioBuffer<float>& wet, float width)
@@ -2339,12 +2407,9 @@ void PingProcessor::loadIRFromFile (const juce::File& file)
             // exactly that path" semantics — without clearing, the previously-loaded
             // MAIN / sibling-aux paths would still be enableable on the front-panel
             // mixer with stale audio from whatever was loaded before.
-            juce::AudioFormatManager fm;
-            fm.registerBasicFormats();
-            std::unique_ptr<juce::AudioFormatReader> reader (fm.createReaderFor (file));
-            if (! reader) return;
-            juce::AudioBuffer<float> auxBuf ((int) reader->numChannels, (int) reader->lengthInSamples);
-            reader->read (&auxBuf, 0, (int) reader->lengthInSamples, 0, true, true);
+            juce::AudioBuffer<float> auxBuf;
+            double auxSampleRate = 0.0;
+            if (! readIRFile (file, auxBuf, auxSampleRate)) return;
 
             // Clear every path *except* the one we're about to populate. Done before
             // the load so loadIRFromBuffer's flag-flip is the final state.
@@ -2352,7 +2417,8 @@ void PingProcessor::loadIRFromFile (const juce::File& file)
                 if (p != m.path)
                     clearMicPath (p);
 
-            loadIRFromBuffer (std::move (auxBuf), reader->sampleRate, /*fromSynth=*/false,
+            pathSourceFile[(size_t) m.path] = file;
+            loadIRFromBuffer (std::move (auxBuf), auxSampleRate, /*fromSynth=*/false,
                               /*deferConvolverLoad=*/false, m.path);
 
             // Display name reflects the orphan filename verbatim (suffix preserved).
@@ -2378,15 +2444,12 @@ void PingProcessor::loadIRFromFile (const juce::File& file)
 
     irFromSynth = false;
     lastLoadedIRFile = file;
-    currentIRSampleRate = 48000.0;  // set from reader below
-    juce::AudioFormatManager fm;
-    fm.registerBasicFormats();
-    std::unique_ptr<juce::AudioFormatReader> reader (fm.createReaderFor (file));
-    if (! reader) return;
-
-    juce::AudioBuffer<float> buf ((int) reader->numChannels, (int) reader->lengthInSamples);
-    reader->read (&buf, 0, (int) reader->lengthInSamples, 0, true, true);
-    currentIRSampleRate = reader->sampleRate;
+    currentIRSampleRate = 48000.0;  // set from the file below
+    juce::AudioBuffer<float> buf;
+    double fileSampleRate = 0.0;
+    if (! readIRFile (file, buf, fileSampleRate)) return;
+
+    currentIRSampleRate = fileSampleRate;
     loadIRFromBuffer (std::move (buf), currentIRSampleRate, false, false, MicPath::Main);
 
     // MAIN display = the file's stem (sans extension). Each loadMicPathFromFile call
@@ -2444,14 +2507,21 @@ void PingProcessor::loadMicPathFromFile (const juce::File& baseIRFile, MicPath p
         return;
     }
 
-    juce::AudioFormatManager fm;
-    fm.registerBasicFormats();
-    std::unique_ptr<juce::AudioFormatReader> reader (fm.createReaderFor (sibling));
-    if (! reader) return;
+    // A hibernated path only notes the file; wakePath reads it when the strip
+    // comes back on.
+    pathSourceFile[(size_t) path] = sibling;
+    if (pathHibernated[(size_t) path])
+    {
+        pathIRLoadedFlag (path).store (true);
+        setPathDisplayName (path, sibling.getFileNameWithoutExtension());
+        return;
+    }
 
-    juce::AudioBuffer<float> buf ((int) reader->numChannels, (int) reader->lengthInSamples);
-    reader->read (&buf, 0, (int) reader->lengthInSamples, 0, true, true);
-    loadIRFromBuffer (std::move (buf), reader->sampleRate, /*fromSynth=*/false,
+    juce::AudioBuffer<float> buf;
+    double siblingSampleRate = 0.0;
+    if (! readIRFile (sibling, buf, siblingSampleRate)) return;
+
+    loadIRFromBuffer (std::move (buf), siblingSampleRate, /*fromSynth=*/false,
                       /*deferConvolverLoad=*/false, path);
 
     // Display the sibling's stem (e.g. "Venue_outrig"). Aux suffix is preserved so
@@ -2459,6 +2529,49 @@ void PingProcessor::loadMicPathFromFile (const juce::File& baseIRFile, MicPath p
     setPathDisplayName (path, sibling.getFileNameWithoutExtension());
 }
 
+bool PingProcessor::readIRFile (const juce::File& file, juce::AudioBuffer<float>& dest, double& sampleRate)
+{
+    auto& cache = DecodedIRCache::shared();
+    const auto key = DecodedIRCache::makeKey (file.getFullPathName().toStdString(),
+                                              file.getLastModificationTime().toMilliseconds(),
+                                              file.getSize());
+
+    auto decoded = cache.find (key);
+    if (decoded == nullptr)
+    {
+        juce::AudioFormatManager fm;
+        fm.registerBasicFormats();
+        std::unique_ptr<juce::AudioFormatReader> reader (fm.createReaderFor (file));
+        if (! reader) return false;
+
+        // Decode straight into the cache entry's storage, then copy out; the
+        // entry is shared with later reloads once inserted.
+        auto entry = std::make_shared<DecodedIRCache::DecodedIR>();
+        entry->sampleRate  = reader->sampleRate;
+        entry->numChannels = (int) reader->numChannels;
+        entry->numSamples  = (int) reader->lengthInSamples;
+        entry->samples.resize ((size_t) entry->numChannels * (size_t) entry->numSamples);
+
+        if (entry->numSamples > 0)
+        {
+            std::vector<float*> chans ((size_t) entry->numChannels);
+            for (int c = 0; c < entry->numChannels; ++c)
+                chans[(size_t) c] = entry->channel (c);
+            juce::AudioBuffer<float> view (chans.data(), entry->numChannels, entry->numSamples);
+            reader->read (&view, 0, entry->numSamples, 0, true, true);
+        }
+
+        decoded = entry;
+        cache.insert (key, decoded);
+    }
+
+    dest.setSize (decoded->numChannels, decoded->numSamples, false, false, false);
+    for (int c = 0; c < decoded->numChannels; ++c)
+        dest.copyFrom (c, 0, decoded->channel (c), decoded->numSamples);
+    sampleRate = decoded->sampleRate;
+    return true;
+}
+
 juce::File PingProcessor::writeSynthIRSetToDirectory (const juce::File& destDir, const juce::String& stem)
 {
     if (currentIRBuffer.getNumSamples() == 0) return {};
@@ -2528,8 +2641,11 @@ juce::File PingProcessor::saveCurrentIRToFile (const juce::String& name)
 
 void PingProcessor::clearMicPath (MicPath path)
 {
-    // Display name reset for every path; per-path slot wipes follow.
+    // Display name and hibernation reset for every path; per-path slot wipes follow.
     setPathDisplayName (path, "<empty>");
+    pathSourceFile[(size_t) path] = juce::File();
+    pathHibernated[(size_t) path] = false;
+    pathOffTicks[(size_t) path]   = 0;
 
     switch (path)
     {
@@ -2557,6 +2673,75 @@ void PingProcessor::clearMicPath (MicPath path)
             ambientIRLoaded.store (false);
             break;
     }
+    releasePathStorage (path);
+}
+
+// Copies one IR channel into a TrueStereoConvolver kernel at the processing rate.
+// juce::dsp::Convolution used to resample internally when the IR rate differed from the
+// host rate; the shared convolver expects kernels at the processing rate, so do the
+// same MemoryAudioSource → ResamplingAudioSource conversion here. Each call uses its
+// own resampler, so the channels of a path may be converted in parallel.
+static std::vector<float> makeConvolverKernel (const float* data, int numSamples,
+                                               double srcRate, double processRate)
+{
+    if (srcRate <= 0.0 || processRate <= 0.0 || srcRate == processRate || numSamples == 0)
+        return std::vector<float> (data, data + numSamples);
+
+    const double factor = srcRate / processRate;
+    const int outLength = juce::jmax (1, juce::roundToInt ((double) numSamples / factor));
+
+    juce::AudioBuffer<float> mono (1, numSamples);
+    mono.copyFrom (0, 0, data, numSamples);
+    juce::MemoryAudioSource memorySource (mono, false);
+    juce::ResamplingAudioSource resampler (&memorySource, false, 1);
+    resampler.setResamplingRatio (factor);
+    resampler.prepareToPlay (outLength, processRate);
+
+    juce::AudioBuffer<float> out (1, outLength);
+    resampler.getNextAudioBlock (juce::AudioSourceChannelInfo (out));
+    return std::vector<float> (out.getReadPointer (0), out.getReadPointer (0) + outLength);
+}
+
+// The 8 kernels (ER + Tail × LL/RL/LR/RR) of a pipeline's last run at the processing
+// rate, with the Tail placed at the crossover. The eight resamples run in parallel on
+// the pipeline's pool.
+static TrueStereoConvolver::PathIR makePathKernels (const IRTransformPipeline& pipeline,
+                                                    double srcRate, double processRate)
+{
+    TrueStereoConvolver::PathIR ir;
+    ir.tailOffset = juce::roundToInt (pipeline.getCrossoverSamples() * processRate / srcRate);
+    SynthTaskPool::TaskGroup kernels (IRTransformPipeline::pool());
+    for (int c = 0; c < 4; ++c)
+    {
+        kernels.run ([&, c]
+        {
+            const auto& er = pipeline.getEr (c);
+            ir.er[(size_t) c] = makeConvolverKernel (er.data(), (int) er.size(), srcRate, processRate);
+        });
+        kernels.run ([&, c]
+        {
+            const auto& tail = pipeline.getTail (c);
+            ir.tail[(size_t) c] = makeConvolverKernel (tail.data(), (int) tail.size(), srcRate, processRate);
+        });
+    }
+    kernels.wait();
+    return ir;
+}
+
+void PingProcessor::armIRLoadFade() noexcept
+{
+    // A hibernated strip waking up fades itself in (pathWakeFadeRemaining); the
+    // other strips are already playing and must not be re-muted.
+    if (irLoadIsWake)
+        return;
+    if (! irLoadIsRefinement)
+    {
+        irLoadFadeSamplesRemaining.store (kIRLoadFadeSamples);
+        return;
+    }
+    // Refinement: never shorten a fade that is still running (e.g. the preview's own).
+    if (irLoadFadeSamplesRemaining.load() < kIRRefineFadeSamples)
+        irLoadFadeSamplesRemaining.store (kIRRefineFadeSamples);
 }
 
 void PingProcessor::loadIRFromBuffer (juce::AudioBuffer<float> buffer, double bufferSampleRate, bool fromSynth, bool deferConvolverLoad, MicPath path)
@@ -2565,8 +2750,8 @@ void PingProcessor::loadIRFromBuffer (juce::AudioBuffer<float> buffer, double bu
 
     // ── DIRECT path short-circuit ────────────────────────────────────────────
     // Direct IRs are order-0 only (direct arrival, no reflections). Too short to split
-    // into ER/Tail; no decay envelope or silence trim applies. Load raw into 4 mono
-    // convolvers and return without touching any MAIN state (currentIRBuffer, selectedIRFile,
+    // into ER/Tail; no decay envelope or silence trim applies. Load raw as the 4 DIRECT
+    // kernels and return without touching any MAIN state (currentIRBuffer, selectedIRFile,
     // irFromSynth, etc.).
     if (path == MicPath::Direct)
     {
@@ -2574,6 +2759,7 @@ void PingProcessor::loadIRFromBuffer (juce::AudioBuffer<float> buffer, double bu
         {
             rawSynthDirectBuffer = buffer;
             rawSynthSampleRate   = bufferSampleRate;
+            pathSourceFile[(size_t) path] = juce::File();
             // A freshly synthesised IR has no on-disk filename yet — show "<unsaved>"
             // until finishSaveSynthIR() writes the file and the resulting load updates
             // this slot to the saved stem.
@@ -2581,6 +2767,13 @@ void PingProcessor::loadIRFromBuffer (juce::AudioBuffer<float> buffer, double bu
             if (deferConvolverLoad) return;
         }
 
+        // Hibernated: the new source is noted above / by the caller; wakePath builds it.
+        if (pathHibernated[(size_t) path])
+        {
+            directIRLoaded.store (true);
+            return;
+        }
+
         // Expand mono/stereo to 4-channel so we always have 4 mono IR vectors to load.
         // (Synth DIRECT always comes in 4-channel; file DIRECT may be mono/stereo.)
         int numCh  = buffer.getNumChannels();
@@ -2599,24 +2792,20 @@ void PingProcessor::loadIRFromBuffer (juce::AudioBuffer<float> buffer, double bu
         }
 
         // Arm wet fade before kicking off background loads (see MAIN path for rationale).
-        irLoadFadeSamplesRemaining.store (kIRLoadFadeSamples);
+        armIRLoadFade();
 
-        juce::dsp::Convolution* tsDirect[] = { &tsDirectConvLL, &tsDirectConvRL, &tsDirectConvLR, &tsDirectConvRR };
+        TrueStereoConvolver::PathIR ir;
         for (int c = 0; c < 4; ++c)
-        {
-            juce::AudioBuffer<float> mono (1, buffer.getNumSamples());
-            mono.copyFrom (0, 0, buffer, c, 0, buffer.getNumSamples());
-            tsDirect[c]->loadImpulseResponse (std::move (mono), bufferSampleRate,
-                juce::dsp::Convolution::Stereo::no, juce::dsp::Convolution::Trim::no,
-                juce::dsp::Convolution::Normalise::no);
-        }
+            ir.er[(size_t) c] = makeConvolverKernel (buffer.getReadPointer (c), buffer.getNumSamples(),
+                                                     bufferSampleRate, currentSampleRate);
+        trueStereoConv.loadPath (TrueStereoConvolver::Direct, ir);
         directIRLoaded.store (true);
         return;
     }
 
     // MAIN / OUTRIG / AMBIENT share the same pipeline from here on. Per-path branches
     // below only affect (a) which state to mutate (Main owns currentIRBuffer etc.) and
-    // (b) which 8-convolver set receives the final IR.
+    // (b) which TrueStereoConvolver path receives the final kernels.
     const bool isMainPath = (path == MicPath::Main);
 
     if (isMainPath)
@@ -2631,69 +2820,18 @@ void PingProcessor::loadIRFromBuffer (juce::AudioBuffer<float> buffer, double bu
             synthesizedIRSampleRate = bufferSampleRate;
         }
 
-        // Auto-trim trailing silence: scan for last sample above -90 dB, add 500 ms safety tail.
-        // Must run BEFORE rawSynthBuffer is saved so the stored raw copy is already trimmed.
+        // Auto-trim trailing silence: scan for last sample above -90 dB, add 500 ms safety tail
+        // and fade the new end out over it. Must run BEFORE rawSynthBuffer is saved so the
+        // stored raw copy is already trimmed. A buffer with nothing to trim comes back
+        // untouched, so reloading an already-trimmed buffer is idempotent (no compounding
+        // cos² attenuation that would become audible under heavy output boost).
         {
-            const int nSamples = buffer.getNumSamples();
-            const int nCh      = buffer.getNumChannels();
-
-            float peak = 1.0e-6f;
-            for (int ch = 0; ch < nCh; ++ch)
-            {
-                const float* p = buffer.getReadPointer (ch);
-                for (int i = 0; i < nSamples; ++i)
-                    peak = juce::jmax (peak, std::abs (p[i]));
-            }
-
-            // 10^(-90/20) ≈ 3.162e-5 — used both as (peak × factor) relative threshold
-            // and as an absolute −90 dBFS floor cap (for synth IRs whose peak > 1.0).
-            constexpr float kSilenceFactor = 3.1622777e-5f;
-            const float threshold = juce::jmin (peak * kSilenceFactor, kSilenceFactor);
-
-            int lastSignificant = 0;
-            for (int ch = 0; ch < nCh; ++ch)
-            {
-                const float* p = buffer.getReadPointer (ch);
-                for (int i = nSamples - 1; i >= 0; --i)
-                {
-                    if (std::abs (p[i]) > threshold)
-                    {
-                        lastSignificant = juce::jmax (lastSignificant, i);
-                        break;
-                    }
-                }
-            }
-
-            const int safetyTail = (int) (0.5 * bufferSampleRate); // 500 ms (also fade length)
-            const int minLen     = (int) (0.3 * bufferSampleRate); // 300 ms floor
-            int newLen = juce::jmin (lastSignificant + safetyTail + 1, nSamples);
-            newLen     = juce::jmax (newLen, minLen);
-
-            if (newLen < nSamples)
-            {
-                juce::AudioBuffer<float> trimmed (nCh, newLen);
-                for (int ch = 0; ch < nCh; ++ch)
-                    trimmed.copyFrom (ch, 0, buffer, ch, 0, newLen);
-                buffer = std::move (trimmed);
-
-                // End-fade: cosine fade over the last safetyTail (500 ms) samples to smooth
-                // the hard cut-point introduced above. Applied ONLY when we actually truncated
-                // so reloading an already-trimmed buffer is idempotent (no compounding cos²
-                // attenuation that would become audible under heavy output boost).
-                const int curLen    = buffer.getNumSamples();
-                const int curCh     = buffer.getNumChannels();
-                const int fadeSamps = juce::jmin (safetyTail, curLen);
-                const int fadeStart = curLen - fadeSamps;
-                for (int ch = 0; ch < curCh; ++ch)
-                {
-                    float* p = buffer.getWritePointer (ch);
-                    for (int i = fadeStart; i < curLen; ++i)
-                    {
-                        const float t = (float)(i - fadeStart) / (float)juce::jmax (fadeSamps, 1);
-                        p[i] *= 0.5f * (1.0f + std::cos (juce::MathConstants<float>::pi * t));
-                    }
-                }
-            }
+            const int newLen = IRTransformPipeline::trimTrailingSilence (buffer.getArrayOfWritePointers(),
+                                                                         buffer.getNumChannels(),
+                                                                         buffer.getNumSamples(),
+                                                                         bufferSampleRate);
+            if (newLen < buffer.getNumSamples())
+                buffer.setSize (buffer.getNumChannels(), newLen, true, false, true);
         }
 
         // save raw copy before any transforms (silence already trimmed + faded) into the right slot
@@ -2701,6 +2839,7 @@ void PingProcessor::loadIRFromBuffer (juce::AudioBuffer<float> buffer, double bu
         else if (path == MicPath::Outrig)  rawSynthOutrigBuffer   = buffer;
         else if (path == MicPath::Ambient) rawSynthAmbientBuffer  = buffer;
         rawSynthSampleRate = bufferSampleRate;
+        pathSourceFile[(size_t) path] = juce::File();
 
         // A freshly synthesised IR has no on-disk filename yet — show "<unsaved>"
         // for the slot that just got synthesised. Once finishSaveSynthIR() writes the
@@ -2719,266 +2858,250 @@ void PingProcessor::loadIRFromBuffer (juce::AudioBuffer<float> buffer, double bu
     else if (isMainPath)
         irFromSynth = false;
 
-    // Optional: apply reverse
-    if (reverse)
+    // Hibernated aux path: keep the new source for wakePath and skip the transform
+    // and the kernels (MAIN never hibernates).
+    if (pathHibernated[(size_t) path])
     {
-        for (int ch = 0; ch < buffer.getNumChannels(); ++ch)
-        {
-            float* p = buffer.getWritePointer (ch);
-            int n = buffer.getNumSamples();
-            for (int i = 0, j = n - 1; i < j; ++i, --j)
-                std::swap (p[i], p[j]);
-        }
-
-        // Trim start of reversed IR (skip initial silence/long tail)
-        float trimFrac = apvts.getRawParameterValue (IDs::reverseTrim)->load();
-        if (trimFrac > 0.001f)
-        {
-            int n = buffer.getNumSamples();
-            int startIdx = (int) (trimFrac * (float) n);
-            if (startIdx > 0 && startIdx < n)
-            {
-                int newLen = n - startIdx;
-                if (newLen >= 64)
-                {
-                    juce::AudioBuffer<float> trimmed (buffer.getNumChannels(), newLen);
-                    for (int ch = 0; ch < buffer.getNumChannels(); ++ch)
-                        trimmed.copyFrom (ch, 0, buffer, ch, startIdx, newLen);
-                    buffer = std::move (trimmed);
-                }
-            }
-        }
+        pathIRLoadedFlag (path).store (true);
+        return;
     }
 
-    // Stretch: time-scale IR to 50%..200% of original length (1.0 = natural)
-    float stretchFactor = apvts.getRawParameterValue (IDs::stretch)->load();
-    int origLen = buffer.getNumSamples();
-    int newLen = (int) (origLen * stretchFactor);
-    if (newLen < 64) newLen = 64;
-    if (newLen != origLen)
-    {
-        juce::AudioBuffer<float> stretched (buffer.getNumChannels(), newLen);
-        for (int ch = 0; ch < buffer.getNumChannels(); ++ch)
-        {
-            const float* src = buffer.getReadPointer (ch);
-            float* dst = stretched.getWritePointer (ch);
-            for (int i = 0; i < newLen; ++i)
-            {
-                float srcIdx = (float) i * (float) origLen / (float) newLen;
-                int i0 = (int) srcIdx;
-                int i1 = juce::jmin (i0 + 1, origLen - 1);
-                float f = srcIdx - (float) i0;
-                dst[i] = src[i0] * (1.0f - f) + src[i1] * f;
-            }
-        }
-        buffer = std::move (stretched);
-    }
+    // Transform chain (Docs §4): reverse + reverse trim, stretch, decay envelope,
+    // trailing-silence trim, expansion to true-stereo LL / RL / LR / RR, ER / Tail
+    // split. The path's pipeline keeps each stage's result from the previous load
+    // and reruns only the stages downstream of what changed — a Decay drag starts
+    // from the cached stretched IR, a Reverse Trim drag from the cached reversed one.
+    //
+    // Trailing silence is trimmed from ALL IRs — critical for synthesised factory IRs
+    // which are allocated at 8×RT60 (up to 60 s) but contain only 8–15 s of actual
+    // reverb signal. File-loaded factory IRs skip the fromSynth silence-trim block
+    // above, so without it they arrive with a huge silent tail; every silent partition
+    // would still be worker CPU and kernel memory for nothing. Synth IRs are already
+    // trimmed, so for them the stage only scans.
+    //
+    // Mono / stereo IRs are expanded with zero cross-channels, ×0.5 on LL / RR to cancel
+    // processBlock's ×2.0 trueStereoWetGain, and a further −15 dB trim that compensates
+    // the observed level excess of file-based IRs relative to synthesised IRs. Synth IRs
+    // (4 channels) pass through.
+    IRTransformPipeline::Settings transform;
+    transform.reverse          = reverse;
+    transform.reverseTrim      = apvts.getRawParameterValue (IDs::reverseTrim)->load();
+    transform.stretch          = apvts.getRawParameterValue (IDs::stretch)->load();
+    // Decay: 0% = flat, 100% = heavily damped — UI reversed: left = more damped
+    transform.decay            = 1.0f - apvts.getRawParameterValue (IDs::decay)->load();
+    transform.crossoverSeconds = fromSynth ? 0.085 : 0.080;
+    transform.fadeSeconds      = fromSynth ? 0.020 : 0.010;
+    transform.erOnly           = fromSynth && lastIRSynthParams.er_only;
+
+    auto& pipeline = transformPipeline (path);
+    const auto tsPath = path == MicPath::Main   ? TrueStereoConvolver::Main
+                      : path == MicPath::Outrig ? TrueStereoConvolver::Outrig
+                                                : TrueStereoConvolver::Ambient;
+
+    // Live shape: render the bank of Stretch points with no Decay envelope; the
+    // convolver applies Decay and crossfades between points as the knobs move
+    // (TrueStereoConvolver::loadShapedPath). The run with the real settings below
+    // still feeds the waveform display.
+    std::vector<TrueStereoConvolver::ShapedPoint> shapedBank;
+    if (liveShape)
+    {
+        const double toProcessRate = currentSampleRate / bufferSampleRate;
+        IRTransformPipeline::Settings flat = transform;
+        flat.decay = 0.0f;
+        for (float stretch : kLiveShapeStretchPoints)
+        {
+            flat.stretch = stretch;
+            pipeline.run (buffer.getArrayOfReadPointers(), buffer.getNumChannels(), buffer.getNumSamples(),
+                          bufferSampleRate, flat);
+            TrueStereoConvolver::ShapedPoint point;
+            point.stretch        = stretch;
+            point.ir             = makePathKernels (pipeline, bufferSampleRate, currentSampleRate);
+            point.envelopeLength = juce::roundToInt (pipeline.getStretchedLength() * toProcessRate);
+            shapedBank.push_back (std::move (point));
+        }
+    }
+
+    pipeline.run (buffer.getArrayOfReadPointers(), buffer.getNumChannels(), buffer.getNumSamples(),
+                  bufferSampleRate, transform);
+
+    const float stretchFactor  = transform.stretch;
+    const float decayParam     = transform.decay;
+    const int N                = pipeline.getStretchedLength();
+    const bool synthErOnly     = transform.erOnly;
+    const int fullLen          = pipeline.getLength();
+    const int crossoverSamples = pipeline.getCrossoverSamples();
 
-    // Decay: exponential fade-out envelope (0% = flat, 100% = heavily damped) — UI reversed: left = more damped
-    float decayParam = 1.0f - apvts.getRawParameterValue (IDs::decay)->load();
-    int N = buffer.getNumSamples();
-    if (decayParam > 0.001f && N > 0)
+    if (isMainPath)
     {
-        for (int ch = 0; ch < buffer.getNumChannels(); ++ch)
-        {
-            float* p = buffer.getWritePointer (ch);
-            for (int i = 0; i < N; ++i)
-            {
-                float t = (float) i / (float) N;
-                float env = std::exp (-decayParam * 6.0f * t);
-                p[i] *= env;
-            }
-        }
-    }
+        // Waveform display copy: the transformed IR before channel expansion.
+        currentIRBuffer.setSize (pipeline.getNumDisplayChannels(), fullLen, false, false, true);
+        for (int ch = 0; ch < pipeline.getNumDisplayChannels(); ++ch)
+            currentIRBuffer.copyFrom (ch, 0, pipeline.getDisplayChannel (ch), fullLen);
+    }
+
+    // Arm the wet-signal crossfade BEFORE kicking off any background IR loads.
+    // processBlock will fade the wet bus from silence for kIRLoadFadeSamples samples,
+    // covering the window during which different convolvers may be running different IRs.
+    armIRLoadFade();
+
+    // Build the path's 8 kernels (ER + Tail × LL/RL/LR/RR) for the true-stereo
+    // convolver, which partitions them here on the message thread. A live-shaped
+    // path already has its bank.
+    TrueStereoConvolver::PathIR ir;
+    if (! liveShape)
+        ir = makePathKernels (pipeline, bufferSampleRate, currentSampleRate);
+
+    // Live tail: run the path's FDN on the audio instead of convolving its tail.
+    // Needs the IRSynthParams the IR came from, so synth IRs only; a reversed IR
+    // has no FDN-shaped tail and ER-only IRs have none at all. The networks are
+    // designed at (processing rate × Stretch), which stretches them exactly as
+    // the resampler above stretches the IR, and the Decay envelope exp (−6·d·t)
+    // becomes extra per-line loss. The level is calibrated against the tail
+    // kernels just built (LL and LR), which are then dropped — the convolver
+    // skips empty kernels, so the tail stages have nothing to do for this path.
+    // Live shape keeps the convolved tail: it shapes the tail kernels themselves.
+    auto& liveSlot = liveTailSlot (path);
+    if (liveTail && ! liveShape && fromSynth && ! reverse && ! synthErOnly && fullLen > crossoverSamples)
+    {
+        LiveFdnTail::Design design;
+        const int designRate = juce::roundToInt (currentSampleRate * stretchFactor);
+        design.lines = IRSynthEngine::designPathFDN (lastIRSynthParams,
+                                                     path == MicPath::Outrig  ? IRSynthEngine::TailPath::Outrig
+                                                   : path == MicPath::Ambient ? IRSynthEngine::TailPath::Ambient
+                                                                              : IRSynthEngine::TailPath::Main,
+                                                     designRate);
+        design.designRate = designRate;
+        design.diffusion  = lastIRSynthParams.diffusion;
+        design.onsetSamples = ir.tailOffset;
+        if (decayParam > 0.001f && N > 0)
+            design.extraDecayPerSample = 6.0 * decayParam * bufferSampleRate / ((double) N * currentSampleRate);
+
+        auto live = std::make_unique<LiveFdnTail>();
+        live->prepare (design);
+        live->calibrate (ir.tail[0].data(), (int) ir.tail[0].size(),
+                         ir.tail[2].data(), (int) ir.tail[2].size(), currentSampleRate);
+        liveSlot.publish (std::move (live));
+        for (auto& t : ir.tail)
+            t.clear();
+    }
+    else if (liveSlot.isPublished())
+    {
+        liveSlot.publish (std::make_unique<LiveFdnTail>());   // unprepared → convolved tail
+    }
+    if (liveShape)
+        trueStereoConv.loadShapedPath (tsPath, shapedBank);
+    else
+        trueStereoConv.loadPath (tsPath, ir);
 
-    // Trim trailing silence from ALL IRs — critical for synthesised factory IRs which are
-    // allocated at 8×RT60 (up to 60 s) but contain only 8–15 s of actual reverb signal.
-    // File-loaded factory IRs skip the fromSynth silence-trim block above, so without this
-    // they arrive with a huge silent tail that makes the NUPC background thread unable to
-    // keep up at small buffer sizes (persistent glitching). Threshold: −90 dB below peak.
-    // Synth IRs are already trimmed in the fromSynth block; this is a fast no-op for them.
-    {
-        const int nSamples = buffer.getNumSamples();
-        const int nCh      = buffer.getNumChannels();
+    if      (path == MicPath::Main)    mainIRLoaded   .store (true);
+    else if (path == MicPath::Outrig)  outrigIRLoaded .store (true);
+    else if (path == MicPath::Ambient) ambientIRLoaded.store (true);
+}
 
-        float peak = 1.0e-6f;
-        for (int ch = 0; ch < nCh; ++ch)
-        {
-            const float* p = buffer.getReadPointer (ch);
-            for (int i = 0; i < nSamples; ++i)
-                peak = juce::jmax (peak, std::abs (p[i]));
-        }
+//==============================================================================
+// Path hibernation (message thread, from timerCallback)
+//==============================================================================
 
-        // 10^(-90/20) ≈ 3.162e-5 — used both as (peak × factor) relative threshold
-        // and as an absolute −90 dBFS floor cap (for synth IRs whose peak > 1.0).
-        constexpr float kSilenceFactor = 3.1622777e-5f;
-        const float threshold = juce::jmin (peak * kSilenceFactor, kSilenceFactor);
+void PingProcessor::servicePathHibernation()
+{
+    static const juce::String* const kOnIds[4] { &IDs::mainOn, &IDs::directOn, &IDs::outrigOn, &IDs::ambientOn };
 
-        int lastSignificant = 0;
-        for (int ch = 0; ch < nCh; ++ch)
+    for (auto path : { MicPath::Direct, MicPath::Outrig, MicPath::Ambient })
+    {
+        const auto i = (size_t) path;
+        if (! isPathIRLoaded (path))
         {
-            const float* p = buffer.getReadPointer (ch);
-            for (int i = nSamples - 1; i >= 0; --i)
-            {
-                if (std::abs (p[i]) > threshold)
-                {
-                    lastSignificant = juce::jmax (lastSignificant, i);
-                    break;
-                }
-            }
+            pathOffTicks[i] = 0;
+            continue;
         }
 
-        const int safetyTail = (int) (0.5 * bufferSampleRate); // 500 ms (also fade length)
-        const int minLen     = (int) (0.3 * bufferSampleRate); // 300 ms floor
-        int newLen = juce::jmin (lastSignificant + safetyTail + 1, nSamples);
-        newLen     = juce::jmax (newLen, minLen);
-
-        if (newLen < nSamples)
-        {
-            juce::AudioBuffer<float> trimmed (nCh, newLen);
-            for (int ch = 0; ch < nCh; ++ch)
-                trimmed.copyFrom (ch, 0, buffer, ch, 0, newLen);
-            buffer = std::move (trimmed);
-
-            // End-fade: cosine fade over the last safetyTail (500 ms) samples to smooth
-            // the hard cut-point introduced above. Applied ONLY when we actually truncated —
-            // reloading an already-trimmed IR (factory preset, user-saved WAV, rawSynthBuffer)
-            // hits newLen == nSamples, skips both this branch and the fade, and therefore
-            // produces a bit-identical buffer on every reload. Without this gate the fade
-            // would compound (cos², cos³, …) and become audible under heavy output boost.
-            const int curLen    = buffer.getNumSamples();
-            const int curCh     = buffer.getNumChannels();
-            const int fadeSamps = juce::jmin (safetyTail, curLen);
-            const int fadeStart = curLen - fadeSamps;
-            for (int ch = 0; ch < curCh; ++ch)
-            {
-                float* p = buffer.getWritePointer (ch);
-                for (int i = fadeStart; i < curLen; ++i)
-                {
-                    const float t = (float)(i - fadeStart) / (float)juce::jmax (fadeSamps, 1);
-                    p[i] *= 0.5f * (1.0f + std::cos (juce::MathConstants<float>::pi * t));
-                }
-            }
+        if (apvts.getRawParameterValue (*kOnIds[i])->load() > 0.5f)
+        {
+            // Normally already woken by wakeSwitchedOnPaths; this is the backstop.
+            pathOffTicks[i] = 0;
+            if (pathHibernated[i])
+                wakePath (path);
+            continue;
         }
+
+        if (pathHibernated[i] || pathHibernateSeconds <= 0.0)
+            continue;
+        if (++pathOffTicks[i] * (double) kScratchServiceIntervalMs >= pathHibernateSeconds * 1000.0)
+            hibernatePath (path);
     }
+}
 
-    if (isMainPath)
-        currentIRBuffer = buffer;   // store original data for waveform display before any channel expansion
-    int numCh = buffer.getNumChannels();
-    int fullLen = buffer.getNumSamples();
-
-    // Expand mono/stereo IR to true-stereo 4-channel so all IRs share the same signal path.
-    // Cross-channels (iRL, iLR) are zero: a plain stereo file has no cross-channel IR content.
-    // Non-zero channels are scaled ×0.5 to cancel the ×2.0 trueStereoWetGain applied in
-    // processBlock, keeping output level consistent with the former stereo path.
-    // An additional −9 dB trim compensates for the observed level excess of file-based IRs
-    // relative to synthesised IRs. Synth IRs (numCh == 4) bypass this block entirely.
-    if (numCh < 4)
-    {
-        juce::AudioBuffer<float> expanded (4, fullLen);
-        expanded.clear();                                                 // zeroes iRL (ch1) and iLR (ch2)
-        expanded.copyFrom (0, 0, buffer, 0, 0, fullLen);                  // iLL = IR_L
-        expanded.applyGain (0, 0, fullLen, 0.5f);
-        const int srcRCh = (numCh >= 2) ? 1 : 0;                         // use ch0 for mono sources
-        expanded.copyFrom (3, 0, buffer, srcRCh, 0, fullLen);             // iRR = IR_R (or IR_L for mono)
-        expanded.applyGain (3, 0, fullLen, 0.5f);
-        expanded.applyGain (juce::Decibels::decibelsToGain (-15.0f));     // −15 dB: file IR level trim
-        buffer = std::move (expanded);
-        numCh  = 4;
-    }
-
-    const bool synthErOnly = fromSynth && lastIRSynthParams.er_only;
-    const double crossoverSeconds = fromSynth ? 0.085 : 0.080;
-    const double fadeSeconds = fromSynth ? 0.020 : 0.010;
-    const int crossoverSamples = synthErOnly ? fullLen : static_cast<int> (crossoverSeconds * bufferSampleRate);
-    const int fadeLength = static_cast<int> (fadeSeconds * bufferSampleRate);
-
-    if (numCh >= 4)
-    {
-        auto makeMonoEr = [&] (int ch)
-        {
-            int erLen = fullLen <= crossoverSamples ? fullLen : crossoverSamples + fadeLength;
-            juce::AudioBuffer<float> m (1, erLen);
-            m.copyFrom (0, 0, buffer, ch, 0, juce::jmin (erLen, fullLen));
-            if (fullLen > crossoverSamples)
-                for (int i = 0; i < fadeLength && (crossoverSamples + i) < erLen; ++i)
-                    m.applyGain (crossoverSamples + i, 1, 1.0f - (float) i / (float) fadeLength);
-            return m;
-        };
-        auto makeMonoTail = [&] (int ch)
-        {
-            if (synthErOnly || fullLen <= crossoverSamples)
-            {
-                juce::AudioBuffer<float> m (1, juce::jmax (64, fadeLength * 2));
-                m.clear();
-                return m;
-            }
-            int tailLen = fullLen - crossoverSamples;
-            juce::AudioBuffer<float> m (1, tailLen);
-            m.copyFrom (0, 0, buffer, ch, crossoverSamples, tailLen);
-            for (int i = 0; i < juce::jmin (fadeLength, tailLen); ++i)
-                m.applyGain (i, 1, (float) i / (float) fadeLength);
-            return m;
-        };
-        // Arm the wet-signal crossfade BEFORE kicking off any background IR loads.
-        // processBlock will fade the wet bus from silence for kIRLoadFadeSamples samples,
-        // covering the window during which different convolvers may be running different IRs.
-        irLoadFadeSamplesRemaining.store (kIRLoadFadeSamples);
+void PingProcessor::wakeSwitchedOnPaths()
+{
+    static const juce::String* const kOnIds[4] { &IDs::mainOn, &IDs::directOn, &IDs::outrigOn, &IDs::ambientOn };
 
-        // Select the destination 8-convolver set based on which mic path this load is for.
-        juce::dsp::Convolution* tsEr[4];
-        juce::dsp::Convolution* tsTail[4];
-        if (path == MicPath::Main)
-        {
-            tsEr[0]   = &tsErConvLL;   tsEr[1]   = &tsErConvRL;   tsEr[2]   = &tsErConvLR;   tsEr[3]   = &tsErConvRR;
-            tsTail[0] = &tsTailConvLL; tsTail[1] = &tsTailConvRL; tsTail[2] = &tsTailConvLR; tsTail[3] = &tsTailConvRR;
-        }
-        else if (path == MicPath::Outrig)
-        {
-            tsEr[0]   = &tsOutrigErConvLL;   tsEr[1]   = &tsOutrigErConvRL;   tsEr[2]   = &tsOutrigErConvLR;   tsEr[3]   = &tsOutrigErConvRR;
-            tsTail[0] = &tsOutrigTailConvLL; tsTail[1] = &tsOutrigTailConvRL; tsTail[2] = &tsOutrigTailConvLR; tsTail[3] = &tsOutrigTailConvRR;
-        }
-        else // Ambient
+    for (auto path : { MicPath::Direct, MicPath::Outrig, MicPath::Ambient })
+    {
+        const auto i = (size_t) path;
+        if (pathHibernated[i] && apvts.getRawParameterValue (*kOnIds[i])->load() > 0.5f)
         {
-            tsEr[0]   = &tsAmbErConvLL;   tsEr[1]   = &tsAmbErConvRL;   tsEr[2]   = &tsAmbErConvLR;   tsEr[3]   = &tsAmbErConvRR;
-            tsTail[0] = &tsAmbTailConvLL; tsTail[1] = &tsAmbTailConvRL; tsTail[2] = &tsAmbTailConvLR; tsTail[3] = &tsAmbTailConvRR;
+            pathOffTicks[i] = 0;
+            wakePath (path);
         }
+    }
+}
 
-        for (int c = 0; c < 4; ++c)
-            tsEr[c]->loadImpulseResponse (makeMonoEr (c), bufferSampleRate,
-                juce::dsp::Convolution::Stereo::no, juce::dsp::Convolution::Trim::no,
-                juce::dsp::Convolution::Normalise::no);
-        for (int c = 0; c < 4; ++c)
-            tsTail[c]->loadImpulseResponse (makeMonoTail (c), bufferSampleRate,
-                juce::dsp::Convolution::Stereo::no, juce::dsp::Convolution::Trim::no,
-                juce::dsp::Convolution::Normalise::no);
+void PingProcessor::hibernatePath (MicPath path)
+{
+    // The path keeps its *IRLoaded flag so the strip stays usable.
+    releasePathStorage (path);
+    pathHibernated[(size_t) path] = true;
+}
 
-        if      (path == MicPath::Main)    mainIRLoaded   .store (true);
-        else if (path == MicPath::Outrig)  outrigIRLoaded .store (true);
-        else if (path == MicPath::Ambient) ambientIRLoaded.store (true);
+void PingProcessor::releasePathStorage (MicPath path)
+{
+    // Kernels, bus workspaces and the live tail go back through releaseRetired once
+    // the audio thread has let go of them; the transform stages are message-thread
+    // only and go now.
+    trueStereoConv.unloadPath (path == MicPath::Main   ? TrueStereoConvolver::Main
+                             : path == MicPath::Direct ? TrueStereoConvolver::Direct
+                             : path == MicPath::Outrig ? TrueStereoConvolver::Outrig
+                                                       : TrueStereoConvolver::Ambient);
+    if (path != MicPath::Direct)
+    {
+        transformPipeline (path).release();
+        auto& liveSlot = liveTailSlot (path);
+        if (liveSlot.isPublished())
+            liveSlot.publish (std::make_unique<LiveFdnTail>());
+    }
+}
 
-        // Build a stereo combined-tail IR for the regular tailConvolver (main path only —
-        // this convolver drives the waveform thumbnail / secondary tail. Non-main mic paths
-        // don't contribute to that display).
-        if (isMainPath)
-        {
-            auto t0 = makeMonoTail (0);   // iLL tail
-            auto t1 = makeMonoTail (1);   // iRL tail  (== t0)
-            auto t2 = makeMonoTail (2);   // iLR tail
-            auto t3 = makeMonoTail (3);   // iRR tail  (== t2)
-            const int tailLen = t0.getNumSamples();
-            juce::AudioBuffer<float> combinedTail (2, tailLen);
-            for (int i = 0; i < tailLen; ++i)
-            {
-                combinedTail.setSample (0, i, t0.getSample (0, i) + t1.getSample (0, i));
-                combinedTail.setSample (1, i, t2.getSample (0, i) + t3.getSample (0, i));
-            }
-            tailConvolver.loadImpulseResponse (std::move (combinedTail), bufferSampleRate,
-                juce::dsp::Convolution::Stereo::yes,
-                juce::dsp::Convolution::Trim::no,
-                juce::dsp::Convolution::Normalise::no);
-        }
+void PingProcessor::wakePath (MicPath path)
+{
+    const auto i = (size_t) path;
+    pathHibernated[i] = false;
+
+    // No wet-bus fade: processChunk ramps this strip alone once its kernels are live.
+    const juce::ScopedValueSetter<bool> noWetFade (irLoadIsWake, true);
+    pathWaking[i].store (true);
+
+    // Reload with the current Stretch / Decay / Reverse / Live settings. A synth reload
+    // relabels the slot "<unsaved>"; keep whatever it showed before it slept.
+    const auto displayName = getPathIRDisplayName (path);
+    const auto& raw = path == MicPath::Direct ? rawSynthDirectBuffer
+                    : path == MicPath::Outrig ? rawSynthOutrigBuffer
+                                              : rawSynthAmbientBuffer;
+    juce::AudioBuffer<float> buf;
+    double fileSampleRate = 0.0;
+    if (pathSourceFile[i].existsAsFile() && readIRFile (pathSourceFile[i], buf, fileSampleRate))
+        loadIRFromBuffer (std::move (buf), fileSampleRate, /*fromSynth=*/false,
+                          /*deferConvolverLoad=*/false, path);
+    else if (pathSourceFile[i] == juce::File() && raw.getNumSamples() > 0)
+        loadIRFromBuffer (raw, rawSynthSampleRate, /*fromSynth=*/true,
+                          /*deferConvolverLoad=*/false, path);
+    else
+    {
+        // The file went away while the path slept — nothing left to play.
+        pathWaking[i].store (false);
+        clearMicPath (path);
+        return;
     }
+    setPathDisplayName (path, displayName);
 }
 
 
@@ -3437,6 +3560,9 @@ void PingProcessor::getStateInformation (juce::MemoryBlock& destData)
         if (selectedIRFile != juce::File())
             xml->setAttribute ("irFilePath", selectedIRFile.getFullPathName());
         xml->setAttribute ("reverse", reverse);
+        xml->setAttribute ("liveTail", liveTail);
+        xml->setAttribute ("liveShape", liveShape);
+        xml->setAttribute ("pathHibernateSeconds", pathHibernateSeconds);
         if (lastPresetName.isNotEmpty())
             xml->setAttribute ("presetName", lastPresetName);
         if (irFromSynth && rawSynthBuffer.getNumSamples() > 0)
@@ -3550,6 +3676,9 @@ void PingProcessor::setStateInformation (const void* data, int sizeInBytes)
         }
 
         reverse = xml->getBoolAttribute ("reverse", false);
+        liveTail = xml->getBoolAttribute ("liveTail", false);
+        liveShape = xml->getBoolAttribute ("liveShape", false);
+        setPathHibernateSeconds (xml->getDoubleAttribute ("pathHibernateSeconds", kDefaultPathHibernateSeconds));
         lastPresetName = xml->getStringAttribute ("presetName", "Default");
 
         // Pre-clear every mic path before loading whatever the preset actually contains.
@@ -3790,11 +3919,8 @@ void PingProcessor::setReverseTrim (float v)
 
 double PingProcessor::getTailLengthSeconds() const
 {
-    int erMax = juce::jmax (tsErConvLL.getCurrentIRSize(), tsErConvRL.getCurrentIRSize(),
-                            tsErConvLR.getCurrentIRSize(), tsErConvRR.getCurrentIRSize());
-    int tailMax = juce::jmax (tsTailConvLL.getCurrentIRSize(), tsTailConvRL.getCurrentIRSize(),
-                              tsTailConvLR.getCurrentIRSize(), tsTailConvRR.getCurrentIRSize());
-    int irSize = juce::jmax (erMax, tailMax);
+    // Longest MAIN kernel (ER or Tail) — the same figure the per-convolver sizes gave.
+    int irSize = trueStereoConv.getPathIRSize (TrueStereoConvolver::Main);
     if (currentSampleRate > 0 && irSize > 0)
         return irSize / currentSampleRate;
     return 0.0;
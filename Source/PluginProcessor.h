@@ -3,13 +3,20 @@
 #include <JuceHeader.h>
 #include <array>
 #include <vector>
+#include "DecodedIRCache.h"
 #include "IRManager.h"
+#include "IRTransformPipeline.h"
 #include "IRSynthEngine.h"
+#include "LiveFdnTail.h"
 #include "LicenceVerifier.h"
 #include "HP2ndOrder.h"
+#include "ProcessStageTimer.h"
+#include "ScratchArena.h"
+#include "TrueStereoConvolver.h"
 
 class PingProcessor : public juce::AudioProcessor,
-                      private juce::AudioProcessorParameter::Listener
+                      private juce::AudioProcessorParameter::Listener,
+                      private juce::Timer
 {
 public:
     PingProcessor();
@@ -64,9 +71,9 @@ public:
 
     /** Which microphone path a buffer is being loaded into.
         Main: existing behaviour — drives currentIRBuffer, waveform, combined-tail IR.
-        Direct: short-circuit load — no transforms, no ER/Tail split. 4 mono convolvers.
+        Direct: short-circuit load — no transforms, no ER/Tail split. 4 mono kernels.
         Outrig / Ambient: full pipeline (reverse/stretch/decay/trim/ER-Tail split) but into
-        their own 8-convolver sets; do NOT touch main state (currentIRBuffer, selectedIRFile). */
+        their own 8-kernel convolver paths; do NOT touch main state (currentIRBuffer, selectedIRFile). */
     enum class MicPath { Main, Direct, Outrig, Ambient };
 
     /** Load IR from buffer (e.g. reversed). Call from message thread.
@@ -87,10 +94,9 @@ public:
     /** Wipe all state belonging to a single mic path: the raw synth buffer slot, the
         per-path IR-loaded flag, and the display name (reset to "<empty>"). For MAIN,
         also clears currentIRBuffer / selectedIRFile / lastLoadedIRFile / irFromSynth.
-        Does NOT touch the underlying juce::dsp::Convolution objects: processBlock
-        gates each path on its *IRLoaded flag and skips the contribution when false,
-        so leaving stale IR data inside an unreachable convolver is harmless and
-        avoids any audio-thread interaction. Call from the message thread only.
+        Unloads the path's kernels and frees its transform stages and live tail
+        (releasePathStorage); the memory comes back on the next releaseRetired
+        tick. Call from the message thread only.
         Used when loading a preset / IR that does not populate this path, so the
         user can no longer accidentally enable a strip carrying audio from a
         previously-loaded preset. */
@@ -168,6 +174,42 @@ public:
     bool getReverse() const { return reverse; }
     void setReverse (bool v) { reverse = v; }
 
+    /** Live tail: a synthesised IR's tail runs as its FDN on the audio
+        (LiveFdnTail) instead of through the tail convolvers, which keep only
+        the ER window. Per instance, saved with the plugin state; applies from
+        the next IR load (reloadSynthIR). File IRs are always convolved. */
+    bool getLiveTail() const { return liveTail; }
+    void setLiveTail (bool v) { liveTail = v; }
+
+    /** Live shape: MAIN / OUTRIG / AMBIENT load a bank of Stretch points
+        rendered without the Decay envelope (kLiveShapeStretchPoints), and the
+        convolver applies Decay and interpolates Stretch while it runs, so
+        moving either knob no longer reloads the IR. Costs the kernel memory of
+        every point and up to two points' MACs per path; Live Tail is off while
+        it is on. Per instance, saved with the plugin state; applies from the
+        next IR load. Points are an octave apart over the knob's 0.5–2.0
+        range: the bank holds 3.5× the kernels of a plain load at Stretch 1.0
+        (0.5 + 1 + 2), and a load runs the transform chain four times. */
+    static constexpr std::array<float, 3> kLiveShapeStretchPoints { 0.5f, 1.0f, 2.0f };
+    bool getLiveShape() const { return liveShape; }
+    void setLiveShape (bool v) { liveShape = v; }
+
+    /** Path hibernation: once the DIRECT, OUTRIG or AMBIENT strip has been
+        switched off for this many seconds, the path's convolver kernels,
+        transform pipeline and live tail are released. Switching the strip
+        back on reloads it from where it came from (its sibling / orphan file,
+        or its raw synth buffer) straight away, and the strip ramps in over
+        kPathWakeFadeSamples without touching the other strips. A sleeping
+        path still counts as loaded for the mixer (isPathIRLoaded); IR reloads
+        while it sleeps only note the new source, so a preset or Stretch /
+        Decay edit costs nothing for it. MAIN is never hibernated. 0 keeps
+        every loaded path resident. Per instance, saved with the plugin state;
+        set from the mixer's right-click menu. */
+    static constexpr double kDefaultPathHibernateSeconds = 30.0;
+    double getPathHibernateSeconds() const { return pathHibernateSeconds; }
+    void setPathHibernateSeconds (double s) { pathHibernateSeconds = juce::jmax (0.0, s); }
+    bool isPathHibernated (MicPath path) const noexcept { return pathHibernated[(size_t) path]; }
+
     float getReverseTrim() const;
     void setReverseTrim (float v);
 
@@ -178,6 +220,13 @@ public:
     const IRSynthParams& getLastIRSynthParams() const { return lastIRSynthParams; }
     void setLastIRSynthParams (const IRSynthParams& p) { lastIRSynthParams = p; }
 
+    /** Message thread. While set, loadIRFromBuffer treats each load as a refinement of
+        the IR already playing (Calculate IR's full pass replacing its own preview): the
+        wet bus dips by ≤ 1 dB for kIRRefineFadeSamples instead of fading in from silence
+        over kIRLoadFadeSamples. The preview shares the full IR's early field, so only the
+        late tail changes at the swap. */
+    void setIRLoadIsRefinement (bool r) noexcept { irLoadIsRefinement = r; }
+
     /** Last loaded preset name — survives editor destroy/recreate and session save/load. */
     juce::String getLastPresetName() const { return lastPresetName; }
     void setLastPresetName (const juce::String& n) { lastPresetName = n; }
@@ -249,24 +298,79 @@ public:
     /** True while preset/session state is being restored (skip redundant IR reloads from APVTS callbacks). */
     bool getIsRestoringState() const noexcept { return isRestoringState.load(); }
 
+    /** Per-stage wall time of processBlock (see ProcessStageTimer.h). Only
+        PING_PROCESS_PROFILE builds record anything; read and reset it between
+        processBlock calls. */
+    ProcessStageTimer& getStageTimer() noexcept { return stageTimer; }
+
+   #if PING_PROCESS_PROFILE
+    /** Benchmark builds only: run processBlock unlicensed. Nothing is
+        persisted; the flag lives for this instance. */
+    void unlockForBenchmark() noexcept
+    {
+        currentLicence.valid   = true;
+        currentLicence.expired = false;
+    }
+   #endif
+
 private:
     juce::AudioProcessorValueTreeState apvts;
     juce::AudioProcessorValueTreeState::ParameterLayout createParameterLayout();
 
     IRManager irManager;
-    juce::dsp::Convolution tailConvolver;   // combined-tail IR for waveform display; audio uses ts* convolvers
-    juce::dsp::Convolution tsErConvLL, tsErConvRL, tsErConvLR, tsErConvRR;
-    juce::dsp::Convolution tsTailConvLL, tsTailConvRL, tsTailConvLR, tsTailConvRR;
-
-    // ── Multi-mic path convolvers (feature/multi-mic-paths) ──────────────────
-    // DIRECT: 4 mono convolvers, no ER/Tail split (IR is too short to split).
-    juce::dsp::Convolution tsDirectConvLL, tsDirectConvRL, tsDirectConvLR, tsDirectConvRR;
-    // OUTRIG: 8 mono convolvers (ER + Tail × true stereo), full pipeline.
-    juce::dsp::Convolution tsOutrigErConvLL,   tsOutrigErConvRL,   tsOutrigErConvLR,   tsOutrigErConvRR;
-    juce::dsp::Convolution tsOutrigTailConvLL, tsOutrigTailConvRL, tsOutrigTailConvLR, tsOutrigTailConvRR;
-    // AMBIENT: 8 mono convolvers (ER + Tail × true stereo), full pipeline.
-    juce::dsp::Convolution tsAmbErConvLL,      tsAmbErConvRL,      tsAmbErConvLR,      tsAmbErConvRR;
-    juce::dsp::Convolution tsAmbTailConvLL,    tsAmbTailConvRL,    tsAmbTailConvLR,    tsAmbTailConvRR;
+
+    // ── True-stereo convolution for every mic path ───────────────────────────
+    // One shared-input-FFT engine replaces the former 28 mono juce::dsp::Convolution
+    // instances (MAIN ER/Tail, DIRECT, OUTRIG ER/Tail, AMBIENT ER/Tail × LL/RL/LR/RR).
+    // L and R are transformed once per head partition; the long tail partitions
+    // run on the engine's own worker threads (see TrueStereoConvolver.h).
+    static constexpr int kConvolverWorkerThreads = 2;
+    TrueStereoConvolver trueStereoConv { kConvolverWorkerThreads };
+
+    // Live-tail networks for MAIN / OUTRIG / AMBIENT (liveTail on, synth IR).
+    // processChunk adds them into the tail buses after trueStereoConv.process.
+    LiveFdnTailSlot mainLiveTail, outrigLiveTail, ambientLiveTail;
+    LiveFdnTailSlot& liveTailSlot (MicPath path) noexcept
+    {
+        return path == MicPath::Outrig  ? outrigLiveTail
+             : path == MicPath::Ambient ? ambientLiveTail
+                                        : mainLiveTail;
+    }
+
+    // loadIRFromBuffer's transform chain for MAIN / OUTRIG / AMBIENT. Each keeps
+    // its stage results between loads, so a Stretch / Decay / Reverse edit only
+    // reruns the stages it changes (see IRTransformPipeline.h). DIRECT is never
+    // transformed. Message thread.
+    IRTransformPipeline mainTransform, outrigTransform, ambientTransform;
+    IRTransformPipeline& transformPipeline (MicPath path) noexcept
+    {
+        return path == MicPath::Outrig  ? outrigTransform
+             : path == MicPath::Ambient ? ambientTransform
+                                        : mainTransform;
+    }
+
+    // Path hibernation (message thread, see getPathHibernateSeconds). Indexed by
+    // MicPath. pathSourceFile is the file an aux path was loaded from, empty when
+    // it came from its rawSynth*Buffer.
+    double pathHibernateSeconds = kDefaultPathHibernateSeconds;
+    std::array<int, 4>        pathOffTicks {};     // service ticks the strip has been off
+    std::array<bool, 4>       pathHibernated {};
+    std::array<juce::File, 4> pathSourceFile;
+    std::array<int, 4>        pathOnParamIndex { -1, -1, -1, -1 };   // parameterValueChanged → wake
+    std::atomic<bool>         pathWakeRequested { false };           // set on any thread, polled by timerCallback
+    void servicePathHibernation();
+    void wakeSwitchedOnPaths();
+    void hibernatePath (MicPath path);
+    void wakePath (MicPath path);
+    void releasePathStorage (MicPath path);
+    std::atomic<bool>& pathIRLoadedFlag (MicPath path) noexcept
+    {
+        return path == MicPath::Direct  ? directIRLoaded
+             : path == MicPath::Outrig  ? outrigIRLoaded
+             : path == MicPath::Ambient ? ambientIRLoaded
+                                        : mainIRLoaded;
+    }
+
     juce::dsp::DelayLine<float, juce::dsp::DelayLineInterpolationTypes::Linear> predelayLine;
     juce::dsp::DelayLine<float, juce::dsp::DelayLineInterpolationTypes::Linear> chorusDelayLine;
     // Stereo decorrelation: 2-stage allpass on R only (7.13 ms, 14.27 ms), incommensurate with FDN
@@ -301,8 +405,7 @@ private:
     std::array<std::array<SimpleAllpass, kNumPlateStages>, 2> plateAPs; // [ch][stage]
     // 1-pole lowpass state for plateColour (one value per channel)
     std::array<float, 2> plateShelfState { 0.f, 0.f };
-    // Pre-allocated buffer for the processed plate signal (used across pre/post-convolution injection points)
-    juce::AudioBuffer<float> plateBuffer;
+    // The processed plate signal lives in scratch (PlateL/PlateR) for the duration of a block.
 
     // ── Bloom hybrid ──────────────────────────────────────────────────────────
     // 6-stage allpass cascade (reuses SimpleAllpass defined above).
@@ -317,9 +420,8 @@ private:
     // Circular buffer holds post-EQ wet signal for feedback re-injection
     std::array<std::vector<float>, 2> bloomFbBufs;
     std::array<int, 2>                bloomFbWritePtrs { 0, 0 };
-    // Per-block intermediate buffer: cascade output stored here so both the IR-feed
+    // Per-block cascade output lives in scratch (BloomL/BloomR) so both the IR-feed
     // injection (pre-conv) and the volume injection (post-conv) read the same values.
-    juce::AudioBuffer<float> bloomBuffer;
 
     // ── Cloud Granular Delay ──────────────────────────────────────────────────
     // Pre-convolution granular delay engine. Reads Hann-windowed grains at
@@ -362,8 +464,7 @@ private:
     // g = 0.65f on all stages. effLen = 0 (uses buf.size()). Allocated in prepareToPlay.
     std::array<std::array<SimpleAllpass, kNumCloudDiffuseStages>, 2> cloudDiffuseAPs; // [ch][stage]
 
-    // Same-block bridge: written pre-conv, read post-blend.
-    juce::AudioBuffer<float> cloudBuffer;
+    // Same-block bridge (written pre-conv, read post-blend) lives in scratch (CloudL/CloudR).
 
     // ── Shimmer ───────────────────────────────────────────────────────────────
     // 8-voice harmonic shimmer cloud. Every voice reads the CLEAN pre-conv dry
@@ -405,7 +506,7 @@ private:
 
     // [voice][ch] — 8 harmonic voices × 2 channels
     std::array<std::array<ShimmerVoice, 2>, kNumShimVoices> shimVoicesHarm;
-    juce::AudioBuffer<float> shimBuffer;    // per-block scratch: sum of all voice outputs
+    // Per-block sum of all voice outputs lives in scratch (ShimL/ShimR).
     uint32_t                 shimRng = 0x92d68ca2u; // LCG for per-grain delay jitter
 
     // Per-voice LFO state (main delay LFO at 0.5 Hz; allpass LFO at 0.2 Hz).
@@ -438,6 +539,9 @@ private:
     juce::SmoothedValue<float> saturatorDriveSmoothed;
     juce::SmoothedValue<float> erLevelSmoothed;
     juce::SmoothedValue<float> tailLevelSmoothed;
+    // Live shape: damping (1 − Decay) and Stretch as the convolver applies them.
+    juce::SmoothedValue<float> shapeDampingSmoothed;
+    juce::SmoothedValue<float, juce::ValueSmoothingTypes::Multiplicative> shapeStretchSmoothed;
 
     // Per-mic-path mixer strips (MAIN / DIRECT / OUTRIG / AMBIENT).
     // Each strip has a smoothed linear gain and a 2nd-order HP. Pan is sampled once per block
@@ -494,6 +598,15 @@ private:
     std::atomic<bool> directConvPrevReady  { false };
     std::atomic<bool> outrigConvPrevReady  { false };
     std::atomic<bool> ambientConvPrevReady { false };
+
+    // A woken path's kernels come up cold, so its first ready block gets its own
+    // short ramp instead of the full wet-bus re-arm above. pathWaking is set by
+    // wakePath (message thread) and consumed by processChunk at the not-ready →
+    // ready edge; pathWakeFadeRemaining is audio thread only. Indexed by MicPath.
+    static constexpr int kPathWakeFadeSamples = 2400;
+    std::array<std::atomic<bool>, 4> pathWaking {};
+    std::array<int, 4>               pathWakeFadeRemaining {};
+
     double rawSynthSampleRate = 48000.0;           // shared — all four paths share the same SR
     double currentSampleRate = 48000.0;
     juce::File selectedIRFile;   // empty = synth IR or nothing loaded
@@ -507,6 +620,8 @@ private:
     double synthesizedIRSampleRate = 48000.0;
     double currentIRSampleRate = 48000.0;
     bool reverse = false;
+    bool liveTail = false;
+    bool liveShape = false;
     float lfoPhase = 0.0f;
     float tailLfoPhase = 0.0f;
     juce::File lastLoadedIRFile;
@@ -523,6 +638,13 @@ private:
     static constexpr int kIRLoadFadeSamples = 48000; // 1 s at 48 kHz — sample-based fade is
                                                       // consistent across buffer sizes (block-count
                                                       // fades collapse to ~170 ms at 128-sample buffers)
+    // Refinement loads (setIRLoadIsRefinement) arm the same counter with a short
+    // remainder: processBlock's fade then starts at 1 − 4800/48000 = 0.9 (−0.9 dB)
+    // and recovers over 100 ms, masking the tail swap without an audible dropout.
+    static constexpr int kIRRefineFadeSamples = 4800;
+    bool irLoadIsRefinement = false;   // message thread only
+    bool irLoadIsWake       = false;   // message thread only — wakePath, no wet fade
+    void armIRLoadFade() noexcept;
 
     // Set to true at the start of setStateInformation, cleared asynchronously (via
     // MessageManager::callAsync) AFTER all queued parameterChanged notifications have fired.
@@ -540,6 +662,36 @@ private:
     void parameterValueChanged (int parameterIndex, float newValue) override;
     void parameterGestureChanged (int, bool) override {}
 
+    // Preallocated per-block scratch for processBlock (see ScratchArena.h). Sized from
+    // samplesPerBlock in prepareToPlay; if a host delivers a larger block, processBlock
+    // splits it into arena-sized chunks and the regrow happens here on the message thread
+    // (timerCallback → serviceRegrow), never on the audio thread. The same timer frees
+    // convolver kernels and live tails the audio thread has swapped out after an IR load,
+    // and hibernates / wakes the aux paths.
+    ScratchArena scratch;
+    static constexpr int kScratchServiceIntervalMs = 200;
+    void timerCallback() override
+    {
+        scratch.serviceRegrow();
+        if (pathWakeRequested.exchange (false))
+            wakeSwitchedOnPaths();
+        servicePathHibernation();
+        trueStereoConv.releaseRetired();
+        for (auto* t : { &mainLiveTail, &outrigLiveTail, &ambientLiveTail })
+            t->releaseRetired();
+    }
+
+    // One arena-sized slice of processBlock. numSamples <= scratch.capacity().
+    void processChunk (juce::AudioBuffer<float>& buffer);
+    ProcessStageTimer stageTimer;
+
+    // Decodes an IR file into dest (one channel per file channel) and returns
+    // false if it cannot be read. Goes through DecodedIRCache::shared(), so
+    // reloading an unchanged file — every Stretch / Decay / Reverse / trim
+    // edit reloads the MAIN file and its siblings — costs a copy, not a
+    // disk read and decode. Message thread.
+    bool readIRFile (const juce::File& file, juce::AudioBuffer<float>& dest, double& sampleRate);
+
     // Set to true the first time prepareToPlay completes.  Used in setStateInformation to
     // distinguish an initial session load (prepareToPlay not yet run) from a live preset switch.
     // During initial load, loadImpulseResponse must NOT be called before prepareToPlay resets and
@@ -0,0 +1,71 @@
+#pragma once
+
+#include <array>
+#include <chrono>
+
+// ── processBlock stage timer ────────────────────────────────────────────────
+// Wall time of each stage of PingProcessor::processChunk, for the headless
+// PingProcessBench harness (Tools/process_benchmark.cpp). processChunk calls
+// start() on entry and lap (stage) at the end of each stage; a lap charges
+// the time since the previous mark to that stage, so the stages tile the
+// whole chunk. Times accumulate across the chunks of an oversized host block
+// until the caller reads and resets them.
+//
+//   Input     dry copy, input meter, predelay, input gain, saturator
+//   Plate / Bloom / Cloud / Shimmer
+//             each pre-convolution effect (its bypass branch when off)
+//   Convolve  trueStereoConv.process for every active path
+//   LiveTail  the LiveFdnTail networks added into the tail buses
+//   Mixer     strip parameters, crossfeed, HP / gain / pan and the path sum
+//   Post      EQ, decorrelation, wet modulation, tail chorus
+//   Output    output gain, load fade, spectrum tap, dry/wet, Bloom / Cloud
+//             volume and the output meter
+//
+// Compiled in only when PING_PROCESS_PROFILE is non-zero (the benchmark
+// target sets it). Plugin builds leave it at 0, where start() and lap()
+// compile down to nothing and the stage times stay zero.
+// ───────────────────────────────────────────────────────────────────────────
+#ifndef PING_PROCESS_PROFILE
+ #define PING_PROCESS_PROFILE 0
+#endif
+
+class ProcessStageTimer
+{
+public:
+    enum Stage { Input, Plate, Bloom, Cloud, Shimmer, Convolve, LiveTail, Mixer, Post, Output, kNumStages };
+
+    static const char* name (int stage) noexcept
+    {
+        static constexpr const char* names[kNumStages] {
+            "input", "plate", "bloom", "cloud", "shimmer",
+            "convolve", "liveTail", "mixer", "post", "output"
+        };
+        return stage >= 0 && stage < kNumStages ? names[stage] : "?";
+    }
+
+   #if PING_PROCESS_PROFILE
+    void start() noexcept { mark = Clock::now(); }
+
+    void lap (Stage s) noexcept
+    {
+        const auto now = Clock::now();
+        ns[(size_t) s] += std::chrono::duration<double, std::nano> (now - mark).count();
+        mark = now;
+    }
+   #else
+    void start() noexcept {}
+    void lap (Stage) noexcept {}
+   #endif
+
+    /** Nanoseconds per stage since the last reset(). Audio thread writes;
+        read between processBlock calls only. */
+    const std::array<double, kNumStages>& stageNs() const noexcept { return ns; }
+    void reset() noexcept { ns.fill (0.0); }
+
+private:
+    using Clock = std::chrono::steady_clock;
+    std::array<double, kNumStages> ns {};
+   #if PING_PROCESS_PROFILE
+    Clock::time_point mark {};
+   #endif
+};
@@ -0,0 +1,140 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <memory>
+#include <vector>
+
+// ── ScratchArena ────────────────────────────────────────────────────────────
+// Preallocated per-block scratch storage for PingProcessor::processBlock.
+//
+// Every intermediate buffer processBlock needs (dry copy, convolver inputs,
+// the TrueStereoConvolver output buses and the Plate / Bloom / Cloud /
+// Shimmer bridges) is a fixed Slot in one contiguous allocation made
+// from prepareToPlay. processBlock wraps the slots in non-owning
+// juce::AudioBuffer views, so the audio thread never touches the heap.
+// Pure header — no JUCE dependency — so it is linkable from both the plugin
+// and the test binary (see DSP_23).
+//
+// Oversized host blocks:
+//   • The audio thread never reallocates. If a block is larger than
+//     capacity(), processBlock splits it into capacity()-sized chunks and
+//     calls requestCapacity() to record the size it actually needed.
+//   • The message thread calls serviceRegrow() (PingProcessor's timer).
+//     That frees any arena the audio thread has retired, and builds a larger
+//     arena when one was requested. The new arena is published through the
+//     lock-free `pending` slot.
+//   • At the top of the next block the audio thread calls adoptPending().
+//     It swaps the new arena in and hands the old one to `retired`, so the
+//     free happens on the message thread as well.
+//   A second pending arena is never adopted while `retired` is still
+//   occupied, so no arena is ever leaked or freed by the audio thread.
+//
+// Threading contract: prepare() and the destructor must not race with the
+// audio thread (the usual prepareToPlay / destruction guarantees).
+// ───────────────────────────────────────────────────────────────────────────
+class ScratchArena
+{
+public:
+    enum Slot : int
+    {
+        DryL, DryR,               // untouched input copy for the dry/wet blend
+        ConvInL, ConvInR,         // post-FX convolver input (shared by every mic path)
+        ConvBus0,                     // TrueStereoConvolver output buses, one slot
+        ConvBusLast = ConvBus0 + 9,   // per TrueStereoConvolver::Bus (10 mono buses)
+        PlateL, PlateR,
+        BloomL, BloomR,
+        CloudL, CloudR,
+        ShimL, ShimR,
+        kNumSlots
+    };
+
+    ScratchArena() = default;
+    ~ScratchArena()
+    {
+        delete pending.exchange (nullptr);
+        delete retired.exchange (nullptr);
+    }
+
+    /** Allocates an arena of maxBlockSize samples per slot, dropping any
+        pending / retired arenas. Non-RT; must not race with the audio thread. */
+    void prepare (int maxBlockSize)
+    {
+        delete pending.exchange (nullptr);
+        delete retired.exchange (nullptr);
+        active.reset (new Storage (maxBlockSize));
+        publishedCapacity.store (active->capacity);
+        requested.store (0);
+    }
+
+    /** Audio thread, once per block before any slot is used. Installs a
+        regrown arena published by serviceRegrow(). Never allocates or frees. */
+    void adoptPending() noexcept
+    {
+        if (retired.load (std::memory_order_acquire) != nullptr)
+            return;
+        if (auto* fresh = pending.exchange (nullptr, std::memory_order_acq_rel))
+        {
+            retired.store (active.release(), std::memory_order_release);
+            active.reset (fresh);
+        }
+    }
+
+    /** Audio thread. Samples per slot available in the active arena. */
+    int capacity() const noexcept { return active != nullptr ? active->capacity : 0; }
+
+    /** Audio thread. Records that a block of numSamples arrived; the next
+        serviceRegrow() grows the arena to at least that size. */
+    void requestCapacity (int numSamples) noexcept
+    {
+        int cur = requested.load (std::memory_order_relaxed);
+        while (numSamples > cur
+               && ! requested.compare_exchange_weak (cur, numSamples, std::memory_order_relaxed))
+        {}
+    }
+
+    /** Message thread. Frees retired arenas and publishes a larger one when a
+        block bigger than the current arena has been seen. */
+    void serviceRegrow()
+    {
+        delete retired.exchange (nullptr, std::memory_order_acq_rel);
+
+        const int want = requested.load (std::memory_order_relaxed);
+        if (want <= publishedCapacity.load (std::memory_order_relaxed))
+            return;
+
+        auto* grown = new Storage (want);
+        // An older pending arena the audio thread has not picked up yet is
+        // superseded; exchange() guarantees only one side ever owns it.
+        delete pending.exchange (grown, std::memory_order_acq_rel);
+        publishedCapacity.store (want, std::memory_order_relaxed);
+    }
+
+    /** Audio thread. Channel-pointer array starting at `first`, suitable for
+        the non-owning juce::AudioBuffer constructor / setDataToReferTo(). */
+    float* const* channels (Slot first) noexcept { return active->ptrs.data() + first; }
+    float*        channel  (Slot s)     noexcept { return active->ptrs[(size_t) s]; }
+
+private:
+    struct Storage
+    {
+        explicit Storage (int numSamples)
+            : capacity (std::max (1, numSamples)),
+              data ((size_t) capacity * kNumSlots, 0.0f)
+        {
+            for (int s = 0; s < kNumSlots; ++s)
+                ptrs[(size_t) s] = data.data() + (size_t) s * (size_t) capacity;
+        }
+
+        const int capacity;
+        std::vector<float> data;
+        std::array<float*, kNumSlots> ptrs {};
+    };
+
+    std::unique_ptr<Storage> active;                 // audio thread only (after prepare)
+    std::atomic<Storage*>    pending { nullptr };    // message → audio
+    std::atomic<Storage*>    retired { nullptr };    // audio → message
+    std::atomic<int>         requested { 0 };
+    std::atomic<int>         publishedCapacity { 0 };
+};
@@ -0,0 +1,98 @@
+#pragma once
+
+#include <cstddef>
+#include <iomanip>
+#include <locale>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// ── SynthProfile ────────────────────────────────────────────────────────────
+// Per-stage timing and memory record of one synthIR call, carried in
+// IRSynthResult::profile, shown by IRSynthComponent's profile overlay and
+// written by generate_factory_irs / rebake_factory_irs --profile.
+//
+// synthIR appends the stages of each path it ran, path by path (main,
+// outrig, ambient, direct) and in execution order within a path:
+//
+//   main     lattice · refs · render · seed · fdn · mix · modal · output
+//   outrig / ambient
+//            refs · render · seed · fdn · mix · modal · output
+//   direct   direct
+//
+// A path served whole from SynthStageCache has a single "cached" stage.
+// OUTRIG / AMBIENT build their image lattices inside refs. ER-only mode has
+// no fdn stage (MAIN's mix is then the ER taper), and OUTRIG / AMBIENT skip
+// seed as well — their renders feed the taper directly.
+//
+//   • wallMs    — stage start to the end of its last task. A thread waiting
+//                 on a stage runs other queued tasks meanwhile, so with
+//                 several paths in flight this can include their work.
+//   • cpuMs     — thread CPU time summed over the stage's tasks; 0 where the
+//                 platform has no per-thread CPU clock.
+//   • peakBytes — the most the stage's own buffers (its outputs and working
+//                 copies) hold at once. Temporaries inside a single kernel
+//                 call are not counted.
+//   • items     — image sources (lattice), reflections (refs, render), FDN
+//                 samples (fdn), IR samples (the other buffer stages).
+//   • nodes     — accepted polygon image-source nodes (refs, polygon rooms).
+//   • cacheHits — channels a stage took from SynthStageCache instead of
+//                 computing.
+//
+// Pure header — no JUCE dependency — so the test binary and Tools link it.
+// ───────────────────────────────────────────────────────────────────────────
+struct SynthProfile
+{
+    struct Stage
+    {
+        std::string path;     // "main", "outrig", "ambient", "direct"
+        std::string stage;
+        double wallMs    = 0.0;
+        double cpuMs     = 0.0;
+        size_t peakBytes = 0;
+        size_t items     = 0;
+        size_t nodes     = 0;
+        size_t cacheHits = 0;
+    };
+
+    std::vector<Stage> stages;
+    double totalWallMs = 0.0;   // the whole synthIR call
+
+    /** The named stage of a path, or nullptr if that stage did not run. */
+    const Stage* find (const std::string& path, const std::string& stage) const noexcept
+    {
+        for (const auto& s : stages)
+            if (s.path == path && s.stage == stage)
+                return &s;
+        return nullptr;
+    }
+
+    /** Sum of cpuMs over every stage. */
+    double totalCpuMs() const noexcept
+    {
+        double sum = 0.0;
+        for (const auto& s : stages)
+            sum += s.cpuMs;
+        return sum;
+    }
+
+    /** One JSON object: { "totalWallMs", "totalCpuMs", "stages": [ … ] }. */
+    std::string toJson() const
+    {
+        std::ostringstream o;
+        o.imbue (std::locale::classic());
+        o << std::fixed << std::setprecision (3);
+        o << "{\"totalWallMs\":" << totalWallMs << ",\"totalCpuMs\":" << totalCpuMs() << ",\"stages\":[";
+        for (size_t i = 0; i < stages.size(); ++i)
+        {
+            const Stage& s = stages[i];
+            o << (i > 0 ? "," : "")
+              << "{\"path\":\"" << s.path << "\",\"stage\":\"" << s.stage << "\""
+              << ",\"wallMs\":" << s.wallMs << ",\"cpuMs\":" << s.cpuMs
+              << ",\"peakBytes\":" << s.peakBytes << ",\"items\":" << s.items
+              << ",\"nodes\":" << s.nodes << ",\"cacheHits\":" << s.cacheHits << "}";
+        }
+        o << "]}";
+        return o.str();
+    }
+};
@@ -0,0 +1,154 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <typeinfo>
+#include <utility>
+#include <vector>
+
+#include "ByteBudgetLRU.h"
+
+// ── SynthStageCache ─────────────────────────────────────────────────────────
+// Content-addressed cache of intermediate IRSynthEngine stage results, so a
+// re-synthesis after a small edit only recomputes the stages that edit
+// invalidated.
+//
+// Keys are 64-bit hashes (KeyBuilder) of exactly the inputs a stage
+// consumes. A stage downstream of another hashes the upstream key instead of
+// the upstream data, so the keys form a chain: image-source inputs → band
+// render → FDN tail → finished mic path. Moving the OUTRIG mic changes only
+// OUTRIG's image-source keys; MAIN's path key is unchanged and MAIN comes
+// straight out of the cache.
+//
+// Values are immutable (shared_ptr<const T>), so a hit costs a lookup and
+// an entry can be evicted while a synth still reads it. Storage, the byte
+// budget and LRU eviction are ByteBudgetLRU's. A budget of 0 (the default)
+// disables the cache: find() always misses and insert() does nothing. The
+// test binary and the offline Tools therefore run every stage; the plugin
+// turns it on (IRSynthComponent).
+//
+// Thread-safe (ByteBudgetLRU's mutex). Pure header — no JUCE dependency —
+// like SynthTaskPool.
+// ───────────────────────────────────────────────────────────────────────────
+class SynthStageCache
+{
+public:
+    using Key = uint64_t;
+
+    /** Budget the IR Synth page uses. A 17 s mic path keeps ~65 MB of stage
+        results, so this holds MAIN, OUTRIG and AMBIENT plus their previews. */
+    static constexpr size_t kInteractiveBudgetBytes = (size_t) 384 << 20;
+
+    /** Incremental 64-bit key. Feed every input a stage reads, in a fixed
+        order; doubles are hashed by bit pattern. */
+    class KeyBuilder
+    {
+    public:
+        explicit KeyBuilder (const char* stageTag) { add (std::string (stageTag)); }
+
+        KeyBuilder& add (uint64_t v) noexcept
+        {
+            h = (h ^ v) * 0x100000001b3ull;
+            h ^= h >> 29;
+            return *this;
+        }
+        KeyBuilder& add (double v) noexcept
+        {
+            uint64_t bits = 0;
+            std::memcpy (&bits, &v, sizeof (bits));
+            return add (bits);
+        }
+        KeyBuilder& add (int v) noexcept      { return add ((uint64_t) (int64_t) v); }
+        KeyBuilder& add (uint32_t v) noexcept { return add ((uint64_t) v); }
+        KeyBuilder& add (bool v) noexcept     { return add ((uint64_t) (v ? 1 : 0)); }
+        KeyBuilder& add (const std::string& s) noexcept
+        {
+            add ((uint64_t) s.size());
+            for (unsigned char c : s)
+                add ((uint64_t) c);
+            return *this;
+        }
+        template <size_t N>
+        KeyBuilder& add (const std::array<double, N>& a) noexcept
+        {
+            for (double v : a)
+                add (v);
+            return *this;
+        }
+        KeyBuilder& add (const std::vector<double>& v) noexcept
+        {
+            add ((uint64_t) v.size());
+            for (double x : v)
+                add (x);
+            return *this;
+        }
+
+        /** Final avalanche (splitmix64). */
+        Key get() const noexcept
+        {
+            uint64_t z = h + 0x9e3779b97f4a7c15ull;
+            z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+            z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+            return z ^ (z >> 31);
+        }
+
+    private:
+        uint64_t h = 0xcbf29ce484222325ull;
+    };
+
+    using Stats = ByteBudgetLRUStats;
+
+    explicit SynthStageCache (size_t budget = 0) : store (budget) {}
+
+    /** Process-wide cache shared by every synth (and every plugin instance). */
+    static SynthStageCache& shared()
+    {
+        static SynthStageCache cache;
+        return cache;
+    }
+
+    /** Sets the byte budget, evicting down to it. 0 disables and empties the
+        cache. */
+    void setBudgetBytes (size_t budget) { store.setBudgetBytes (budget); }
+    size_t getBudgetBytes() const       { return store.getBudgetBytes(); }
+    bool isEnabled() const              { return getBudgetBytes() > 0; }
+
+    /** The entry stored under key, or nullptr. A hit makes it most recently
+        used; an entry of another type counts as a miss. */
+    template <typename T>
+    std::shared_ptr<const T> find (Key key)
+    {
+        Entry e;
+        if (! store.find (key, e, [] (const Entry& stored) { return *stored.type == typeid (T); }))
+            return nullptr;
+        return std::static_pointer_cast<const T> (e.value);
+    }
+
+    /** Stores value under key (replacing any entry there), then evicts the
+        least recently used entries until the total fits the budget. A value
+        larger than the whole budget is not stored. */
+    template <typename T>
+    void insert (Key key, std::shared_ptr<const T> value, size_t bytes)
+    {
+        if (value != nullptr)
+            store.insert (key, Entry { std::move (value), &typeid (T) }, bytes);
+    }
+
+    void clear()             { store.clear(); }
+    Stats getStats() const   { return store.getStats(); }
+
+private:
+    struct Entry
+    {
+        std::shared_ptr<const void> value;
+        const std::type_info* type = nullptr;
+    };
+
+    ByteBudgetLRU<Key, Entry> store;
+
+    SynthStageCache (const SynthStageCache&) = delete;
+    SynthStageCache& operator= (const SynthStageCache&) = delete;
+};
@@ -0,0 +1,316 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+// ── SynthTaskPool ───────────────────────────────────────────────────────────
+// Work-stealing task scheduler shared by IRSynthEngine and the offline
+// Tools.
+//
+// synthIR runs each enabled mic path as a task. synthMainPath then forks its
+// per-channel stages (image sources → band render → FDN (L / R) → modal bank
+// → output filters) as nested tasks, one TaskGroup per stage. wait() is the
+// edge to the next stage. Every task writes only its own output, and the
+// merge order is fixed in code, so the result is bit-identical to a serial
+// run (IR_11 / IR_14). The batch tools submit one task per venue on the same
+// pool.
+//
+// Scheduling:
+//   • Each worker owns a deque. Tasks forked from inside a task go onto the
+//     forking worker's deque; tasks submitted from any other thread go onto
+//     a shared injection queue.
+//   • A worker pops its own deque newest-first (depth-first, cache-warm);
+//     idle workers steal oldest-first from the injection queue and the
+//     other workers, so big outer tasks spread out before their children.
+//   • A thread blocked in TaskGroup::wait() keeps running queued tasks
+//     (its own deque first) instead of sleeping. Nested groups therefore
+//     never deadlock and never add threads: the machine runs at most
+//     getNumThreads() workers plus the threads that submitted work. A pool
+//     of zero threads degrades to a serial run on the waiting thread.
+//
+// Cancellation is cooperative. A group's CancellationToken can be shared
+// with nested groups. Once it is cancelled, queued tasks of those groups are
+// dropped without running, and long-running tasks may poll isCancelled() to
+// return early.
+//
+// Pure header — no JUCE dependency — so the test binary and the offline
+// Tools link it without extra sources.
+// ───────────────────────────────────────────────────────────────────────────
+class SynthTaskPool
+{
+public:
+    /** Starts numThreads workers (0 = every task runs on the thread that waits). */
+    explicit SynthTaskPool (int numThreads)
+    {
+        numThreads = std::max (0, numThreads);
+        for (int i = 0; i <= numThreads; ++i)            // [numThreads] = injection queue
+            queues.emplace_back (new Queue());
+        for (int i = 0; i < numThreads; ++i)
+            workers.emplace_back ([this, i] { workerLoop (i); });
+    }
+
+    ~SynthTaskPool()
+    {
+        {
+            std::lock_guard<std::mutex> lock (sleepMutex);
+            quit = true;
+        }
+        wake.notify_all();
+        for (auto& w : workers)
+            w.join();
+    }
+
+    /** Process-wide pool. Defaults to one worker per core, less the calling
+        thread. */
+    static SynthTaskPool& shared()
+    {
+        auto& holder = sharedHolder();
+        std::lock_guard<std::mutex> lock (holder.mutex);
+        if (holder.pool == nullptr)
+            holder.pool.reset (new SynthTaskPool (defaultNumThreads()));
+        return *holder.pool;
+    }
+
+    /** Rebuilds the shared pool with numThreads workers. Call while no work
+        is queued or running on it (at start-up, e.g. a tool's --threads flag). */
+    static void setSharedNumThreads (int numThreads)
+    {
+        auto& holder = sharedHolder();
+        std::lock_guard<std::mutex> lock (holder.mutex);
+        holder.pool.reset();
+        holder.pool.reset (new SynthTaskPool (numThreads));
+    }
+
+    static int defaultNumThreads() noexcept
+    {
+        return std::max (0, (int) std::thread::hardware_concurrency() - 1);
+    }
+
+    int getNumThreads() const noexcept { return (int) workers.size(); }
+
+    /** Shared cancellation flag. Copies refer to the same flag. */
+    class CancellationToken
+    {
+    public:
+        CancellationToken() : flag (std::make_shared<std::atomic<bool>> (false)) {}
+
+        void cancel() noexcept            { flag->store (true, std::memory_order_release); }
+        bool isCancelled() const noexcept { return flag->load (std::memory_order_acquire); }
+
+    private:
+        std::shared_ptr<std::atomic<bool>> flag;
+    };
+
+    /** A set of tasks joined by wait(). Not copyable; wait() before destruction. */
+    class TaskGroup
+    {
+    public:
+        explicit TaskGroup (SynthTaskPool& p = SynthTaskPool::shared(),
+                            CancellationToken cancellation = {})
+            : pool (p), token (std::move (cancellation)) {}
+
+        ~TaskGroup() { waitNoThrow(); }
+
+        /** Queues fn. It may start immediately on a worker. */
+        void run (std::function<void()> fn)
+        {
+            pending.fetch_add (1, std::memory_order_relaxed);
+            pool.push ({ std::move (fn), this });
+        }
+
+        /** Blocks until every task of this group has finished or been
+            dropped, running queued tasks (of any group) meanwhile. Rethrows
+            the first task exception. */
+        void wait()
+        {
+            waitNoThrow();
+            if (error != nullptr)
+                std::rethrow_exception (std::exchange (error, nullptr));
+        }
+
+        /** Drops this group's queued tasks (and those of any group sharing
+            the token); running tasks see isCancelled(). */
+        void cancel() noexcept                          { token.cancel(); }
+        bool isCancelled() const noexcept               { return token.isCancelled(); }
+        const CancellationToken& getToken() const noexcept { return token; }
+
+    private:
+        friend class SynthTaskPool;
+
+        void waitNoThrow()
+        {
+            while (pending.load (std::memory_order_acquire) > 0)
+                if (! pool.runOneTask())
+                    pool.sleepUntil ([this] { return pending.load (std::memory_order_acquire) == 0; });
+        }
+
+        SynthTaskPool& pool;
+        CancellationToken token;
+        std::atomic<int> pending { 0 };
+        std::mutex errorMutex;
+        std::exception_ptr error;
+
+        TaskGroup (const TaskGroup&) = delete;
+        TaskGroup& operator= (const TaskGroup&) = delete;
+    };
+
+private:
+    struct Task
+    {
+        std::function<void()> fn;
+        TaskGroup* group = nullptr;
+    };
+
+    struct Queue
+    {
+        std::mutex mutex;
+        std::deque<Task> tasks;
+    };
+
+    struct SharedHolder
+    {
+        std::mutex mutex;
+        std::unique_ptr<SynthTaskPool> pool;
+    };
+
+    static SharedHolder& sharedHolder()
+    {
+        static SharedHolder holder;
+        return holder;
+    }
+
+    // Worker identity of the calling thread (-1 / nullptr outside any pool).
+    static inline thread_local SynthTaskPool* currentPool = nullptr;
+    static inline thread_local int currentWorker = -1;
+
+    int localQueue() const noexcept
+    {
+        return currentPool == this ? currentWorker : (int) workers.size();
+    }
+
+    void push (Task task)
+    {
+        auto& q = *queues[(size_t) localQueue()];
+        {
+            std::lock_guard<std::mutex> lock (q.mutex);
+            q.tasks.push_back (std::move (task));
+        }
+        queued.fetch_add (1, std::memory_order_release);
+        {
+            std::lock_guard<std::mutex> lock (sleepMutex);
+        }
+        wake.notify_all();
+    }
+
+    // Own deque newest-first, then the injection queue and the other
+    // workers' deques oldest-first.
+    bool pop (Task& out)
+    {
+        if (queued.load (std::memory_order_acquire) == 0)
+            return false;
+
+        const int self = localQueue();
+        const int numQueues = (int) queues.size();
+        for (int n = 0; n < numQueues; ++n)
+        {
+            const int i = (self + n) % numQueues;
+            auto& q = *queues[(size_t) i];
+            std::lock_guard<std::mutex> lock (q.mutex);
+            if (q.tasks.empty())
+                continue;
+
+            const bool own = (n == 0 && self < (int) workers.size());
+            if (own)
+            {
+                out = std::move (q.tasks.back());
+                q.tasks.pop_back();
+            }
+            else
+            {
+                out = std::move (q.tasks.front());
+                q.tasks.pop_front();
+            }
+            queued.fetch_sub (1, std::memory_order_acq_rel);
+            return true;
+        }
+        return false;
+    }
+
+    // Runs one queued task on the calling thread; false if none was found.
+    bool runOneTask()
+    {
+        Task task;
+        if (! pop (task))
+            return false;
+
+        auto* group = task.group;
+        if (! group->isCancelled())
+        {
+            try
+            {
+                task.fn();
+            }
+            catch (...)
+            {
+                std::lock_guard<std::mutex> lock (group->errorMutex);
+                if (group->error == nullptr)
+                    group->error = std::current_exception();
+            }
+        }
+        task.fn = nullptr;   // release captures before the group can go away
+
+        if (group->pending.fetch_sub (1, std::memory_order_acq_rel) == 1)
+        {
+            {
+                std::lock_guard<std::mutex> lock (sleepMutex);
+            }
+            wake.notify_all();
+        }
+        return true;
+    }
+
+    template <typename Done>
+    void sleepUntil (Done done)
+    {
+        std::unique_lock<std::mutex> lock (sleepMutex);
+        wake.wait (lock, [&]
+        {
+            return quit || done() || queued.load (std::memory_order_acquire) > 0;
+        });
+    }
+
+    void workerLoop (int index)
+    {
+        currentPool = this;
+        currentWorker = index;
+        for (;;)
+        {
+            if (runOneTask())
+                continue;
+
+            std::unique_lock<std::mutex> lock (sleepMutex);
+            wake.wait (lock, [this] { return quit || queued.load (std::memory_order_acquire) > 0; });
+            if (quit)
+                return;
+        }
+    }
+
+    std::vector<std::unique_ptr<Queue>> queues;   // one per worker + injection queue
+    std::vector<std::thread> workers;
+    std::atomic<int> queued { 0 };
+    std::mutex sleepMutex;
+    std::condition_variable wake;
+    bool quit = false;
+
+    SynthTaskPool (const SynthTaskPool&) = delete;
+    SynthTaskPool& operator= (const SynthTaskPool&) = delete;
+};
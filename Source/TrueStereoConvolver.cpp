@@ -0,0 +1,1230 @@
+#include "TrueStereoConvolver.h"
+
+#include <algorithm>
+#include <chrono>
+#include <climits>
+#include <cmath>
+
+#if defined(__APPLE__)
+ #include <dispatch/dispatch.h>
+#elif defined(_WIN32)
+ #ifndef NOMINMAX
+  #define NOMINMAX
+ #endif
+ #ifndef WIN32_LEAN_AND_MEAN
+  #define WIN32_LEAN_AND_MEAN
+ #endif
+ #include <windows.h>
+#else
+ #include <cerrno>
+ #include <semaphore.h>
+#endif
+
+//==============================================================================
+// FFT
+//
+// Both back-ends use juce::dsp::FFT's real-only layout: forward() takes
+// fftSize real samples in a 2 * fftSize buffer and writes bins 0..fftSize/2
+// as interleaved (re, im) pairs; inverse() takes the same half spectrum and
+// writes fftSize real samples, scaled by 1 / fftSize. Each instance is used by
+// one thread at a time.
+//==============================================================================
+
+#ifdef PING_TESTING_BUILD
+
+struct TrueStereoConvolver::FFTImpl
+{
+    explicit FFTImpl (int order)
+        : size (1 << order), twiddles ((size_t) size)
+    {
+        const double twoPi = 6.283185307179586476925286766559;
+        for (int k = 0; k < size / 2; ++k)
+        {
+            twiddles[(size_t) (2 * k)]     = (float) std::cos (twoPi * k / size);
+            twiddles[(size_t) (2 * k + 1)] = (float) -std::sin (twoPi * k / size);
+        }
+    }
+
+    void forward (float* data) const noexcept
+    {
+        // Real → interleaved complex in place (back to front so nothing is
+        // overwritten before it is read); the 2 * size buffer holds it exactly.
+        for (int i = size - 1; i >= 0; --i)
+        {
+            data[2 * i]     = data[i];
+            data[2 * i + 1] = 0.0f;
+        }
+        transform (data, false);
+    }
+
+    void inverse (float* data) const noexcept
+    {
+        // Rebuild the Hermitian-symmetric upper half from bins 0..size/2.
+        for (int k = size / 2 + 1; k < size; ++k)
+        {
+            data[2 * k]     =  data[2 * (size - k)];
+            data[2 * k + 1] = -data[2 * (size - k) + 1];
+        }
+        transform (data, true);
+
+        const float scale = 1.0f / (float) size;
+        for (int i = 0; i < size; ++i)
+            data[i] = data[2 * i] * scale;
+    }
+
+private:
+    // Iterative radix-2 Cooley–Tukey on interleaved complex floats.
+    void transform (float* d, bool inverse) const noexcept
+    {
+        for (int i = 1, j = 0; i < size; ++i)
+        {
+            int bit = size >> 1;
+            for (; (j & bit) != 0; bit >>= 1)
+                j ^= bit;
+            j ^= bit;
+            if (i < j)
+            {
+                std::swap (d[2 * i],     d[2 * j]);
+                std::swap (d[2 * i + 1], d[2 * j + 1]);
+            }
+        }
+
+        const float sign = inverse ? -1.0f : 1.0f;
+        for (int len = 2; len <= size; len <<= 1)
+        {
+            const int half = len / 2, step = size / len;
+            for (int start = 0; start < size; start += len)
+            {
+                for (int k = 0; k < half; ++k)
+                {
+                    const float wr = twiddles[(size_t) (2 * k * step)];
+                    const float wi = twiddles[(size_t) (2 * k * step + 1)] * sign;
+                    float* a = d + 2 * (start + k);
+                    float* b = d + 2 * (start + k + half);
+                    const float br = b[0] * wr - b[1] * wi;
+                    const float bi = b[0] * wi + b[1] * wr;
+                    b[0] = a[0] - br;  b[1] = a[1] - bi;
+                    a[0] += br;        a[1] += bi;
+                }
+            }
+        }
+    }
+
+    const int size;
+    std::vector<float> twiddles;   // size/2 interleaved e^{-2πik/size}
+};
+
+#else
+
+struct TrueStereoConvolver::FFTImpl
+{
+    explicit FFTImpl (int order) : fft (order), size (1 << order) {}
+
+    void forward (float* data) const noexcept
+    {
+        fft.performRealOnlyForwardTransform (data, true);
+    }
+
+    void inverse (float* data) const noexcept
+    {
+        // Mirror bins 1..size/2-1 into the upper half, as
+        // juce::dsp::ConvolutionEngine does before its inverse transform.
+        for (int k = size / 2 + 1; k < size; ++k)
+        {
+            data[2 * k]     =  data[2 * (size - k)];
+            data[2 * k + 1] = -data[2 * (size - k) + 1];
+        }
+        fft.performRealOnlyInverseTransform (data);
+    }
+
+private:
+    juce::dsp::FFT fft;
+    const int size;
+};
+
+#endif
+
+//==============================================================================
+// Kernel, history and tail-stage storage
+//==============================================================================
+
+struct TrueStereoConvolver::Kernels
+{
+    struct Filter
+    {
+        int input = 0;                 // 0 = L, 1 = R
+        int bus   = 0;                 // Bus index
+        int numSegments = 0;           // segment index past the last one with samples
+        int firstSegment = 0;          // segments before it are silent and skipped
+        std::vector<float> spectra;    // (numSegments − firstSegment) * stage specSize
+
+        // Shaped paths only: stretch point, and the decay exponent per sample
+        // per unit damping (6 / envelope length).
+        int point = 0;
+        float decayScale = 0.0f;
+    };
+
+    // [0] = head, [1 + s] = tail stage s. Filters with no samples in a stage
+    // are omitted from it.
+    std::vector<std::vector<Filter>> stages;
+    int lastStageSegments = 0;         // partitions needed in the last tail stage
+
+    bool shaped = false;               // loaded with loadShapedPath
+    std::vector<float> stretchPoints;  // shaped: ascending stretch of each point
+
+    bool empty = true;                 // no kernel had samples (unloadPath): the path is not ready
+};
+
+struct TrueStereoConvolver::History
+{
+    History (int numSegments, int specSize)
+        : capacity (numSegments)
+    {
+        for (auto& s : spectra)
+            s.assign ((size_t) capacity * (size_t) specSize, 0.0f);
+    }
+
+    const int capacity;
+    std::array<std::vector<float>, 2> spectra;   // [L/R] ring of input-partition spectra
+};
+
+// One uniformly-partitioned tail stage and its (single) in-flight job.
+//
+// Job j consumes input partition j (input[j & 1]) and writes output[j & 1],
+// which is played during partition j + 2. Jobs for one stage never overlap:
+// job j is finished (by the pool, or by the audio thread at its deadline)
+// before job j + 1 is submitted, so the history ring, per-bus overlap and the
+// task workspaces need no further synchronisation.
+struct TrueStereoConvolver::TailStage
+{
+    TailStage (int kernelStageIndex, int partitionSize, int kernelStart, int kernelEnd)
+        : kernelStage (kernelStageIndex),
+          partition (partitionSize), fftSize (partitionSize * 2), specSize (partitionSize * 2 + 2),
+          start (kernelStart), end (kernelEnd)
+    {
+        int order = 0;
+        while ((1 << order) < fftSize)
+            ++order;
+
+        for (auto& buf : input)
+            for (auto& ch : buf)
+                ch.assign ((size_t) partition, 0.0f);
+        for (auto& w : inputWork)
+            w.assign ((size_t) fftSize * 2, 0.0f);
+        for (auto& f : taskFFT)
+            f.reset (new FFTImpl (order));
+        for (auto& v : outputValid)
+            v.fill (false);
+
+        if (end != INT_MAX)
+            history.reset (new History ((end - start) / partition, specSize));
+    }
+
+    const int kernelStage;                // index into Kernels::stages
+    const int partition, fftSize, specSize;
+    const int start, end;                 // kernel range [start, end); end = INT_MAX for the last stage
+
+    // Audio thread.
+    std::array<std::array<std::vector<float>, 2>, 2> input;                 // [buffer][L/R]
+    std::array<std::array<std::vector<float>, kNumBuses>, 2> output;        // [buffer][bus]
+    std::array<std::array<bool, kNumBuses>, 2> outputValid {};              // written by the job that filled it
+    std::array<bool, kNumBuses> busInLastJob {};
+    int pos = 0;                          // samples into the current input partition
+    int writeBuffer = 0;                  // input / output buffer of the next job
+    int readBuffer  = 1;                  // output buffer being played
+    int lastJobBuffer = 1;                // buffer of the most recently submitted job
+    bool jobInFlight = false;
+    std::unique_ptr<History> history;     // null until a kernel reaches the last stage
+
+    // Job description (written by the audio thread before the job is published).
+    std::array<const Kernels*, kNumPaths> jobKernels {};
+    std::array<PathShape, kNumPaths> jobShape {};
+    std::array<int, kNumBuses> jobBuses {};
+    std::array<bool, kNumBuses> jobResetOverlap {};
+    int jobBuffer = 0;
+    int jobSegment = 0;                   // history slot for this job's input spectra
+    int currentSegment = 0;
+
+    static constexpr int kIdle = 1 << 30;
+    std::atomic<int> numTasks  { 0 };
+    std::atomic<int> nextTask  { kIdle };
+    std::atomic<int> tasksDone { 0 };
+
+    // Workspaces: inputWork / taskFFT[0..1] for the forward FFTs of L / R (audio
+    // thread, submitTailJob), busWork / taskFFT[2 + i] for task i = bus
+    // jobBuses[i]. The per-bus ones, like output, are empty until the bus's
+    // path is first loaded (allocateBuses).
+    std::array<std::vector<float>, 2> inputWork;
+    std::array<std::vector<float>, kNumBuses> busWork;
+    std::array<std::vector<float>, kNumBuses> busOverlap;
+    std::array<std::unique_ptr<FFTImpl>, 2 + kNumBuses> taskFFT;
+
+    /** Sizes bus b's output, work and overlap buffers, if not done already. */
+    void allocateBuses (size_t b)
+    {
+        if (! busWork[b].empty())
+            return;
+        for (auto& buf : output)
+            buf[b].assign ((size_t) partition, 0.0f);
+        busWork[b]   .assign ((size_t) fftSize * 2, 0.0f);
+        busOverlap[b].assign ((size_t) partition, 0.0f);
+    }
+
+    /** Frees bus b's output, work and overlap buffers (releaseBusBuffers). */
+    void releaseBuses (size_t b)
+    {
+        for (auto& buf : output)
+            std::vector<float>().swap (buf[b]);
+        std::vector<float>().swap (busWork[b]);
+        std::vector<float>().swap (busOverlap[b]);
+    }
+
+    size_t busBytes() const noexcept
+    {
+        size_t n = 0;
+        for (size_t b = 0; b < (size_t) kNumBuses; ++b)
+            n += output[0][b].size() + output[1][b].size() + busWork[b].size() + busOverlap[b].size();
+        return n * sizeof (float);
+    }
+
+    /** Claims the next unclaimed task of the published job, or -1. */
+    int claimTask() noexcept
+    {
+        if (nextTask.load (std::memory_order_relaxed) >= numTasks.load (std::memory_order_relaxed))
+            return -1;
+        const int t = nextTask.fetch_add (1, std::memory_order_acq_rel);
+        return t < numTasks.load (std::memory_order_relaxed) ? t : -1;
+    }
+};
+
+// Counting semaphore the tail workers sleep on. release() never blocks and
+// takes no lock (a futex / Mach / kernel semaphore post), so the audio thread
+// can call it from submitTailJob. Tokens are not lost: a post that lands while
+// every worker is busy is picked up on its next acquire().
+struct TrueStereoConvolver::WakeSemaphore
+{
+   #if defined(__APPLE__)
+    WakeSemaphore()  : sem (dispatch_semaphore_create (0)) {}
+    ~WakeSemaphore() { dispatch_release (sem); }
+    void release (int n) noexcept { while (n-- > 0) dispatch_semaphore_signal (sem); }
+    void acquire() noexcept       { dispatch_semaphore_wait (sem, DISPATCH_TIME_FOREVER); }
+    dispatch_semaphore_t sem;
+   #elif defined(_WIN32)
+    WakeSemaphore()  : sem (CreateSemaphoreW (nullptr, 0, LONG_MAX, nullptr)) {}
+    ~WakeSemaphore() { CloseHandle (sem); }
+    void release (int n) noexcept { if (n > 0) ReleaseSemaphore (sem, n, nullptr); }
+    void acquire() noexcept       { WaitForSingleObject (sem, INFINITE); }
+    HANDLE sem;
+   #else
+    WakeSemaphore()  { sem_init (&sem, 0, 0); }
+    ~WakeSemaphore() { sem_destroy (&sem); }
+    void release (int n) noexcept { while (n-- > 0) sem_post (&sem); }
+    void acquire() noexcept       { while (sem_wait (&sem) != 0 && errno == EINTR) {} }
+    sem_t sem;
+   #endif
+};
+
+namespace
+{
+    // The pair of output buses (left, right) each path writes.
+    constexpr int kErBusL[]   = { TrueStereoConvolver::MainErL,   TrueStereoConvolver::DirectL,
+                                  TrueStereoConvolver::OutrigL,   TrueStereoConvolver::AmbientL };
+    constexpr int kTailBusL[] = { TrueStereoConvolver::MainTailL, TrueStereoConvolver::DirectL,
+                                  TrueStereoConvolver::OutrigL,   TrueStereoConvolver::AmbientL };
+
+    int busPath (int bus) noexcept
+    {
+        return bus <= TrueStereoConvolver::MainTailR ? TrueStereoConvolver::Main
+                                                     : (bus - TrueStereoConvolver::DirectL) / 2 + 1;
+    }
+
+    int fftOrder (int size) noexcept
+    {
+        int order = 0;
+        while ((1 << order) < size)
+            ++order;
+        return order;
+    }
+
+    // acc += a * b over `numBins` interleaved complex bins.
+    void multiplyAccumulate (float* acc, const float* a, const float* b, int numBins) noexcept
+    {
+        for (int k = 0; k < numBins; ++k)
+        {
+            const float ar = a[2 * k], ai = a[2 * k + 1];
+            const float br = b[2 * k], bi = b[2 * k + 1];
+            acc[2 * k]     += ar * br - ai * bi;
+            acc[2 * k + 1] += ar * bi + ai * br;
+        }
+    }
+
+    // acc += gain * a * b over `numBins` interleaved complex bins.
+    void multiplyAccumulateScaled (float* acc, const float* a, const float* b, float gain, int numBins) noexcept
+    {
+        for (int k = 0; k < numBins; ++k)
+        {
+            const float ar = a[2 * k], ai = a[2 * k + 1];
+            const float br = b[2 * k], bi = b[2 * k + 1];
+            acc[2 * k]     += gain * (ar * br - ai * bi);
+            acc[2 * k + 1] += gain * (ar * bi + ai * br);
+        }
+    }
+
+    // Gains of consecutive segments of a shaped filter: the stretch point's
+    // weight times the decay envelope exp (−rate · t) at each segment's
+    // centre. The envelope is exponential, so one segment's gain is the
+    // previous one's times exp (−rate · P).
+    struct SegmentGain
+    {
+        SegmentGain (float weight, float rate, int firstCentre, int partition) noexcept
+            : gain (weight * std::exp (-rate * (float) firstCentre)),
+              step (std::exp (-rate * (float) partition)) {}
+
+        float next() noexcept
+        {
+            const float g = gain;
+            gain *= step;
+            return g;
+        }
+
+        float gain, step;
+    };
+}
+
+//==============================================================================
+
+TrueStereoConvolver::TrueStereoConvolver (int numWorkerThreads)
+    : numWorkers (std::max (0, numWorkerThreads)), workerWake (new WakeSemaphore())
+{
+    for (auto& st : shapeStretch)
+        st.store (1.0f);
+}
+
+TrueStereoConvolver::~TrueStereoConvolver()
+{
+    stopWorkers();
+    dropAll();
+}
+
+int TrueStereoConvolver::getTailPartitionSize (int stage) const noexcept
+{
+    return stage >= 0 && stage < (int) tailStages.size() ? tailStages[(size_t) stage]->partition : 0;
+}
+
+//==============================================================================
+// Worker pool
+//==============================================================================
+
+void TrueStereoConvolver::setNumWorkers (int numWorkerThreads)
+{
+    stopWorkers();
+    numWorkers = std::max (0, numWorkerThreads);
+    startWorkers();
+}
+
+void TrueStereoConvolver::startWorkers()
+{
+    if (tailStages.empty())
+        return;   // prepare() starts the pool once there is something to run
+
+    workersQuit.store (false);
+    for (int i = 0; i < numWorkers; ++i)
+        workers.emplace_back ([this] { workerLoop(); });
+    runningWorkers.store (numWorkers, std::memory_order_release);
+}
+
+void TrueStereoConvolver::stopWorkers()
+{
+    // Jobs submitted from here on post no tokens; the audio thread finishes
+    // them at their deadlines.
+    runningWorkers.store (0, std::memory_order_release);
+    workersQuit.store (true, std::memory_order_release);
+    workerWake->release ((int) workers.size());
+    for (auto& w : workers)
+        w.join();
+    workers.clear();
+}
+
+void TrueStereoConvolver::workerLoop()
+{
+    // One token per job per worker, so every token is followed by a scan. A
+    // token left over from a job someone else already finished costs one
+    // empty scan; with no jobs coming in, workers block indefinitely.
+    for (;;)
+    {
+        workerWake->acquire();
+        if (workersQuit.load (std::memory_order_acquire))
+            return;
+
+        // Smallest partitions first: their deadlines are the nearest.
+        for (auto& stage : tailStages)
+            for (int t = stage->claimTask(); t >= 0; t = stage->claimTask())
+                runTailTask (*stage, t);
+    }
+}
+
+//==============================================================================
+// Setup and loading (message thread)
+//==============================================================================
+
+void TrueStereoConvolver::dropAll()
+{
+    for (size_t p = 0; p < (size_t) kNumPaths; ++p)
+    {
+        delete active[p];
+        active[p] = nullptr;
+        delete draining[p];
+        draining[p] = nullptr;
+        drainingStages[p] = 0;
+        delete pending[p].exchange (nullptr);
+        delete retired[p].exchange (nullptr);
+        publishedTailSegments[p] = 0;
+        publishedIRSize[p].store (0);
+        pathBusesIdle[p].store (false);
+    }
+    delete pendingTailHistory.exchange (nullptr);
+    delete retiredTailHistory.exchange (nullptr);
+    publishedTailCapacity = 0;
+}
+
+void TrueStereoConvolver::prepare (int maxBlockSize)
+{
+    stopWorkers();
+    dropAll();
+
+    const int headOrder = std::max (4, fftOrder (maxBlockSize));   // 16-sample minimum partition
+    headSize     = 1 << headOrder;
+    headFFTSize  = headSize * 2;
+    headSpecSize = headFFTSize + 2;
+    headFFT.reset (new FFTImpl (headOrder + 1));
+
+    // Tail stages: P1 = 8·B, ×8 per stage up to kMaxTailPartition. Stage s
+    // covers kernel samples [2·P_s, 2·P_s+1); the head covers [0, 2·P1).
+    std::vector<int> partitions { std::max (headSize, std::min (headSize * kTailPartitionRatio, kMaxTailPartition)) };
+    while (partitions.back() < kMaxTailPartition)
+        partitions.push_back (std::min (partitions.back() * kTailPartitionRatio, kMaxTailPartition));
+
+    tailStages.clear();
+    for (size_t s = 0; s < partitions.size(); ++s)
+    {
+        const int kernelEnd = s + 1 < partitions.size() ? 2 * partitions[s + 1] : INT_MAX;
+        tailStages.emplace_back (new TailStage ((int) s + 1, partitions[s], 2 * partitions[s], kernelEnd));
+    }
+
+    headSegments = 2 * partitions.front() / headSize;
+    headHistory.reset (new History (headSegments, headSpecSize));
+
+    for (size_t c = 0; c < 2; ++c)
+    {
+        inputBlock[c].assign ((size_t) headFFTSize, 0.0f);
+        inputWork[c] .assign ((size_t) headFFTSize * 2, 0.0f);
+    }
+    // Bus workspaces are sized per path on its first load (allocateBusBuffers).
+    for (size_t b = 0; b < (size_t) kNumBuses; ++b)
+    {
+        for (auto* v : { &busTail[b], &busWork[b], &busOverlap[b] })
+            std::vector<float>().swap (*v);
+        busPrimed[b] = false;
+    }
+    inputPos = 0;
+    currentSegment = 0;
+
+    startWorkers();
+}
+
+void TrueStereoConvolver::loadPath (Path path, const PathIR& ir)
+{
+    ShapedPoint point;
+    point.ir = ir;
+    loadKernels (path, { point }, false);
+}
+
+void TrueStereoConvolver::unloadPath (Path path)
+{
+    loadKernels (path, { ShapedPoint() }, false);
+}
+
+void TrueStereoConvolver::loadShapedPath (Path path, const std::vector<ShapedPoint>& points)
+{
+    if (points.empty() || (int) points.size() > kMaxStretchPoints)
+        return;
+    loadKernels (path, points, true);
+}
+
+void TrueStereoConvolver::loadKernels (Path path, const std::vector<ShapedPoint>& points, bool shaped)
+{
+    if (headFFT == nullptr)
+        return;   // not prepared yet — prepareToPlay reloads every path
+
+    const int numStages = 1 + (int) tailStages.size();
+    auto* k = new Kernels();
+    k->stages.resize ((size_t) numStages);
+    k->shaped = shaped;
+    int irSize = 0;
+
+    // Per-stage partition geometry, and a private FFT per stage so loading
+    // never touches the audio thread's or the workers' workspaces.
+    std::vector<int> partition, rangeStart, rangeEnd;
+    std::vector<std::unique_ptr<FFTImpl>> loadFFT;
+    partition.push_back (headSize);
+    rangeStart.push_back (0);
+    rangeEnd.push_back (headSegments * headSize);
+    loadFFT.emplace_back (new FFTImpl (fftOrder (headFFTSize)));
+    for (auto& st : tailStages)
+    {
+        partition.push_back (st->partition);
+        rangeStart.push_back (st->start);
+        rangeEnd.push_back (st->end);
+        loadFFT.emplace_back (new FFTImpl (fftOrder (st->fftSize)));
+    }
+
+    // h occupies kernel samples [offset, offset + h.size()). A stage only gets
+    // the segments that overlap it, so a kernel that starts late (the Tail,
+    // at the crossover) skips the head and the leading segments of the first
+    // stage it reaches.
+    auto addFilter = [&] (const std::vector<float>& h, int offset, int input, int bus, int point, float decayScale)
+    {
+        const int len = (int) h.size();
+        if (len == 0)
+            return;
+        const int end = offset + len;
+        irSize = std::max (irSize, end);
+
+        for (int s = 0; s < numStages; ++s)
+        {
+            const int from = rangeStart[(size_t) s];
+            const int to   = std::min (rangeEnd[(size_t) s], end);
+            if (to <= std::max (from, offset))
+                continue;
+
+            const int P = partition[(size_t) s];
+            const int specSize = 2 * P + 2;
+            std::vector<float> work ((size_t) P * 4);
+
+            Kernels::Filter f;
+            f.input = input;
+            f.bus   = bus;
+            f.point = point;
+            f.decayScale = decayScale;
+            f.firstSegment = (std::max (from, offset) - from) / P;
+            f.numSegments  = (to - from + P - 1) / P;
+            f.spectra.assign ((size_t) (f.numSegments - f.firstSegment) * (size_t) specSize, 0.0f);
+
+            for (int seg = f.firstSegment; seg < f.numSegments; ++seg)
+            {
+                const int segStart = std::max (from + seg * P, offset);
+                const int segEnd   = std::min (from + (seg + 1) * P, to);
+                std::fill (work.begin(), work.end(), 0.0f);
+                std::copy (h.data() + (segStart - offset), h.data() + (segEnd - offset),
+                           work.begin() + (segStart - from - seg * P));
+                loadFFT[(size_t) s]->forward (work.data());
+                std::copy (work.begin(), work.begin() + specSize,
+                           f.spectra.begin() + (ptrdiff_t) (seg - f.firstSegment) * specSize);
+            }
+
+            if (s == numStages - 1)
+                k->lastStageSegments = std::max (k->lastStageSegments, f.numSegments);
+            k->stages[(size_t) s].push_back (std::move (f));
+        }
+    };
+
+    // LL (L → left), RL (R → left), LR (L → right), RR (R → right).
+    static constexpr int kInput[4]  = { 0, 1, 0, 1 };
+    static constexpr int kBusOff[4] = { 0, 0, 1, 1 };
+    for (size_t pt = 0; pt < points.size(); ++pt)
+    {
+        const auto& point = points[pt];
+        const float decayScale = point.envelopeLength > 0 ? 6.0f / (float) point.envelopeLength : 0.0f;
+        k->stretchPoints.push_back (point.stretch);
+        for (int c = 0; c < 4; ++c)
+        {
+            addFilter (point.ir.er[(size_t) c], 0, kInput[c], kErBusL[path] + kBusOff[c], (int) pt, decayScale);
+            addFilter (point.ir.tail[(size_t) c], std::max (0, point.ir.tailOffset),
+                       kInput[c], kTailBusL[path] + kBusOff[c], (int) pt, decayScale);
+        }
+    }
+
+    k->empty = irSize == 0;
+    if (! k->empty)
+        allocateBusBuffers (path);
+
+    // Grow the last stage's input history first, so it is already pending when
+    // the audio thread sees the new kernels (adoptPending holds kernels back
+    // until a history that fits them is installed).
+    publishedTailSegments[(size_t) path] = k->lastStageSegments;
+    const int needed = *std::max_element (publishedTailSegments.begin(), publishedTailSegments.end());
+    if (needed > publishedTailCapacity)
+    {
+        delete pendingTailHistory.exchange (new History (needed, tailStages.back()->specSize),
+                                            std::memory_order_acq_rel);
+        publishedTailCapacity = needed;
+    }
+
+    delete pending[(size_t) path].exchange (k, std::memory_order_acq_rel);
+    publishedIRSize[(size_t) path].store (irSize);
+}
+
+// The audio thread and the workers only touch a bus's workspaces while its
+// path has non-empty kernels, and the kernels are published after this
+// (pending's release / acquire orders the writes), so sizing them here never
+// races with process(). Once sized they stay until the path is unloaded
+// (releaseBusBuffers) or the next prepare().
+void TrueStereoConvolver::allocateBusBuffers (Path path)
+{
+    for (size_t b = 0; b < (size_t) kNumBuses; ++b)
+    {
+        if (busPath ((int) b) != (int) path || ! busWork[b].empty())
+            continue;
+        busTail[b]   .assign ((size_t) headSpecSize, 0.0f);
+        busWork[b]   .assign ((size_t) headFFTSize * 2, 0.0f);
+        busOverlap[b].assign ((size_t) headSize, 0.0f);
+        for (auto& st : tailStages)
+            st->allocateBuses (b);
+    }
+}
+
+// Only once the audio thread has reported the path idle (empty kernels
+// active, no tail job still holding the old ones): from then on nothing
+// reads these buses until a non-empty load sizes them again.
+void TrueStereoConvolver::releaseBusBuffers (Path path)
+{
+    for (size_t b = 0; b < (size_t) kNumBuses; ++b)
+    {
+        if (busPath ((int) b) != (int) path)
+            continue;
+        for (auto* v : { &busTail[b], &busWork[b], &busOverlap[b] })
+            std::vector<float>().swap (*v);
+        for (auto& st : tailStages)
+            st->releaseBuses (b);
+    }
+}
+
+size_t TrueStereoConvolver::getBusWorkspaceBytes() const noexcept
+{
+    size_t n = 0;
+    for (size_t b = 0; b < (size_t) kNumBuses; ++b)
+        n += (busTail[b].size() + busWork[b].size() + busOverlap[b].size()) * sizeof (float);
+    for (const auto& st : tailStages)
+        n += st->busBytes();
+    return n;
+}
+
+void TrueStereoConvolver::releaseRetired()
+{
+    for (auto& r : retired)
+        delete r.exchange (nullptr, std::memory_order_acq_rel);
+    delete retiredTailHistory.exchange (nullptr, std::memory_order_acq_rel);
+
+    if (headFFT == nullptr)
+        return;
+
+    // Unloaded paths the audio thread has let go of give their buses back.
+    for (size_t p = 0; p < (size_t) kNumPaths; ++p)
+        if (publishedIRSize[p].load() == 0 && pathBusesIdle[p].load (std::memory_order_acquire))
+            releaseBusBuffers ((Path) p);
+
+    // The last stage's history shrinks to the longest path still loaded, once
+    // every published kernel set has been adopted (so none still active needs
+    // more). At least one partition is kept: a history, once installed, is
+    // never taken away again.
+    const int needed = std::max (1, *std::max_element (publishedTailSegments.begin(), publishedTailSegments.end()));
+    if (needed >= publishedTailCapacity)
+        return;
+    for (const auto& k : pending)
+        if (k.load (std::memory_order_acquire) != nullptr)
+            return;
+    delete pendingTailHistory.exchange (new History (needed, tailStages.back()->specSize),
+                                        std::memory_order_acq_rel);
+    publishedTailCapacity = needed;
+}
+
+//==============================================================================
+// Audio thread
+//==============================================================================
+
+bool TrueStereoConvolver::isPathReady (Path path) const noexcept
+{
+    const auto* k = active[(size_t) path];
+    return k != nullptr && ! k->empty;
+}
+
+void TrueStereoConvolver::adoptPending() noexcept
+{
+    if (tailStages.empty())
+        return;
+
+    // Before the first last-stage job (e.g. straight after prepare) the
+    // history can go in now; otherwise it waits for the next job boundary.
+    adoptTailHistory();
+
+    const auto& last = *tailStages.back();
+    const int tailCapacity = last.history != nullptr ? last.history->capacity : 0;
+
+    for (size_t p = 0; p < (size_t) kNumPaths; ++p)
+    {
+        if (draining[p] != nullptr || retired[p].load (std::memory_order_acquire) != nullptr)
+            continue;
+
+        auto* fresh = pending[p].load (std::memory_order_acquire);
+        if (fresh == nullptr || fresh->lastStageSegments > tailCapacity)
+            continue;   // wait for the last-stage history that fits it
+
+        if (! pending[p].compare_exchange_strong (fresh, nullptr, std::memory_order_acq_rel))
+            continue;
+
+        auto* old = active[p];
+        active[p] = fresh;
+        pathBusesIdle[p].store (false, std::memory_order_relaxed);
+
+        // The head's older-partition sums were built from the previous kernels.
+        for (int b = 0; b < kNumBuses; ++b)
+            if (busPath (b) == (int) p)
+                busPrimed[(size_t) b] = false;
+
+        // Tail jobs still running with the old set keep it alive until they finish.
+        unsigned stagesUsingOld = 0;
+        for (size_t s = 0; s < tailStages.size(); ++s)
+            if (tailStages[s]->jobInFlight && tailStages[s]->jobKernels[p] == old)
+                stagesUsingOld |= 1u << s;
+
+        if (old == nullptr || stagesUsingOld == 0)
+        {
+            retired[p].store (old, std::memory_order_release);
+            pathBusesIdle[p].store (fresh->empty, std::memory_order_release);
+        }
+        else
+        {
+            draining[p] = old;
+            drainingStages[p] = stagesUsingOld;
+        }
+    }
+}
+
+TrueStereoConvolver::PathShape TrueStereoConvolver::makeShape (const Kernels& k, float damping,
+                                                               float stretch) noexcept
+{
+    PathShape shape;
+    if (! k.shaped)
+        return shape;
+
+    shape.shaped  = true;
+    shape.damping = std::max (0.0f, std::min (1.0f, damping));
+
+    // Crossfade the two points either side of `stretch`, linear in log stretch.
+    const auto& pts = k.stretchPoints;
+    const int last = (int) pts.size() - 1;
+    stretch = std::max (pts.front(), std::min (pts.back(), stretch));
+    int i = 0;
+    while (i < last - 1 && stretch > pts[(size_t) i + 1])
+        ++i;
+    if (last == 0)
+    {
+        shape.weight[0] = 1.0f;
+        return shape;
+    }
+    const float a = std::log (stretch / pts[(size_t) i]) / std::log (pts[(size_t) i + 1] / pts[(size_t) i]);
+    shape.weight[(size_t) i]     = 1.0f - a;
+    shape.weight[(size_t) i + 1] = a;
+    return shape;
+}
+
+void TrueStereoConvolver::accumulateOlderPartitions (const Kernels& k, int bus) noexcept
+{
+    const int numBins  = headSize + 1;
+    const int capacity = headHistory->capacity;
+    auto* acc = busTail[(size_t) bus].data();
+    const auto& shape = blockShape[(size_t) busPath (bus)];
+
+    for (const auto& f : k.stages.front())
+    {
+        if (f.bus != bus)
+            continue;
+
+        const auto* history = headHistory->spectra[(size_t) f.input].data();
+        const int first = std::max (1, f.firstSegment);
+        const float* spectrum = f.spectra.data() + (ptrdiff_t) (first - f.firstSegment) * headSpecSize;
+        int index = (currentSegment + first - 1) % capacity;
+        if (shape.shaped)
+        {
+            const float weight = shape.weight[(size_t) f.point];
+            if (weight == 0.0f)
+                continue;
+            SegmentGain gain (weight, shape.damping * f.decayScale, first * headSize + headSize / 2, headSize);
+            for (int s = first; s < f.numSegments; ++s, spectrum += headSpecSize)
+            {
+                if (++index >= capacity)
+                    index -= capacity;
+                multiplyAccumulateScaled (acc, history + (ptrdiff_t) index * headSpecSize, spectrum,
+                                          gain.next(), numBins);
+            }
+            continue;
+        }
+
+        for (int s = first; s < f.numSegments; ++s, spectrum += headSpecSize)
+        {
+            if (++index >= capacity)
+                index -= capacity;
+            multiplyAccumulate (acc, history + (ptrdiff_t) index * headSpecSize, spectrum, numBins);
+        }
+    }
+}
+
+void TrueStereoConvolver::runTailTask (TailStage& st, int task) noexcept
+{
+    // The input spectra were written by submitTailJob before the job was
+    // published, so a bus task never waits on another thread.
+    const int bus = st.jobBuses[(size_t) task];
+    const int numBins = st.partition + 1;
+    const int capacity = st.history->capacity;
+    auto& work = st.busWork[(size_t) bus];
+    std::fill (work.begin(), work.begin() + st.specSize, 0.0f);
+
+    const auto* k = st.jobKernels[(size_t) busPath (bus)];
+    const auto& shape = st.jobShape[(size_t) busPath (bus)];
+    for (const auto& f : k->stages[(size_t) st.kernelStage])
+    {
+        if (f.bus != bus)
+            continue;
+
+        const auto* history = st.history->spectra[(size_t) f.input].data();
+        const float* spectrum = f.spectra.data();
+        int index = (st.jobSegment + f.firstSegment) % capacity;
+        if (shape.shaped)
+        {
+            const float weight = shape.weight[(size_t) f.point];
+            if (weight == 0.0f)
+                continue;
+            SegmentGain gain (weight, shape.damping * f.decayScale,
+                              st.start + f.firstSegment * st.partition + st.partition / 2, st.partition);
+            for (int seg = f.firstSegment; seg < f.numSegments; ++seg, spectrum += st.specSize)
+            {
+                multiplyAccumulateScaled (work.data(), history + (ptrdiff_t) index * st.specSize, spectrum,
+                                          gain.next(), numBins);
+                if (++index >= capacity)
+                    index -= capacity;
+            }
+            continue;
+        }
+
+        for (int seg = f.firstSegment; seg < f.numSegments; ++seg, spectrum += st.specSize)
+        {
+            multiplyAccumulate (work.data(), history + (ptrdiff_t) index * st.specSize, spectrum, numBins);
+            if (++index >= capacity)
+                index -= capacity;
+        }
+    }
+
+    st.taskFFT[(size_t) (2 + task)]->inverse (work.data());
+
+    auto& overlap = st.busOverlap[(size_t) bus];
+    if (st.jobResetOverlap[(size_t) bus])
+        std::fill (overlap.begin(), overlap.end(), 0.0f);
+
+    auto& out = st.output[(size_t) st.jobBuffer][(size_t) bus];
+    for (int i = 0; i < st.partition; ++i)
+        out[(size_t) i] = work[(size_t) i] + overlap[(size_t) i];
+    std::copy (work.begin() + st.partition, work.begin() + st.fftSize, overlap.begin());
+    st.tasksDone.fetch_add (1, std::memory_order_acq_rel);
+}
+
+bool TrueStereoConvolver::finishTailJob (int stageIndex) noexcept
+{
+    auto& st = *tailStages[(size_t) stageIndex];
+    if (st.jobInFlight)
+    {
+        // Deadline: help with whatever the pool has not claimed yet, then wait
+        // for tasks still running on a worker. Yielding rather than spinning
+        // hard lets that worker finish when it shares a core with us.
+        for (int t = st.claimTask(); t >= 0; t = st.claimTask())
+            runTailTask (st, t);
+        const int total = st.numTasks.load (std::memory_order_relaxed);
+        if (st.tasksDone.load (std::memory_order_acquire) < total)
+        {
+            const int limitUs = tailWaitLimitUs.load (std::memory_order_relaxed);
+            const auto giveUp = std::chrono::steady_clock::now() + std::chrono::microseconds (limitUs);
+            while (st.tasksDone.load (std::memory_order_acquire) < total)
+            {
+                if (limitUs >= 0 && std::chrono::steady_clock::now() >= giveUp)
+                {
+                    // A starved worker still holds a task. Play this stage silent
+                    // for one partition and keep the job: its buffers stay the
+                    // worker's until it finishes, so the caller submits nothing
+                    // and the partition's input is dropped from this stage.
+                    st.outputValid[(size_t) st.lastJobBuffer].fill (false);
+                    st.readBuffer = st.lastJobBuffer;
+                    lateTailJobs.fetch_add (1, std::memory_order_relaxed);
+                    return false;
+                }
+                std::this_thread::yield();
+            }
+        }
+
+        st.nextTask.store (TailStage::kIdle, std::memory_order_relaxed);
+        st.jobInFlight = false;
+
+        // Kernel sets the finished job was holding can now go back to the
+        // message thread.
+        for (size_t p = 0; p < (size_t) kNumPaths; ++p)
+        {
+            if (draining[p] == nullptr || (drainingStages[p] & (1u << stageIndex)) == 0)
+                continue;
+            drainingStages[p] &= ~(1u << stageIndex);
+            if (drainingStages[p] == 0)
+            {
+                retired[p].store (draining[p], std::memory_order_release);
+                draining[p] = nullptr;
+                pathBusesIdle[p].store (active[p] == nullptr || active[p]->empty, std::memory_order_release);
+            }
+        }
+    }
+    st.readBuffer = st.lastJobBuffer;
+
+    if (stageIndex == (int) tailStages.size() - 1)
+        adoptTailHistory();
+    return true;
+}
+
+void TrueStereoConvolver::adoptTailHistory() noexcept
+{
+    // Only between jobs of the last stage. The most recent input spectra are
+    // carried over, so paths that keep playing through a grow (a longer IR
+    // loaded) or a shrink (the longest one unloaded) do not lose their tails.
+    // The copy is at most one spectrum per partition the new history holds,
+    // less than a single bus task of the next job.
+    auto& last = *tailStages.back();
+    if (last.jobInFlight || retiredTailHistory.load (std::memory_order_acquire) != nullptr)
+        return;
+
+    if (auto* fresh = pendingTailHistory.exchange (nullptr, std::memory_order_acq_rel))
+    {
+        // Next write slot w: the s-th older spectrum is at (w + s) % capacity.
+        // The fresh ring starts writing at 0, so it goes to slot s.
+        if (const auto* old = last.history.get())
+        {
+            const int n = std::min (old->capacity, fresh->capacity - 1);
+            const auto spec = (size_t) last.specSize;
+            for (size_t c = 0; c < 2; ++c)
+                for (int seg = 1; seg <= n; ++seg)
+                    std::copy_n (old->spectra[c].data() + (size_t) ((last.currentSegment + seg) % old->capacity) * spec,
+                                 spec, fresh->spectra[c].data() + (size_t) seg * spec);
+        }
+        retiredTailHistory.store (last.history.release(), std::memory_order_release);
+        last.history.reset (fresh);
+        last.currentSegment = 0;
+    }
+}
+
+void TrueStereoConvolver::submitTailJob (int stageIndex,
+                                         const std::array<const Kernels*, kNumBuses>& busKernels) noexcept
+{
+    auto& st = *tailStages[(size_t) stageIndex];
+    const int buffer = st.writeBuffer;
+    st.writeBuffer ^= 1;
+    st.lastJobBuffer = buffer;
+
+    int numBuses = 0;
+    st.jobKernels.fill (nullptr);
+    for (int b = 0; b < kNumBuses; ++b)
+    {
+        const auto* k = busKernels[(size_t) b];
+        bool hasFilters = false;
+        if (k != nullptr)
+            for (const auto& f : k->stages[(size_t) st.kernelStage])
+                hasFilters = hasFilters || f.bus == b;
+
+        const bool inJob = hasFilters && st.history != nullptr;
+        if (inJob)
+        {
+            st.jobKernels[(size_t) busPath (b)] = k;
+            st.jobShape[(size_t) busPath (b)] = blockShape[(size_t) busPath (b)];
+            st.jobBuses[(size_t) numBuses++] = b;
+            st.jobResetOverlap[(size_t) b] = ! st.busInLastJob[(size_t) b];
+        }
+        st.busInLastJob[(size_t) b] = inJob;
+        st.outputValid[(size_t) buffer][(size_t) b] = inJob;
+    }
+
+    if (st.history == nullptr)
+        return;   // no kernel reaches the last stage yet
+
+    st.jobBuffer  = buffer;
+    st.jobSegment = st.currentSegment;
+    st.currentSegment = (st.currentSegment > 0 ? st.currentSegment : st.history->capacity) - 1;
+
+    // Forward FFTs of the input partition into the stage history, here rather
+    // than as pool tasks: every bus task needs both, and a bus task left
+    // waiting on a preempted worker's FFT is a wait the audio thread can
+    // inherit at the deadline. Two FFTs per partition is a small share of the
+    // job. Always computed, even with no bus in the job, so the history is
+    // current when a path is switched on.
+    for (size_t c = 0; c < 2; ++c)
+    {
+        auto& work = st.inputWork[c];
+        const auto& in = st.input[(size_t) buffer][c];
+        std::copy (in.begin(), in.end(), work.begin());
+        std::fill (work.begin() + st.partition, work.end(), 0.0f);
+        st.taskFFT[c]->forward (work.data());
+        std::copy (work.begin(), work.begin() + st.specSize,
+                   st.history->spectra[c].begin() + (ptrdiff_t) st.jobSegment * st.specSize);
+    }
+
+    st.numTasks.store (numBuses, std::memory_order_relaxed);
+    st.tasksDone.store (0, std::memory_order_relaxed);
+    st.jobInFlight = true;
+    st.nextTask.store (0, std::memory_order_release);   // publish
+
+    if (numBuses > 0)
+        workerWake->release (runningWorkers.load (std::memory_order_acquire));
+}
+
+void TrueStereoConvolver::advanceTailStage (int stageIndex, const float* const* inputs, int offset, int num,
+                                            const std::array<const Kernels*, kNumBuses>& busKernels,
+                                            float* const* busOut) noexcept
+{
+    auto& st = *tailStages[(size_t) stageIndex];
+
+    // Play the output of the job finished at the last partition boundary.
+    for (int b = 0; b < kNumBuses; ++b)
+    {
+        if (busKernels[(size_t) b] == nullptr || ! st.outputValid[(size_t) st.readBuffer][(size_t) b])
+            continue;
+        const float* src = st.output[(size_t) st.readBuffer][(size_t) b].data() + st.pos;
+        float* out = busOut[b] + offset;
+        for (int i = 0; i < num; ++i)
+            out[i] += src[i];
+    }
+
+    for (size_t c = 0; c < 2; ++c)
+        std::copy (inputs[c] + offset, inputs[c] + offset + num,
+                   st.input[(size_t) st.writeBuffer][c].begin() + st.pos);
+    st.pos += num;
+
+    if (st.pos == st.partition)
+    {
+        st.pos = 0;
+        if (finishTailJob (stageIndex))
+            submitTailJob (stageIndex, busKernels);
+    }
+}
+
+void TrueStereoConvolver::process (const float* inL, const float* inR, int numSamples,
+                                   const bool* pathEnabled, float* const* busOut) noexcept
+{
+    if (headFFT == nullptr)
+        return;
+
+    // Which buses run this call. A bus that drops out loses its head overlap
+    // so a later re-enable does not replay a stale block edge (the tail
+    // stages reset theirs per job).
+    std::array<const Kernels*, kNumBuses> busKernels {};
+    for (size_t p = 0; p < (size_t) kNumPaths; ++p)
+        if (active[p] != nullptr)
+            blockShape[p] = makeShape (*active[p], shapeDamping[p].load (std::memory_order_relaxed),
+                                       shapeStretch[p].load (std::memory_order_relaxed));
+    for (int b = 0; b < kNumBuses; ++b)
+    {
+        const int p = busPath (b);
+        if (pathEnabled[p] && isPathReady ((Path) p))
+        {
+            busKernels[(size_t) b] = active[(size_t) p];
+        }
+        else if (busPrimed[(size_t) b])
+        {
+            std::fill (busOverlap[(size_t) b].begin(), busOverlap[(size_t) b].end(), 0.0f);
+            busPrimed[(size_t) b] = false;
+        }
+    }
+
+    const float* inputs[2] = { inL, inR };
+    const int numBins  = headSize + 1;
+    const int capacity = headHistory->capacity;
+    int done = 0;
+
+    while (done < numSamples)
+    {
+        const bool blockStart = (inputPos == 0);
+        const int  num = std::min (numSamples - done, headSize - inputPos);
+
+        // 1. Forward-transform the current (partial) input block of L and R
+        //    once, into the shared head history slot for this partition.
+        for (size_t c = 0; c < 2; ++c)
+        {
+            std::copy (inputs[c] + done, inputs[c] + done + num, inputBlock[c].begin() + inputPos);
+            auto& work = inputWork[c];
+            std::copy (inputBlock[c].begin(), inputBlock[c].end(), work.begin());
+            headFFT->forward (work.data());
+            std::copy (work.begin(), work.begin() + headSpecSize,
+                       headHistory->spectra[c].begin() + (ptrdiff_t) currentSegment * headSpecSize);
+        }
+
+        // 2. Per bus: older head partitions (cached per block) + current
+        //    partition, one inverse FFT, overlap-add.
+        for (int b = 0; b < kNumBuses; ++b)
+        {
+            const auto* k = busKernels[(size_t) b];
+            if (k == nullptr)
+                continue;
+
+            auto& tail = busTail[(size_t) b];
+            if (blockStart || ! busPrimed[(size_t) b])
+            {
+                std::fill (tail.begin(), tail.end(), 0.0f);
+                accumulateOlderPartitions (*k, b);
+                busPrimed[(size_t) b] = true;
+            }
+
+            auto& work = busWork[(size_t) b];
+            std::copy (tail.begin(), tail.end(), work.begin());
+            const auto& shape = blockShape[(size_t) busPath (b)];
+            for (const auto& f : k->stages.front())
+            {
+                if (f.bus != b || f.firstSegment > 0)
+                    continue;
+                const float* current = headHistory->spectra[(size_t) f.input].data()
+                                           + (ptrdiff_t) currentSegment * headSpecSize;
+                if (! shape.shaped)
+                {
+                    multiplyAccumulate (work.data(), current, f.spectra.data(), numBins);
+                    continue;
+                }
+                const float weight = shape.weight[(size_t) f.point];
+                if (weight != 0.0f)
+                    multiplyAccumulateScaled (work.data(), current, f.spectra.data(),
+                                              SegmentGain (weight, shape.damping * f.decayScale,
+                                                           headSize / 2, headSize).next(),
+                                              numBins);
+            }
+
+            headFFT->inverse (work.data());
+
+            const auto* overlap = busOverlap[(size_t) b].data();
+            float* out = busOut[b] + done;
+            for (int i = 0; i < num; ++i)
+                out[i] = work[(size_t) (inputPos + i)] + overlap[inputPos + i];
+        }
+
+        // 3. Tail stages: play finished jobs, queue completed partitions.
+        //    Their partitions are multiples of the head's, so boundaries line up.
+        for (int s = 0; s < (int) tailStages.size(); ++s)
+            advanceTailStage (s, inputs, done, num, busKernels, busOut);
+
+        inputPos += num;
+        done     += num;
+
+        // 4. Head partition complete: keep its overlap, clear the input block
+        //    and step the history ring (older partitions live at higher indices).
+        if (inputPos == headSize)
+        {
+            for (int b = 0; b < kNumBuses; ++b)
+                if (busKernels[(size_t) b] != nullptr)
+                    std::copy (busWork[(size_t) b].begin() + headSize,
+                               busWork[(size_t) b].begin() + headFFTSize,
+                               busOverlap[(size_t) b].begin());
+
+            for (auto& in : inputBlock)
+                std::fill (in.begin(), in.end(), 0.0f);
+            inputPos = 0;
+            currentSegment = (currentSegment > 0 ? currentSegment : capacity) - 1;
+        }
+    }
+}
@@ -0,0 +1,330 @@
+#pragma once
+
+#ifdef PING_TESTING_BUILD
+  #include <array>
+  #include <atomic>
+  #include <cstdint>
+  #include <memory>
+  #include <thread>
+  #include <vector>
+#else
+  #include <JuceHeader.h>
+  #include <array>
+  #include <atomic>
+  #include <cstdint>
+  #include <memory>
+  #include <thread>
+  #include <vector>
+#endif
+
+// ── TrueStereoConvolver ─────────────────────────────────────────────────────
+// Shared-input-FFT, non-uniformly-partitioned true-stereo convolution engine
+// for every mic path (MAIN ER + Tail, DIRECT, OUTRIG ER + Tail, AMBIENT ER +
+// Tail).
+//
+// Shared input FFT:
+//   • L and R are forward-transformed ONCE per partition into a shared
+//     history of input spectra (frequency-domain delay line), instead of once
+//     per mono convolver.
+//   • Every filter (LL/RL/LR/RR × ER/Tail × path) multiply-accumulates
+//     against that shared history, straight into its output bus.
+//   • Each output bus gets ONE inverse FFT. MAIN keeps ER and Tail on
+//     separate buses (erLevel / tailLevel / crossfeed / meters need them
+//     apart); OUTRIG and AMBIENT sum ER + Tail 1:1 in the frequency domain.
+//
+// Non-uniform partitioning (head + tail stages):
+//   • Head — partition B = nextPow2 (maxBlockSize), run on the audio thread
+//     with the zero-latency scheme juce::dsp::Convolution uses (the current
+//     partial block is re-transformed every call, older partitions are
+//     accumulated once per partition). Covers kernel samples [0, 2·P1).
+//   • Tail stage s — partition P_s (P1 = 8·B, ×8 per stage, capped at
+//     kMaxTailPartition), covering kernel samples [2·P_s, 2·P_s+1); the last
+//     stage runs to the end of the kernel. The audio thread forward-transforms
+//     each completed input partition into the stage history; the rest of the
+//     stage's work (MACs and one inverse FFT per bus) is a job of independent
+//     bus tasks run by the worker pool.
+//   • Because stage s starts at 2·P_s, its output for an input partition is
+//     not due until one full partition (P_s samples) after that partition
+//     completes. That is the workers' deadline. At the deadline the audio
+//     thread runs any tasks still unclaimed itself; a task never waits on
+//     another. With no wait limit (the default) it then waits for tasks
+//     still on a worker, so the output is identical whatever the thread
+//     timing. With setTailWaitLimit() it waits at most that long: a worker
+//     starved for longer (normal-priority threads under load) costs that
+//     stage one partition of silence and one dropped input partition, never
+//     an unbounded stall of the audio thread. With zero workers the audio
+//     thread runs every job itself.
+//   • Late-starting kernels: the Tail kernels begin at PathIR::tailOffset
+//     (the ER / Tail crossover, 80–85 ms). A filter only gets the segments
+//     that overlap it, so a Tail skips the segments before the crossover.
+//     Whenever the head ends before the crossover, the Tail runs only on
+//     the workers' large partitions. At 48 kHz that holds for blocks of up
+//     to 128 samples.
+//   • Hand-off is lock-free: tasks are claimed with an atomic counter, jobs
+//     are double-buffered (input / output) so the audio thread never waits
+//     on a job it is not about to play. Workers sleep on a counting
+//     semaphore (WakeSemaphore) with no timeout; the audio thread posts one
+//     token per worker for each job, which never blocks or takes a lock. An
+//     idle engine therefore costs no wake-ups at all.
+//
+// Per-bus workspaces (head accumulation / overlap, each tail stage's output
+// and overlap) are allocated the first time a path is loaded, so an
+// instance that only ever runs MAIN never carries DIRECT / OUTRIG / AMBIENT
+// buffers. The 8192 stage alone needs ~230 KB per bus. unloadPath() frees a
+// path's kernels when it is switched off for good (PingProcessor's path
+// hibernation). Once the audio thread has adopted the empty kernels,
+// releaseRetired() frees the path's workspaces too, and shrinks the last
+// tail stage's history to the longest path still loaded.
+//
+// Loading (message thread) builds every stage's filter spectra off the
+// audio thread and publishes them lock-free. The audio thread adopts them
+// at the top of the next block. Superseded kernels go back to the message
+// thread (releaseRetired) once no in-flight job still reads them. This is
+// the same pending / retired hand-off that ScratchArena uses. Kernels are
+// expected at the processing sample rate (PingProcessor resamples before
+// loading).
+//
+// Pure STL under PING_TESTING_BUILD (its own radix-2 FFT) so the partition
+// maths is covered by PingTests and Tools/convolver_benchmark.cpp; the
+// plugin build uses juce::dsp::FFT.
+// ───────────────────────────────────────────────────────────────────────────
+class TrueStereoConvolver
+{
+public:
+    enum Path : int { Main = 0, Direct, Outrig, Ambient, kNumPaths };
+
+    /** Output buses, in the order process() writes them. */
+    enum Bus : int
+    {
+        MainErL = 0, MainErR, MainTailL, MainTailR,
+        DirectL, DirectR,
+        OutrigL, OutrigR,
+        AmbientL, AmbientR,
+        kNumBuses
+    };
+
+    /** Mono kernels for one path, in true-stereo channel order LL, RL, LR, RR
+        (the same order as the 4-channel synth IR): LL / LR are driven by the L
+        input, RL / RR by the R input; LL + RL feed the left bus, LR + RR the
+        right. DIRECT uses `er` only (its IR is never split) and leaves `tail`
+        empty. Empty kernels are skipped. */
+    struct PathIR
+    {
+        std::array<std::vector<float>, 4> er;
+        std::array<std::vector<float>, 4> tail;
+        int tailOffset = 0;   // kernel sample the tail kernels start at (the ER / Tail crossover)
+    };
+
+    /** Live shaping: one stretch point of a path's bank (loadShapedPath). The
+        kernels are rendered at `stretch` WITHOUT the Decay envelope, which the
+        convolver applies at run time. envelopeLength is the envelope's length
+        N in exp (−6·damping·t / N) — the stretched IR length, in samples at
+        the processing rate; t is the kernel sample, so the tail's envelope
+        starts at tailOffset. */
+    struct ShapedPoint
+    {
+        float  stretch = 1.0f;
+        PathIR ir;
+        int    envelopeLength = 0;
+    };
+
+    static constexpr int kMaxStretchPoints = 8;
+
+    /** Largest tail partition. juce::dsp::FFT's fallback engine keeps its
+        scratch on the stack up to this size (order 14), so a job the audio
+        thread has to finish itself never touches the heap. */
+    static constexpr int kMaxTailPartition = 8192;
+    static constexpr int kTailPartitionRatio = 8;
+
+    explicit TrueStereoConvolver (int numWorkerThreads = 1);
+    ~TrueStereoConvolver();
+
+    /** Restarts the tail worker pool with `numWorkerThreads` threads (0 = the
+        audio thread runs every tail job at its deadline). Message thread; safe
+        while audio is running — in-flight jobs are finished by the audio thread
+        while the pool is down. */
+    void setNumWorkers (int numWorkerThreads);
+    int  getNumWorkers() const noexcept { return numWorkers; }
+
+    /** Longest the audio thread waits at a tail deadline for a task a worker
+        is still running. Negative (the default) waits for it, which keeps the
+        output independent of thread timing (DSP_25). Past the limit the stage
+        plays one partition of silence and drops that input partition
+        (DSP_30). Any thread. */
+    void setTailWaitLimit (int microseconds) noexcept { tailWaitLimitUs.store (microseconds, std::memory_order_relaxed); }
+
+    /** Tail deadlines that hit the wait limit since construction. Any thread. */
+    uint64_t getLateTailJobs() const noexcept { return lateTailJobs.load (std::memory_order_relaxed); }
+
+    /** Sets the partition layout from the host's maximum block size, drops
+        every loaded kernel (all paths become not-ready until reloaded) and
+        frees every path's bus workspaces. Non-RT; must not race with
+        process(). */
+    void prepare (int maxBlockSize);
+
+    /** Builds the partitioned spectra for `path` and publishes them to the
+        audio thread. Call from the message thread after prepare(). */
+    void loadPath (Path path, const PathIR& ir);
+
+    /** Drops `path`'s kernels: it stops being ready once the audio thread
+        adopts the change, and its spectra, bus workspaces and share of the
+        last-stage history come back through releaseRetired(). Same as
+        loading empty kernels. Message thread, after prepare(). */
+    void unloadPath (Path path);
+
+    /** Loads a bank of stretch points (ascending stretch, at most
+        kMaxStretchPoints) for `path`. Decay and Stretch then follow
+        setPathShape() without a reload: every partition of every filter is
+        scaled by the decay envelope at the partition's centre, and the two
+        stretch points either side of the requested stretch are crossfaded
+        (log-stretch weights) partition by partition. Costs one MAC per
+        filter segment for each point with a non-zero weight, and the
+        spectra of every point. Message thread, after prepare(). */
+    void loadShapedPath (Path path, const std::vector<ShapedPoint>& points);
+
+    /** Run-time Decay / Stretch for a path loaded with loadShapedPath():
+        damping = 1 − UI Decay (0 = no envelope), stretch is clamped to the
+        bank's range. Read by the audio thread once per process() call (tail
+        jobs keep the value they were submitted with). Ignored by paths
+        loaded with loadPath(). Any thread. */
+    void setPathShape (Path path, float damping, float stretch) noexcept
+    {
+        shapeDamping[(size_t) path].store (damping, std::memory_order_relaxed);
+        shapeStretch[(size_t) path].store (stretch, std::memory_order_relaxed);
+    }
+
+    /** Message thread: frees kernel sets / histories the audio thread has
+        swapped out, and the bus workspaces of unloaded paths it no longer
+        reads (publishing a smaller last-stage history if one now fits).
+        Cheap when there is nothing to free. */
+    void releaseRetired();
+
+    /** Longest kernel (samples) most recently loaded for `path`, 0 if none.
+        Safe from any thread. */
+    int getPathIRSize (Path path) const noexcept { return publishedIRSize[(size_t) path].load(); }
+
+    /** Bytes of per-bus workspace allocated so far (head and tail stages).
+        Message thread. */
+    size_t getBusWorkspaceBytes() const noexcept;
+
+    /** Partitions in the last tail stage's history as last published (the
+        audio thread installs it at its next job boundary). Message thread. */
+    int getTailHistoryCapacity() const noexcept { return publishedTailCapacity; }
+
+    /** Partition layout after prepare(): the head partition, and one entry per
+        tail stage. */
+    int getHeadPartitionSize() const noexcept { return headSize; }
+    int getNumTailStages() const noexcept { return (int) tailStages.size(); }
+    int getTailPartitionSize (int stage) const noexcept;
+
+    /** Audio thread. True once `path`'s kernels have been adopted by process(). */
+    bool isPathReady (Path path) const noexcept;
+
+    /** Audio thread. Installs any kernels published by loadPath(); call once
+        per block before isPathReady() / process(). Never allocates or frees. */
+    void adoptPending() noexcept;
+
+    /** Audio thread. Convolves inL / inR (numSamples, any size) into the
+        buses of every path with pathEnabled[p] set and kernels ready.
+        busOut[b] must have room for numSamples; buses of disabled paths are
+        left untouched. */
+    void process (const float* inL, const float* inR, int numSamples,
+                  const bool* pathEnabled, float* const* busOut) noexcept;
+
+private:
+    struct FFTImpl;
+    struct Kernels;
+    struct History;
+    struct TailStage;
+
+    // Per-path shaping snapshot: the weight of each stretch point and the
+    // damping. Unshaped paths (loadPath) have shaped == false and run the
+    // plain MACs.
+    struct PathShape
+    {
+        bool shaped = false;
+        float damping = 0.0f;
+        std::array<float, kMaxStretchPoints> weight {};
+    };
+
+    // ── Head (audio thread) ─────────────────────────────────────────────────
+    int headSize     = 0;   // partition size B
+    int headFFTSize  = 0;   // 2B
+    int headSpecSize = 0;   // 2B + 2 floats: bins 0..B, interleaved re/im
+    int headSegments = 0;   // 2·P1 / B
+
+    std::unique_ptr<FFTImpl> headFFT;
+    std::unique_ptr<History> headHistory;
+    std::array<std::vector<float>, 2> inputBlock;          // [L/R] current partial block, 2B (2nd half zero)
+    std::array<std::vector<float>, 2> inputWork;           // [L/R] 4B FFT workspace
+    // Per-bus, empty until the bus's path is first loaded (allocateBusBuffers).
+    std::array<std::vector<float>, kNumBuses> busTail;     // older-partition accumulation
+    std::array<std::vector<float>, kNumBuses> busWork;     // 4B: spectrum → time
+    std::array<std::vector<float>, kNumBuses> busOverlap;  // B
+    std::array<bool, kNumBuses> busPrimed {};
+    std::array<PathShape, kNumPaths> blockShape {};       // this process() call's shaping
+    int inputPos = 0;
+    int currentSegment = 0;
+
+    // ── Tail stages (worker pool) ───────────────────────────────────────────
+    std::vector<std::unique_ptr<TailStage>> tailStages;
+
+    // Last tail stage's history grows with the longest loaded kernel.
+    std::atomic<History*> pendingTailHistory { nullptr };
+    std::atomic<History*> retiredTailHistory { nullptr };
+
+    struct WakeSemaphore;
+    int numWorkers = 0;
+    std::vector<std::thread> workers;
+    std::atomic<bool> workersQuit { false };
+    std::atomic<int> runningWorkers { 0 };          // tokens the audio thread posts per job
+    std::unique_ptr<WakeSemaphore> workerWake;
+    std::atomic<int> tailWaitLimitUs { -1 };
+    std::atomic<uint64_t> lateTailJobs { 0 };
+
+    // ── Kernel ownership ────────────────────────────────────────────────────
+    // `active` / `draining` are audio-thread only; `pending` carries
+    // message → audio, `retired` audio → message. A replaced kernel set sits in
+    // `draining` until every tail job that was running with it has finished.
+    std::array<Kernels*, kNumPaths>              active {};
+    std::array<Kernels*, kNumPaths>              draining {};
+    std::array<unsigned, kNumPaths>              drainingStages {};   // bit per tail stage
+    std::array<std::atomic<Kernels*>, kNumPaths> pending {};
+    std::array<std::atomic<Kernels*>, kNumPaths> retired {};
+
+    // Message-thread bookkeeping: last-stage partitions needed per path, and
+    // the last-stage history capacity already published.
+    std::array<int, kNumPaths> publishedTailSegments {};
+    int publishedTailCapacity = 0;
+    std::array<std::atomic<int>, kNumPaths> publishedIRSize {};
+
+    // Audio → message: the path's active kernels are empty and no tail job
+    // still holds older ones, so its bus workspaces are not being read.
+    std::array<std::atomic<bool>, kNumPaths> pathBusesIdle {};
+
+    // setPathShape → audio thread.
+    std::array<std::atomic<float>, kNumPaths> shapeDamping {};
+    std::array<std::atomic<float>, kNumPaths> shapeStretch {};
+
+    void startWorkers();
+    void stopWorkers();
+    void workerLoop();
+    void dropAll();
+
+    void loadKernels (Path path, const std::vector<ShapedPoint>& points, bool shaped);
+    void allocateBusBuffers (Path path);
+    void releaseBusBuffers (Path path);
+    static PathShape makeShape (const Kernels& k, float damping, float stretch) noexcept;
+
+    void accumulateOlderPartitions (const Kernels& k, int bus) noexcept;
+    void advanceTailStage (int stageIndex, const float* const* inputs, int offset, int num,
+                           const std::array<const Kernels*, kNumBuses>& busKernels,
+                           float* const* busOut) noexcept;
+    bool finishTailJob (int stageIndex) noexcept;   // false: job still on a worker past the wait limit
+    void adoptTailHistory() noexcept;
+    void submitTailJob (int stageIndex, const std::array<const Kernels*, kNumBuses>& busKernels) noexcept;
+    void runTailTask (TailStage& stage, int task) noexcept;
+
+    TrueStereoConvolver (const TrueStereoConvolver&) = delete;
+    TrueStereoConvolver& operator= (const TrueStereoConvolver&) = delete;
+};
@@ -0,0 +1,218 @@
+// PingBenchmarks.cpp
+// Catch2 BENCHMARK suite for IRSynthEngine — the synthesis stages one by one
+// and full synthIR over a matrix of rooms. Timing only: nothing here asserts
+// on speed, and none of it runs under ctest.
+//
+// Build target: PingBenchmarks (see CMakeLists.txt). Catch2 takes 100
+// samples per benchmark by default; the synth matrix wants fewer:
+//
+//   ./PingBenchmarks "[kernel]" --benchmark-samples 20 --reporter xml::out=kernels.xml
+//   ./PingBenchmarks "[synth]"  --benchmark-samples 5  --reporter xml::out=synth.xml
+//
+// Tools/compare_benchmarks.py turns the XML into JSON and flags regressions
+// against Tests/benchmark_baseline.json (see the script header). Benchmark
+// names are the keys of that file, so keep them stable.
+//
+// Tags:
+//   [kernel]  calcRefs, calcRefsPolygon per shape, renderCh, renderFDNTail,
+//             applyModalBank, makeWav — seconds per case
+//   [synth]   synthIR over room size × RT60 × sample rate × enabled paths
+
+#define PING_TESTING_BUILD 1
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include "IRSynthEngine.h"
+#include "TestHelpers.h"
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <string>
+#include <vector>
+
+namespace
+{
+    // Same proportions as the test suites' small room; "large" is the
+    // IRSynthParams default hall.
+    struct Room { const char* name; double width, depth, height; };
+    const Room kSmall { "small", 10.0, 8.0, 5.0 };
+    const Room kLarge { "large", 28.0, 16.0, 12.0 };
+
+    IRSynthParams roomParams (const Room& room, bool dry = false, int sr = 48000)
+    {
+        IRSynthParams p;
+        p.width  = room.width;
+        p.depth  = room.depth;
+        p.height = room.height;
+        p.diffusion = 0.4;
+        p.sample_rate = sr;
+        if (dry)
+        {
+            p.floor_material   = "Carpet (thick)";
+            p.ceiling_material = "Acoustic ceiling tile";
+            p.wall_material    = "Heavy curtains";
+        }
+        return p;
+    }
+
+    // The inputs synthMainPath derives for the MAIN left-speaker / left-mic
+    // image sources: image order from the 500 Hz RT60, IR length from the
+    // longest band, flat ceiling, uniform wall reflection.
+    struct StageInputs
+    {
+        IRSynthParams p;
+        std::vector<double> rt;
+        double He = 0.0;
+        int sr = 0, mo = 0, irLen = 0, ec = 0;
+        double sx = 0.0, sy = 0.0, sz = 0.0, rx = 0.0, ry = 0.0, rz = 0.0;
+        std::array<double, 8> r {};
+
+        explicit StageInputs (const IRSynthParams& params) : p (params)
+        {
+            rt = IRSynthEngine::calcRT60 (p);
+            He = p.height;
+            sr = p.sample_rate;
+            const double rmMax = *std::max_element (rt.begin(), rt.end());
+            const double minDim = std::min ({ p.width, p.depth, He });
+            mo = std::min (60, std::max (3, (int) std::floor (rt[2] * 343.0 / minDim / 2.0)));
+            irLen = (int) std::floor (std::max (0.3, std::min (8.0 * rmMax, 30.0)) * sr);
+            ec = (int) std::floor (0.085 * sr);
+            sx = p.width * p.source_lx;  sy = p.depth * p.source_ly;  sz = std::min (1.0, He * 0.9);
+            rx = p.width * p.receiver_lx; ry = p.depth * p.receiver_ly; rz = std::min (3.0, He * 0.9);
+            r.fill (std::sqrt (1.0 - 0.05));
+        }
+
+        std::vector<IRSynthEngine::Ref> refs (bool erOnly) const
+        {
+            if (p.shape == "Rectangular")
+                return IRSynthEngine::calcRefs (rx, ry, rz, sx, sy, sz, p, He, mo, r, r, r, 1.0, 0.0, 0.0,
+                                                erOnly, ec, sr, 42u, p.mic_pattern, p.spkl_angle, p.micl_angle, 1e9);
+            return IRSynthEngine::calcRefsPolygon (rx, ry, rz, sx, sy, sz, p, He, mo, r, r, r, 1.0, 0.0, 0.0,
+                                                   erOnly, ec, sr, 42u, p.mic_pattern, p.spkl_angle, p.micl_angle, 1e9);
+        }
+    };
+
+    // Catch2 takes benchmark names as std::string&&, so names are built by
+    // value.
+    std::string benchName (const std::string& stage, const std::string& variant)
+    {
+        return stage + "/" + variant;
+    }
+
+    std::vector<double> noise (size_t n, uint32_t seed)
+    {
+        TestRng rng (seed);
+        std::vector<double> v (n);
+        for (auto& s : v)
+            s = rng.next() * 2.0 - 1.0;
+        return v;
+    }
+}
+
+// ── Kernels ──────────────────────────────────────────────────────────────────
+
+TEST_CASE("Bench: calcRefs", "[benchmark][kernel]")
+{
+    for (const Room& room : { kSmall, kLarge })
+    {
+        const StageInputs in (roomParams (room));
+        BENCHMARK (benchName ("calcRefs", std::string (room.name) + "/full")) { return in.refs (false); };
+        BENCHMARK (benchName ("calcRefs", std::string (room.name) + "/er-only")) { return in.refs (true); };
+    }
+}
+
+TEST_CASE("Bench: calcRefsPolygon", "[benchmark][kernel]")
+{
+    for (const char* shape : { "Fan / Shoebox", "Octagonal", "Circular Hall", "Cathedral" })
+    {
+        IRSynthParams p = roomParams (kSmall);
+        p.shape = shape;
+        const StageInputs in (p);
+        BENCHMARK (benchName ("calcRefsPolygon", shape)) { return in.refs (false); };
+    }
+}
+
+TEST_CASE("Bench: renderCh", "[benchmark][kernel]")
+{
+    for (const Room& room : { kSmall, kLarge })
+    {
+        const StageInputs in (roomParams (room));
+        const auto refs = in.refs (false);
+        BENCHMARK (benchName ("renderCh", std::string (room.name) + "/double"))
+        {
+            return IRSynthEngine::renderCh<double> (refs, in.irLen, 1.0, in.sr, in.p.diffusion, 0.0, 0.0);
+        };
+        BENCHMARK (benchName ("renderCh", std::string (room.name) + "/float"))
+        {
+            return IRSynthEngine::renderCh<float> (refs, in.irLen, 1.0, in.sr, in.p.diffusion, 0.0, 0.0);
+        };
+    }
+}
+
+TEST_CASE("Bench: renderFDNTail", "[benchmark][kernel]")
+{
+    for (const Room& room : { kSmall, kLarge })
+    {
+        IRSynthParams p = roomParams (room);
+        const StageInputs in (p);
+        const int maxRefCut = std::min (in.irLen, (int) (0.4 * in.sr));
+        const auto seed = noise ((size_t) in.irLen, 19u);
+        for (bool vectorised : { false, true })
+        {
+            p.fdn_vectorised = vectorised;
+            BENCHMARK (benchName ("renderFDNTail", std::string (room.name) + (vectorised ? "/vectorised" : "/reference")))
+            {
+                return IRSynthEngine::renderFDNTail (in.rt, in.irLen, in.ec, seed, p.diffusion, in.sr, 100u,
+                                                     p.width, p.depth, in.He, maxRefCut, &p);
+            };
+        }
+    }
+}
+
+TEST_CASE("Bench: applyModalBank", "[benchmark][kernel]")
+{
+    for (const Room& room : { kSmall, kLarge })
+    {
+        const StageInputs in (roomParams (room));
+        const auto x = noise ((size_t) in.irLen, 23u);
+        for (bool all : { false, true })
+        {
+            BENCHMARK_ADVANCED (benchName ("applyModalBank", std::string (room.name) + (all ? "/all-modes" : "/axial")))
+                (Catch::Benchmark::Chronometer meter)
+            {
+                std::vector<std::array<std::vector<double>, 4>> ch ((size_t) meter.runs(), { x, x, x, x });
+                meter.measure ([&] (int i)
+                {
+                    auto& c = ch[(size_t) i];
+                    IRSynthEngine::applyModalBank (c[0], c[1], c[2], c[3], room.width, room.depth, in.He,
+                                                   in.rt[0], 0.18, in.sr, "Rectangular", 0.0, all);
+                });
+            };
+        }
+    }
+}
+
+TEST_CASE("Bench: makeWav", "[benchmark][kernel]")
+{
+    const StageInputs in (roomParams (kLarge));
+    const auto x = noise ((size_t) in.irLen, 29u);
+    BENCHMARK ("makeWav/large") { return IRSynthEngine::makeWav (x, x, x, x, in.sr); };
+}
+
+// ── Full synthesis ───────────────────────────────────────────────────────────
+// Room size × RT60 (default hard finishes vs carpet / tiles / curtains) ×
+// sample rate × MAIN alone or with OUTRIG, AMBIENT and DIRECT. The stage
+// cache is off (its default), so every run computes every stage.
+TEST_CASE("Bench: synthIR", "[benchmark][synth]")
+{
+    for (const Room& room : { kSmall, kLarge })
+        for (bool dry : { true, false })
+            for (int sr : { 48000, 96000 })
+                for (bool allPaths : { false, true })
+                {
+                    IRSynthParams p = roomParams (room, dry, sr);
+                    p.outrig_enabled = p.ambient_enabled = p.direct_enabled = allPaths;
+                    const std::string variant = std::string (room.name) + (dry ? "/dry/" : "/live/")
+                                              + std::to_string (sr / 1000) + "k" + (allPaths ? "/all-paths" : "/main");
+                    BENCHMARK (benchName ("synthIR", variant)) { return IRSynthEngine::synthIR (p, nullptr); };
+                }
+}
@@ -12,10 +12,14 @@
 #include <catch2/catch_test_macros.hpp>
 #include <catch2/catch_approx.hpp>
 #include "TestHelpers.h"
+#include "ScratchArena.h"
+#include "TrueStereoConvolver.h"
+#include "IRTransformPipeline.h"
 #include <cmath>
 #include <vector>
 #include <array>
 #include <cstdint>
+#include <algorithm>
 
 // ─────────────────────────────────────────────────────────────────────────────
 // Reference implementations of the DSP structs under test.
@@ -1054,3 +1058,1065 @@ TEST_CASE("DSP_21: directivityCos 3D spherical-law-of-cosines is correct",
     }
 }
 
+
+// ─────────────────────────────────────────────────────────────────────────────
+// DSP_23: ScratchArena — processBlock's preallocated scratch storage.
+//
+// The audio thread only ever calls adoptPending / capacity / requestCapacity /
+// channel(s); the message thread calls serviceRegrow. This test drives both
+// sides from one thread to lock in the hand-off contract: slots never overlap,
+// a regrow only becomes visible after adoptPending, and a second regrow is not
+// adopted until the message thread has freed the retired arena.
+// ─────────────────────────────────────────────────────────────────────────────
+TEST_CASE("DSP_23: ScratchArena slots and off-thread regrow hand-off", "[dsp][scratch]")
+{
+    ScratchArena arena;
+    arena.prepare (64);
+    REQUIRE (arena.capacity() == 64);
+
+    SECTION("slots are disjoint, contiguous per slot and zero-initialised")
+    {
+        for (int s = 0; s < ScratchArena::kNumSlots; ++s)
+        {
+            float* p = arena.channel ((ScratchArena::Slot) s);
+            REQUIRE (p != nullptr);
+            for (int i = 0; i < 64; ++i)
+                REQUIRE (p[i] == 0.0f);
+            for (int i = 0; i < 64; ++i)
+                p[i] = (float) s;
+        }
+        for (int s = 0; s < ScratchArena::kNumSlots; ++s)
+            for (int i = 0; i < 64; ++i)
+                REQUIRE (arena.channel ((ScratchArena::Slot) s)[i] == (float) s);
+
+        // channels(first) is the pointer array the JUCE views are built from.
+        REQUIRE (arena.channels (ScratchArena::PlateL)[1] == arena.channel (ScratchArena::PlateR));
+    }
+
+    SECTION("oversized block: regrow is published off-thread and adopted on the next block")
+    {
+        arena.requestCapacity (256);
+        REQUIRE (arena.capacity() == 64);   // audio thread never grows in place
+
+        arena.serviceRegrow();              // message thread builds the 256 arena
+        REQUIRE (arena.capacity() == 64);   // not visible until the audio thread adopts it
+
+        arena.adoptPending();
+        REQUIRE (arena.capacity() == 256);
+
+        // Smaller requests never shrink or rebuild.
+        arena.requestCapacity (128);
+        arena.serviceRegrow();
+        arena.adoptPending();
+        REQUIRE (arena.capacity() == 256);
+    }
+
+    SECTION("repeated regrows recycle old arenas through the message thread")
+    {
+        arena.requestCapacity (128);
+        arena.serviceRegrow();
+        arena.adoptPending();               // 64 → retired, 128 active
+        REQUIRE (arena.capacity() == 128);
+
+        arena.requestCapacity (512);
+        arena.serviceRegrow();              // frees the 64 arena, publishes 512
+        arena.adoptPending();               // 128 → retired, 512 active
+        REQUIRE (arena.capacity() == 512);
+
+        arena.requestCapacity (1024);
+        arena.serviceRegrow();              // frees 128, publishes 1024
+        arena.adoptPending();
+        REQUIRE (arena.capacity() == 1024);
+
+        // Without a serviceRegrow nothing is pending, so adoption is a no-op.
+        arena.requestCapacity (2048);
+        arena.adoptPending();
+        REQUIRE (arena.capacity() == 1024);
+    }
+
+    SECTION("prepare resets capacity and drops any outstanding request")
+    {
+        arena.requestCapacity (4096);
+        arena.prepare (32);
+        REQUIRE (arena.capacity() == 32);
+        arena.serviceRegrow();
+        arena.adoptPending();
+        REQUIRE (arena.capacity() == 32);
+    }
+}
+
+
+// ─────────────────────────────────────────────────────────────────────────────
+// DSP_24: TrueStereoConvolver — shared-input-FFT partitioned convolution.
+//
+// Every bus must match direct time-domain true-stereo convolution
+// (L·LL + R·RL on the left, L·LR + R·RR on the right; OUTRIG / AMBIENT with
+// ER and Tail summed) for kernels longer than one partition, with host block
+// sizes that are neither constant nor a power of two. Also locks in the
+// lock-free load hand-off and the disabled-path behaviour.
+// ─────────────────────────────────────────────────────────────────────────────
+namespace
+{
+    std::vector<float> directConvolve (const std::vector<float>& x, const std::vector<float>& h)
+    {
+        std::vector<float> y (x.size(), 0.0f);
+        for (size_t n = 0; n < x.size(); ++n)
+        {
+            double acc = 0.0;
+            for (size_t k = 0; k < h.size() && k <= n; ++k)
+                acc += (double) h[k] * (double) x[n - k];
+            y[n] = (float) acc;
+        }
+        return y;
+    }
+
+    std::vector<float> noiseVector (uint32_t& seed, int n)
+    {
+        std::vector<float> v ((size_t) n);
+        for (auto& s : v)
+        {
+            seed = seed * 1664525u + 1013904223u;
+            s = (float) ((double) (seed >> 8) / 8388608.0 - 1.0);
+        }
+        return v;
+    }
+
+    // Runs `in` through the convolver with a repeating pattern of block sizes.
+    std::array<std::vector<float>, TrueStereoConvolver::kNumBuses>
+    runConvolver (TrueStereoConvolver& conv, const std::vector<float>& inL, const std::vector<float>& inR,
+                  const bool* enabled)
+    {
+        const int n = (int) inL.size();
+        std::array<std::vector<float>, TrueStereoConvolver::kNumBuses> out;
+        for (auto& b : out) b.assign ((size_t) n, 0.0f);
+
+        const int blockPattern[] = { 1, 96, 37, 64, 5, 96, 13 };
+        int pos = 0, bi = 0;
+        while (pos < n)
+        {
+            const int len = std::min (n - pos, blockPattern[bi++ % 7]);
+            float* busPtrs[TrueStereoConvolver::kNumBuses];
+            for (int b = 0; b < TrueStereoConvolver::kNumBuses; ++b)
+                busPtrs[b] = out[(size_t) b].data() + pos;
+            conv.adoptPending();
+            conv.process (inL.data() + pos, inR.data() + pos, len, enabled, busPtrs);
+            pos += len;
+        }
+        return out;
+    }
+}
+
+TEST_CASE("DSP_24: TrueStereoConvolver matches direct true-stereo convolution", "[dsp][convolver]")
+{
+    using TSC = TrueStereoConvolver;
+    uint32_t seed = 24u;
+    const int n = 4000;
+    const auto inL = noiseVector (seed, n);
+    const auto inR = noiseVector (seed, n);
+
+    TSC::PathIR mainIR, directIR, outrigIR;
+    for (size_t c = 0; c < 4; ++c)
+    {
+        mainIR.er[c]     = noiseVector (seed, 300 + 17 * (int) c);   // spans several partitions
+        mainIR.tail[c]   = noiseVector (seed, 900 + 31 * (int) c);
+        directIR.er[c]   = noiseVector (seed, 129);                  // one sample past a partition
+        outrigIR.er[c]   = noiseVector (seed, 50);
+        outrigIR.tail[c] = noiseVector (seed, 700);
+    }
+
+    TSC conv;
+    conv.prepare (96);   // partition = 128
+
+    REQUIRE_FALSE (conv.isPathReady (TSC::Main));
+    conv.loadPath (TSC::Main,   mainIR);
+    conv.loadPath (TSC::Direct, directIR);
+    conv.loadPath (TSC::Outrig, outrigIR);
+    REQUIRE_FALSE (conv.isPathReady (TSC::Main));   // published, not yet adopted
+    REQUIRE (conv.getPathIRSize (TSC::Main)   == 900 + 31 * 3);
+    REQUIRE (conv.getPathIRSize (TSC::Direct) == 129);
+    REQUIRE (conv.getPathIRSize (TSC::Ambient) == 0);
+
+    conv.adoptPending();
+    REQUIRE (conv.isPathReady (TSC::Main));
+    REQUIRE (conv.isPathReady (TSC::Direct));
+    REQUIRE (conv.isPathReady (TSC::Outrig));
+    REQUIRE_FALSE (conv.isPathReady (TSC::Ambient));
+
+    auto sum = [] (std::vector<float> a, const std::vector<float>& b)
+    {
+        for (size_t i = 0; i < a.size(); ++i) a[i] += b[i];
+        return a;
+    };
+    auto trueStereo = [&] (const std::array<std::vector<float>, 4>& h, std::vector<float>& l, std::vector<float>& r)
+    {
+        l = sum (directConvolve (inL, h[0]), directConvolve (inR, h[1]));
+        r = sum (directConvolve (inL, h[2]), directConvolve (inR, h[3]));
+    };
+    auto requireClose = [] (const std::vector<float>& got, const std::vector<float>& want)
+    {
+        double maxErr = 0.0, peak = 0.0;
+        for (size_t i = 0; i < want.size(); ++i)
+        {
+            maxErr = std::max (maxErr, (double) std::abs (got[i] - want[i]));
+            peak   = std::max (peak,   (double) std::abs (want[i]));
+        }
+        REQUIRE (peak > 1.0);
+        REQUIRE (maxErr < 1.0e-4 * peak);
+    };
+
+    SECTION("every enabled bus matches the time-domain reference")
+    {
+        const bool enabled[TSC::kNumPaths] { true, true, true, true };
+        const auto out = runConvolver (conv, inL, inR, enabled);
+
+        std::vector<float> l, r, l2, r2;
+        trueStereo (mainIR.er, l, r);
+        requireClose (out[TSC::MainErL], l);
+        requireClose (out[TSC::MainErR], r);
+        trueStereo (mainIR.tail, l, r);
+        requireClose (out[TSC::MainTailL], l);
+        requireClose (out[TSC::MainTailR], r);
+        trueStereo (directIR.er, l, r);
+        requireClose (out[TSC::DirectL], l);
+        requireClose (out[TSC::DirectR], r);
+        trueStereo (outrigIR.er, l, r);
+        trueStereo (outrigIR.tail, l2, r2);
+        requireClose (out[TSC::OutrigL], sum (l, l2));
+        requireClose (out[TSC::OutrigR], sum (r, r2));
+
+        // AMBIENT has no kernels: its buses are left untouched.
+        for (float s : out[TSC::AmbientL]) REQUIRE (s == 0.0f);
+    }
+
+    SECTION("disabled paths leave their buses untouched")
+    {
+        const bool enabled[TSC::kNumPaths] { false, true, false, false };
+        const auto out = runConvolver (conv, inL, inR, enabled);
+
+        for (float s : out[TSC::MainErL])  REQUIRE (s == 0.0f);
+        for (float s : out[TSC::OutrigR])  REQUIRE (s == 0.0f);
+
+        std::vector<float> l, r;
+        trueStereo (directIR.er, l, r);
+        requireClose (out[TSC::DirectL], l);
+        requireClose (out[TSC::DirectR], r);
+    }
+
+    SECTION("a reload is adopted on the next block and the old kernels are recycled")
+    {
+        TSC::PathIR longer = mainIR;
+        longer.tail[0] = noiseVector (seed, 3000);   // now reaches the first tail stage
+        conv.loadPath (TSC::Main, longer);
+        REQUIRE (conv.isPathReady (TSC::Main));      // old kernels stay live until adoption
+        REQUIRE (conv.getPathIRSize (TSC::Main) == 3000);
+
+        conv.adoptPending();
+        REQUIRE (conv.isPathReady (TSC::Main));
+        conv.releaseRetired();
+
+        const bool enabled[TSC::kNumPaths] { true, false, false, false };
+        const auto out = runConvolver (conv, inL, inR, enabled);
+        std::vector<float> l, r;
+        trueStereo (longer.tail, l, r);
+        requireClose (out[TSC::MainTailL], l);
+        requireClose (out[TSC::MainTailR], r);
+    }
+
+    SECTION("prepare drops every path")
+    {
+        conv.prepare (256);
+        REQUIRE_FALSE (conv.isPathReady (TSC::Main));
+        REQUIRE (conv.getPathIRSize (TSC::Main) == 0);
+    }
+}
+
+
+// ─────────────────────────────────────────────────────────────────────────────
+// DSP_25: TrueStereoConvolver — non-uniform partitions and the tail workers.
+//
+// With a 16-sample head the layout is head 16 / tail stages 128, 1024, 8192,
+// so a 20k-sample kernel runs through every stage, including the last one
+// whose input history is grown on load. Output must match direct convolution
+// and must be bit-identical with and without worker threads: the audio
+// thread finishes any job the pool has not completed by its deadline, so
+// scheduling can change who computes a partition but never the result.
+// ─────────────────────────────────────────────────────────────────────────────
+TEST_CASE("DSP_25: TrueStereoConvolver non-uniform tail stages are exact and deterministic", "[dsp][convolver]")
+{
+    using TSC = TrueStereoConvolver;
+    uint32_t seed = 25u;
+    const int n = 20000;
+    const auto inL = noiseVector (seed, n);
+    const auto inR = noiseVector (seed, n);
+
+    TSC::PathIR mainIR, ambientIR;
+    const int tailLen[4] = { 19000, 17001, 9000, 2100 };   // last stage, last stage, 1024 stage, 128 stage
+    for (size_t c = 0; c < 4; ++c)
+    {
+        mainIR.er[c]      = noiseVector (seed, 200);
+        mainIR.tail[c]    = noiseVector (seed, tailLen[c]);
+        ambientIR.tail[c] = noiseVector (seed, 300 + 500 * (int) c);
+    }
+
+    auto render = [&] (int numWorkers)
+    {
+        TSC conv (numWorkers);
+        conv.prepare (16);
+        conv.loadPath (TSC::Main,    mainIR);
+        conv.loadPath (TSC::Ambient, ambientIR);
+        const bool enabled[TSC::kNumPaths] { true, false, false, true };
+        return runConvolver (conv, inL, inR, enabled);
+    };
+
+    SECTION("partition layout")
+    {
+        TSC conv (0);
+        conv.prepare (16);
+        REQUIRE (conv.getHeadPartitionSize() == 16);
+        REQUIRE (conv.getNumTailStages() == 3);
+        REQUIRE (conv.getTailPartitionSize (0) == 128);
+        REQUIRE (conv.getTailPartitionSize (1) == 1024);
+        REQUIRE (conv.getTailPartitionSize (2) == TSC::kMaxTailPartition);
+
+        conv.prepare (512);   // 4096 first tail partition, then capped
+        REQUIRE (conv.getNumTailStages() == 2);
+        REQUIRE (conv.getTailPartitionSize (0) == 4096);
+        REQUIRE (conv.getTailPartitionSize (1) == TSC::kMaxTailPartition);
+    }
+
+    SECTION("every stage matches the time-domain reference")
+    {
+        const auto out = render (0);
+
+        // Reference at every 7th sample, to keep the direct sums cheap.
+        auto reference = [&] (const std::vector<float>& hl, const std::vector<float>& hr, int i)
+        {
+            double acc = 0.0;
+            for (int k = 0; k < (int) hl.size() && k <= i; ++k) acc += (double) hl[(size_t) k] * inL[(size_t) (i - k)];
+            for (int k = 0; k < (int) hr.size() && k <= i; ++k) acc += (double) hr[(size_t) k] * inR[(size_t) (i - k)];
+            return acc;
+        };
+        auto requireClose = [&] (const std::vector<float>& got, const std::vector<float>& hl, const std::vector<float>& hr)
+        {
+            double maxErr = 0.0, peak = 0.0;
+            for (int i = 0; i < n; i += 7)
+            {
+                const double want = reference (hl, hr, i);
+                maxErr = std::max (maxErr, std::abs ((double) got[(size_t) i] - want));
+                peak   = std::max (peak, std::abs (want));
+            }
+            REQUIRE (peak > 1.0);
+            REQUIRE (maxErr < 1.0e-4 * peak);
+        };
+
+        requireClose (out[TSC::MainTailL], mainIR.tail[0], mainIR.tail[1]);
+        requireClose (out[TSC::MainTailR], mainIR.tail[2], mainIR.tail[3]);
+        requireClose (out[TSC::MainErL],   mainIR.er[0],   mainIR.er[1]);
+        requireClose (out[TSC::AmbientR], ambientIR.tail[2], ambientIR.tail[3]);
+    }
+
+    SECTION("worker threads do not change a single sample")
+    {
+        const auto inline_ = render (0);
+        const auto pooled  = render (2);
+        for (int b = 0; b < TSC::kNumBuses; ++b)
+            REQUIRE (pooled[(size_t) b] == inline_[(size_t) b]);
+    }
+
+    SECTION("the pool can be resized while kernels are loaded")
+    {
+        TSC conv (1);
+        conv.prepare (16);
+        conv.loadPath (TSC::Main, mainIR);
+        conv.setNumWorkers (3);
+        REQUIRE (conv.getNumWorkers() == 3);
+        const bool enabled[TSC::kNumPaths] { true, false, false, false };
+        const auto out = runConvolver (conv, inL, inR, enabled);
+        REQUIRE (out[TSC::MainTailL] == render (0)[TSC::MainTailL]);
+    }
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// DSP_26 — IRTransformPipeline: memoised stages match the serial chain
+// ─────────────────────────────────────────────────────────────────────────────
+// referenceTransform is loadIRFromBuffer's transform chain as it ran before
+// the pipeline: one stage after another on a fresh buffer each time. The
+// pipeline must reproduce it bit for bit, whether it computes every stage or
+// reuses some from the previous run, and must reuse exactly the stages whose
+// inputs did not change.
+namespace
+{
+    struct ReferenceIR
+    {
+        std::vector<std::vector<float>> display;
+        std::array<std::vector<float>, 4> er, tail;
+        int stretchedLength = 0;
+    };
+
+    int referenceTrim (std::vector<std::vector<float>>& b, double sr)
+    {
+        const int nSamples = (int) b[0].size();
+        float peak = 1.0e-6f;
+        for (auto& ch : b)
+            for (float x : ch)
+                peak = std::max (peak, std::abs (x));
+        const float threshold = std::min (peak * 3.1622777e-5f, 3.1622777e-5f);
+        int lastSignificant = 0;
+        for (auto& ch : b)
+            for (int i = nSamples - 1; i >= 0; --i)
+                if (std::abs (ch[(size_t) i]) > threshold) { lastSignificant = std::max (lastSignificant, i); break; }
+        const int safetyTail = (int) (0.5 * sr);
+        int newLen = std::min (lastSignificant + safetyTail + 1, nSamples);
+        newLen = std::max (newLen, (int) (0.3 * sr));
+        if (newLen < nSamples)
+        {
+            const int fadeSamps = std::min (safetyTail, newLen);
+            const int fadeStart = newLen - fadeSamps;
+            for (auto& ch : b)
+            {
+                ch.resize ((size_t) newLen);
+                for (int i = fadeStart; i < newLen; ++i)
+                {
+                    const float t = (float) (i - fadeStart) / (float) std::max (fadeSamps, 1);
+                    ch[(size_t) i] *= 0.5f * (1.0f + std::cos (3.14159265358979323846f * t));
+                }
+            }
+        }
+        return (int) b[0].size();
+    }
+
+    ReferenceIR referenceTransform (std::vector<std::vector<float>> b, double sr,
+                                    const IRTransformPipeline::Settings& s)
+    {
+        if (s.reverse)
+        {
+            for (auto& ch : b)
+                std::reverse (ch.begin(), ch.end());
+            if (s.reverseTrim > 0.001f)
+            {
+                const int n = (int) b[0].size();
+                const int startIdx = (int) (s.reverseTrim * (float) n);
+                if (startIdx > 0 && startIdx < n && n - startIdx >= 64)
+                    for (auto& ch : b)
+                        ch.erase (ch.begin(), ch.begin() + startIdx);
+            }
+        }
+
+        const int origLen = (int) b[0].size();
+        int newLen = (int) (origLen * s.stretch);
+        if (newLen < 64) newLen = 64;
+        if (newLen != origLen)
+            for (auto& ch : b)
+            {
+                std::vector<float> dst ((size_t) newLen);
+                for (int i = 0; i < newLen; ++i)
+                {
+                    float srcIdx = (float) i * (float) origLen / (float) newLen;
+                    int i0 = (int) srcIdx;
+                    int i1 = std::min (i0 + 1, origLen - 1);
+                    float f = srcIdx - (float) i0;
+                    dst[(size_t) i] = ch[(size_t) i0] * (1.0f - f) + ch[(size_t) i1] * f;
+                }
+                ch = std::move (dst);
+            }
+
+        ReferenceIR r;
+        const int N = r.stretchedLength = (int) b[0].size();
+        if (s.decay > 0.001f)
+            for (auto& ch : b)
+                for (int i = 0; i < N; ++i)
+                    ch[(size_t) i] *= std::exp (-s.decay * 6.0f * ((float) i / (float) N));
+
+        const int fullLen = referenceTrim (b, sr);
+        r.display = b;
+
+        if (b.size() < 4)
+        {
+            const float gain = std::pow (10.0f, -15.0f * 0.05f);
+            std::vector<std::vector<float>> x (4, std::vector<float> ((size_t) fullLen, 0.0f));
+            for (int i = 0; i < fullLen; ++i)
+            {
+                x[0][(size_t) i] = (b[0][(size_t) i] * 0.5f) * gain;
+                x[3][(size_t) i] = (b[b.size() >= 2 ? 1 : 0][(size_t) i] * 0.5f) * gain;
+            }
+            b = std::move (x);
+        }
+
+        const int xo = s.erOnly ? fullLen : (int) (s.crossoverSeconds * sr);
+        const int fade = (int) (s.fadeSeconds * sr);
+        for (size_t c = 0; c < 4; ++c)
+        {
+            const int erLen = fullLen <= xo ? fullLen : xo + fade;
+            r.er[c].assign ((size_t) erLen, 0.0f);
+            std::copy (b[c].begin(), b[c].begin() + std::min (erLen, fullLen), r.er[c].begin());
+            if (fullLen > xo)
+                for (int i = 0; i < fade && xo + i < erLen; ++i)
+                    r.er[c][(size_t) (xo + i)] *= 1.0f - (float) i / (float) fade;
+
+            if (s.erOnly || fullLen <= xo)
+            {
+                r.tail[c].assign ((size_t) std::max (64, fade * 2), 0.0f);
+                continue;
+            }
+            r.tail[c].assign (b[c].begin() + xo, b[c].end());
+            for (int i = 0; i < std::min (fade, fullLen - xo); ++i)
+                r.tail[c][(size_t) i] *= (float) i / (float) fade;
+        }
+        return r;
+    }
+
+    // Decaying noise followed by silence, so the trim stage has work to do.
+    std::vector<std::vector<float>> testIR (uint32_t& seed, int numChannels, int n, int signalLen)
+    {
+        std::vector<std::vector<float>> b;
+        for (int c = 0; c < numChannels; ++c)
+        {
+            auto ch = noiseVector (seed, n);
+            for (int i = 0; i < n; ++i)
+                ch[(size_t) i] = i < signalLen ? ch[(size_t) i] * std::exp (-(float) i / 1500.0f) : 0.0f;
+            b.push_back (std::move (ch));
+        }
+        return b;
+    }
+
+    void runPipeline (IRTransformPipeline& pipeline, const std::vector<std::vector<float>>& b, double sr,
+                      const IRTransformPipeline::Settings& s)
+    {
+        std::vector<const float*> chans;
+        for (auto& ch : b)
+            chans.push_back (ch.data());
+        pipeline.run (chans.data(), (int) b.size(), (int) b[0].size(), sr, s);
+    }
+
+    void requireMatches (const IRTransformPipeline& pipeline, const ReferenceIR& ref)
+    {
+        REQUIRE (pipeline.getNumDisplayChannels() == (int) ref.display.size());
+        REQUIRE (pipeline.getLength() == (int) ref.display[0].size());
+        REQUIRE (pipeline.getStretchedLength() == ref.stretchedLength);
+        for (int c = 0; c < pipeline.getNumDisplayChannels(); ++c)
+            REQUIRE (std::equal (ref.display[(size_t) c].begin(), ref.display[(size_t) c].end(),
+                                 pipeline.getDisplayChannel (c)));
+        for (int c = 0; c < 4; ++c)
+        {
+            REQUIRE (pipeline.getEr (c) == ref.er[(size_t) c]);
+            REQUIRE (pipeline.getTail (c) == ref.tail[(size_t) c]);
+        }
+    }
+}
+
+TEST_CASE("DSP_26: IRTransformPipeline matches the serial transform chain and reuses unchanged stages",
+          "[dsp][transform]")
+{
+    using Settings = IRTransformPipeline::Settings;
+    const double sr = 8000.0;
+    uint32_t seed = 26u;
+
+    Settings base;
+    base.stretch = 1.0f;
+    base.decay = 0.0f;
+
+    SECTION("every combination matches, computed fresh or on a reused pipeline")
+    {
+        std::vector<Settings> combos;
+        for (bool reverse : { false, true })
+            for (float trim : { 0.0f, 0.3f })
+                for (float stretch : { 1.0f, 0.7f, 1.6f })
+                    for (float decay : { 0.0f, 0.6f })
+                        for (bool erOnly : { false, true })
+                        {
+                            Settings s = base;
+                            s.reverse = reverse;
+                            s.reverseTrim = trim;
+                            s.stretch = stretch;
+                            s.decay = decay;
+                            s.erOnly = erOnly;
+                            if (erOnly) { s.crossoverSeconds = 0.085; s.fadeSeconds = 0.020; }
+                            combos.push_back (s);
+                        }
+
+        for (int numChannels : { 1, 2, 4 })
+        {
+            const auto ir = testIR (seed, numChannels, 20000, 10000);
+            IRTransformPipeline reused;
+            for (const auto& s : combos)
+            {
+                const auto ref = referenceTransform (ir, sr, s);
+                IRTransformPipeline fresh;
+                runPipeline (fresh, ir, sr, s);
+                requireMatches (fresh, ref);
+                runPipeline (reused, ir, sr, s);
+                requireMatches (reused, ref);
+            }
+        }
+    }
+
+    SECTION("only the stages downstream of a change run again")
+    {
+        auto ir = testIR (seed, 4, 20000, 10000);
+        Settings s = base;
+        s.reverse = true;
+        s.reverseTrim = 0.2f;
+        s.stretch = 1.3f;
+        s.decay = 0.5f;
+
+        IRTransformPipeline pipeline;
+        runPipeline (pipeline, ir, sr, s);
+        const auto& run = pipeline.getLastRun();
+        REQUIRE ((run.input && run.reverse && run.stretch && run.decay && run.trim && run.expand && run.split));
+
+        runPipeline (pipeline, ir, sr, s);
+        REQUIRE_FALSE ((run.input || run.reverse || run.stretch || run.decay || run.trim || run.expand || run.split));
+        requireMatches (pipeline, referenceTransform (ir, sr, s));
+
+        s.decay = 0.8f;                      // Decay drag: stretched buffer reused
+        runPipeline (pipeline, ir, sr, s);
+        REQUIRE_FALSE ((run.input || run.reverse || run.stretch));
+        REQUIRE ((run.decay && run.trim && run.split));
+        requireMatches (pipeline, referenceTransform (ir, sr, s));
+
+        s.reverseTrim = 0.4f;                // Reverse Trim drag: reversed buffer reused
+        runPipeline (pipeline, ir, sr, s);
+        REQUIRE_FALSE ((run.input || run.reverse));
+        REQUIRE ((run.stretch && run.decay));
+        requireMatches (pipeline, referenceTransform (ir, sr, s));
+
+        s.crossoverSeconds = 0.085;          // split settings only
+        runPipeline (pipeline, ir, sr, s);
+        REQUIRE_FALSE ((run.stretch || run.decay || run.trim || run.expand));
+        REQUIRE (run.split);
+        requireMatches (pipeline, referenceTransform (ir, sr, s));
+
+        ir[2][100] += 0.25f;                 // new IR content: everything again
+        runPipeline (pipeline, ir, sr, s);
+        REQUIRE ((run.input && run.reverse && run.split));
+        requireMatches (pipeline, referenceTransform (ir, sr, s));
+
+        pipeline.release();
+        runPipeline (pipeline, ir, sr, s);
+        REQUIRE (run.input);
+        requireMatches (pipeline, referenceTransform (ir, sr, s));
+    }
+
+    SECTION("trimTrailingSilence matches the reference trim and leaves trimmed IRs alone")
+    {
+        auto ir = testIR (seed, 2, 20000, 10000);
+        auto expected = ir;
+        const int expectedLen = referenceTrim (expected, sr);
+        REQUIRE (expectedLen < 20000);
+
+        float* chans[2] { ir[0].data(), ir[1].data() };
+        REQUIRE (IRTransformPipeline::trimTrailingSilence (chans, 2, 20000, sr) == expectedLen);
+        for (size_t c = 0; c < 2; ++c)
+            REQUIRE (std::equal (expected[c].begin(), expected[c].end(), ir[c].begin()));
+
+        const auto before = ir;
+        REQUIRE (IRTransformPipeline::trimTrailingSilence (chans, 2, expectedLen, sr) == expectedLen);
+        REQUIRE (ir == before);
+    }
+}
+
+
+// ─────────────────────────────────────────────────────────────────────────────
+// DSP_27: TrueStereoConvolver — live Decay / Stretch shaping.
+//
+// A shaped path scales every partition of a kernel by the decay envelope at
+// the partition's centre, so its output must equal direct convolution with a
+// staircase-enveloped kernel built from the same partition layout (head 16,
+// tail stages 128 / 1024 / 8192). The Tail starts 300 samples in, so its
+// envelope does too. Stretch crossfades the two bank points either side,
+// with log-stretch weights.
+// ─────────────────────────────────────────────────────────────────────────────
+namespace
+{
+    // h (starting at kernel sample `offset`) scaled by exp (−rate · t) at the
+    // centre of the partition holding each sample, with the offset's leading
+    // zeros written out.
+    std::vector<float> staircaseKernel (const TrueStereoConvolver& conv, const std::vector<float>& h,
+                                        int offset, float rate)
+    {
+        std::vector<float> out ((size_t) offset + h.size(), 0.0f);
+        for (int k = offset; k < (int) out.size(); ++k)
+        {
+            int from = 0, partition = conv.getHeadPartitionSize();
+            for (int s = 0; s < conv.getNumTailStages(); ++s)
+            {
+                const int p = conv.getTailPartitionSize (s);
+                if (k < 2 * p)
+                    break;
+                from = 2 * p;
+                partition = p;
+            }
+            const int centre = from + ((k - from) / partition) * partition + partition / 2;
+            out[(size_t) k] = h[(size_t) (k - offset)] * std::exp (-rate * (float) centre);
+        }
+        return out;
+    }
+}
+
+TEST_CASE("DSP_27: TrueStereoConvolver live shaping applies the partitioned envelope and stretch crossfade",
+          "[dsp][convolver]")
+{
+    using TSC = TrueStereoConvolver;
+    uint32_t seed = 27u;
+    const int n = 20000;
+    const auto inL = noiseVector (seed, n);
+    const auto inR = noiseVector (seed, n);
+    const bool enabled[TSC::kNumPaths] { true, false, false, false };
+
+    auto makeIR = [&] (int tailLen)
+    {
+        TSC::PathIR ir;
+        for (size_t c = 0; c < 4; ++c)
+        {
+            ir.er[c]   = noiseVector (seed, 200);
+            ir.tail[c] = noiseVector (seed, tailLen + 301 * (int) c);
+        }
+        ir.tailOffset = 300;
+        return ir;
+    };
+    auto point = [] (float stretch, const TSC::PathIR& ir)
+    {
+        TSC::ShapedPoint p;
+        p.stretch = stretch;
+        p.ir = ir;
+        p.envelopeLength = 24000;
+        return p;
+    };
+    auto requireClose = [] (const std::vector<float>& got, const std::vector<float>& want)
+    {
+        double maxErr = 0.0, peak = 0.0;
+        for (size_t i = 0; i < want.size(); ++i)
+        {
+            maxErr = std::max (maxErr, (double) std::abs (got[i] - want[i]));
+            peak   = std::max (peak,   (double) std::abs (want[i]));
+        }
+        REQUIRE (peak > 1.0);
+        REQUIRE (maxErr < 1.0e-4 * peak);
+    };
+
+    const auto irA = makeIR (12000);   // reaches the 8192 stage
+    const auto irB = makeIR (9000);
+    const auto irC = makeIR (3000);
+
+    auto renderPlain = [&] (const TSC::PathIR& ir, float damping, float stretch)
+    {
+        TSC conv (0);
+        conv.prepare (16);
+        conv.loadPath (TSC::Main, ir);
+        conv.setPathShape (TSC::Main, damping, stretch);
+        return runConvolver (conv, inL, inR, enabled);
+    };
+    auto renderShaped = [&] (const std::vector<TSC::ShapedPoint>& points, float damping, float stretch)
+    {
+        TSC conv (0);
+        conv.prepare (16);
+        conv.loadShapedPath (TSC::Main, points);
+        conv.setPathShape (TSC::Main, damping, stretch);
+        return runConvolver (conv, inL, inR, enabled);
+    };
+
+    SECTION("no damping on a single point is the plain convolution")
+    {
+        const auto plain  = renderPlain (irA, 0.0f, 1.0f);
+        const auto shaped = renderShaped ({ point (1.0f, irA) }, 0.0f, 1.0f);
+        for (int b : { TSC::MainErL, TSC::MainErR, TSC::MainTailL, TSC::MainTailR })
+            requireClose (shaped[(size_t) b], plain[(size_t) b]);
+    }
+
+    SECTION("setPathShape does not touch paths loaded with loadPath")
+    {
+        REQUIRE (renderPlain (irA, 0.8f, 2.0f) == renderPlain (irA, 0.0f, 1.0f));
+    }
+
+    SECTION("damping matches convolution with the staircase envelope")
+    {
+        const float damping = 0.7f;
+        const float rate = damping * 6.0f / 24000.0f;
+        const auto out = renderShaped ({ point (1.0f, irA) }, damping, 1.0f);
+
+        TSC layout (0);
+        layout.prepare (16);
+        TSC::PathIR want;
+        for (size_t c = 0; c < 4; ++c)
+        {
+            want.er[c]   = staircaseKernel (layout, irA.er[c], 0, rate);
+            want.tail[c] = staircaseKernel (layout, irA.tail[c], 300, rate);
+        }
+        const auto ref = renderPlain (want, 0.0f, 1.0f);
+        for (int b : { TSC::MainErL, TSC::MainErR, TSC::MainTailL, TSC::MainTailR })
+            requireClose (out[(size_t) b], ref[(size_t) b]);
+
+        // The envelope really is applied: the late tail is well down on the
+        // undamped output.
+        const auto flat = renderPlain (irA, 0.0f, 1.0f);
+        double lateOut = 0.0, lateFlat = 0.0;
+        for (int i = n - 4000; i < n; ++i)
+        {
+            lateOut  += (double) out[TSC::MainTailL][(size_t) i] * out[TSC::MainTailL][(size_t) i];
+            lateFlat += (double) flat[TSC::MainTailL][(size_t) i] * flat[TSC::MainTailL][(size_t) i];
+        }
+        REQUIRE (lateOut < 0.5 * lateFlat);
+    }
+
+    SECTION("stretch selects and crossfades the bank points")
+    {
+        const std::vector<TSC::ShapedPoint> bank { point (0.5f, irA), point (1.0f, irB), point (2.0f, irC) };
+        const auto plainB = renderPlain (irB, 0.0f, 1.0f);
+        const auto plainC = renderPlain (irC, 0.0f, 1.0f);
+
+        const auto atB = renderShaped (bank, 0.0f, 1.0f);
+        requireClose (atB[TSC::MainTailR], plainB[TSC::MainTailR]);
+
+        const auto clamped = renderShaped (bank, 0.0f, 4.0f);   // past the last point
+        requireClose (clamped[TSC::MainTailL], plainC[TSC::MainTailL]);
+
+        const auto mid = renderShaped (bank, 0.0f, std::sqrt (2.0f));   // halfway in log stretch
+        for (int b : { TSC::MainErL, TSC::MainTailL })
+        {
+            std::vector<float> want ((size_t) n);
+            for (size_t i = 0; i < want.size(); ++i)
+                want[i] = 0.5f * (plainB[(size_t) b][i] + plainC[(size_t) b][i]);
+            requireClose (mid[(size_t) b], want);
+        }
+    }
+}
+
+
+// ─────────────────────────────────────────────────────────────────────────────
+// DSP_28: TrueStereoConvolver — late-starting Tail kernels.
+//
+// A Tail loaded with PathIR::tailOffset skips the segments before its offset.
+// It must sound exactly like the same kernel with the offset written out as
+// leading zeros, for offsets inside the head (100), inside the first tail
+// stage (3840, 80 ms at 48 kHz) and inside the last stage (17000) of the head
+// 16 / 128 / 1024 / 8192 layout.
+// ─────────────────────────────────────────────────────────────────────────────
+TEST_CASE("DSP_28: TrueStereoConvolver late-starting tail kernels match zero-padded kernels", "[dsp][convolver]")
+{
+    using TSC = TrueStereoConvolver;
+    uint32_t seed = 28u;
+    const int n = 24000;
+    const auto inL = noiseVector (seed, n);
+    const auto inR = noiseVector (seed, n);
+    const bool enabled[TSC::kNumPaths] { true, false, true, false };
+
+    TSC::PathIR base;
+    for (size_t c = 0; c < 4; ++c)
+    {
+        base.er[c]   = noiseVector (seed, 150);
+        base.tail[c] = noiseVector (seed, 5000 + 400 * (int) c);
+    }
+
+    for (int offset : { 100, 3840, 17000 })
+    {
+        TSC::PathIR late = base, padded = base;
+        late.tailOffset = offset;
+        for (auto& t : padded.tail)
+            t.insert (t.begin(), (size_t) offset, 0.0f);
+
+        auto render = [&] (const TSC::PathIR& ir)
+        {
+            TSC conv (0);
+            conv.prepare (16);
+            conv.loadPath (TSC::Main,   ir);
+            conv.loadPath (TSC::Outrig, ir);
+            REQUIRE (conv.getPathIRSize (TSC::Main) == offset + 5000 + 400 * 3);
+            return runConvolver (conv, inL, inR, enabled);
+        };
+        const auto got  = render (late);
+        const auto want = render (padded);
+
+        REQUIRE (got[TSC::MainErL] == want[TSC::MainErL]);
+        for (int b : { TSC::MainTailL, TSC::MainTailR, TSC::OutrigL, TSC::OutrigR })
+        {
+            double maxErr = 0.0, peak = 0.0;
+            for (int i = 0; i < n; ++i)
+            {
+                maxErr = std::max (maxErr, (double) std::abs (got[(size_t) b][(size_t) i] - want[(size_t) b][(size_t) i]));
+                peak   = std::max (peak,   (double) std::abs (want[(size_t) b][(size_t) i]));
+            }
+            REQUIRE (peak > 1.0);
+            REQUIRE (maxErr < 1.0e-5 * peak);
+        }
+
+        // Nothing of the Tail is heard before its offset (FFT rounding aside).
+        double early = 0.0, peak = 0.0;
+        for (int i = 0; i < n; ++i)
+        {
+            const double v = std::abs (got[TSC::MainTailL][(size_t) i]);
+            if (i < offset) early = std::max (early, v);
+            else            peak  = std::max (peak, v);
+        }
+        REQUIRE (early < 1.0e-6 * peak);
+    }
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// DSP_29: TrueStereoConvolver — lazy bus workspaces and unloadPath.
+//
+// prepare() allocates no per-bus workspace; each path's first load sizes its
+// own buses and nothing else. unloadPath() makes the path not ready and
+// silent; once the audio thread has let go, releaseRetired() frees its buses
+// and shrinks the last-stage history to MAIN's. A later load brings it all
+// back. MAIN's output must be identical whatever OUTRIG does meanwhile.
+// ─────────────────────────────────────────────────────────────────────────────
+TEST_CASE("DSP_29: TrueStereoConvolver allocates bus workspaces per path and unloads paths", "[dsp][convolver]")
+{
+    using TSC = TrueStereoConvolver;
+    uint32_t seed = 29u;
+    const int n = 20000;
+    const auto inL = noiseVector (seed, n);
+    const auto inR = noiseVector (seed, n);
+    const bool enabled[TSC::kNumPaths] { true, true, true, true };
+
+    // MAIN needs three partitions of the last tail stage (from kernel sample
+    // 16384 at block 64), so it reads older history spectra; OUTRIG needs five.
+    TSC::PathIR ir, longIr;
+    for (size_t c = 0; c < 4; ++c)
+    {
+        ir.er[c]       = noiseVector (seed, 200);
+        ir.tail[c]     = noiseVector (seed, 30000);
+        longIr.er[c]   = noiseVector (seed, 200);
+        longIr.tail[c] = noiseVector (seed, 50000);
+    }
+    ir.tailOffset = longIr.tailOffset = 3840;
+
+    auto peakOf = [] (const std::vector<float>& v)
+    {
+        double peak = 0.0;
+        for (float x : v) peak = std::max (peak, (double) std::abs (x));
+        return peak;
+    };
+
+    TSC conv (1), mainOnly (1);
+    for (auto* c : { &conv, &mainOnly })
+    {
+        c->prepare (64);
+        REQUIRE (c->getBusWorkspaceBytes() == 0);
+        c->loadPath (TSC::Main, ir);
+    }
+    const size_t mainBytes = conv.getBusWorkspaceBytes();
+    REQUIRE (mainBytes > 0);
+    const int mainHistory = conv.getTailHistoryCapacity();
+    REQUIRE (mainHistory == 3);
+
+    // Loading OUTRIG sizes its two buses: half of MAIN's four.
+    conv.loadPath (TSC::Outrig, longIr);
+    const size_t bothBytes = conv.getBusWorkspaceBytes();
+    REQUIRE (bothBytes == mainBytes + mainBytes / 2);
+    const int bothHistory = conv.getTailHistoryCapacity();
+    REQUIRE (bothHistory == 5);
+
+    auto first = runConvolver (conv, inL, inR, enabled);
+    REQUIRE (conv.isPathReady (TSC::Outrig));
+    REQUIRE_FALSE (conv.isPathReady (TSC::Direct));
+    REQUIRE (peakOf (first[TSC::OutrigL]) > 1.0);
+    REQUIRE (peakOf (first[TSC::DirectL]) == 0.0);
+
+    // Unloaded: not ready, its buses untouched, its size gone. Nothing is
+    // freed before the audio thread has adopted the empty kernels.
+    conv.unloadPath (TSC::Outrig);
+    REQUIRE (conv.getPathIRSize (TSC::Outrig) == 0);
+    conv.releaseRetired();
+    REQUIRE (conv.getBusWorkspaceBytes() == bothBytes);
+    REQUIRE (conv.getTailHistoryCapacity() == bothHistory);
+    auto second = runConvolver (conv, inL, inR, enabled);
+    REQUIRE_FALSE (conv.isPathReady (TSC::Outrig));
+    REQUIRE (peakOf (second[TSC::OutrigL]) == 0.0);
+    REQUIRE (peakOf (second[TSC::OutrigR]) == 0.0);
+
+    // Adopted: its buses go back, and the history shrinks to MAIN's.
+    conv.releaseRetired();
+    REQUIRE (conv.getBusWorkspaceBytes() == mainBytes);
+    REQUIRE (conv.getTailHistoryCapacity() == mainHistory);
+    auto third = runConvolver (conv, inL, inR, enabled);
+    REQUIRE (peakOf (third[TSC::OutrigL]) == 0.0);
+    conv.releaseRetired();   // the history third swapped out
+
+    // Reloaded: playing again, with fresh workspaces and a regrown history.
+    conv.loadPath (TSC::Outrig, longIr);
+    REQUIRE (conv.getBusWorkspaceBytes() == bothBytes);
+    REQUIRE (conv.getTailHistoryCapacity() == bothHistory);
+    auto fourth = runConvolver (conv, inL, inR, enabled);
+    REQUIRE (conv.isPathReady (TSC::Outrig));
+    REQUIRE (peakOf (fourth[TSC::OutrigL]) > 1.0);
+
+    // MAIN never notices, through the history shrink and regrow included.
+    for (const auto* got : { &first, &second, &third, &fourth })
+    {
+        const auto want = runConvolver (mainOnly, inL, inR, enabled);
+        for (int b : { TSC::MainErL, TSC::MainErR, TSC::MainTailL, TSC::MainTailR })
+            REQUIRE ((*got)[(size_t) b] == want[(size_t) b]);
+    }
+
+    conv.prepare (64);
+    REQUIRE (conv.getBusWorkspaceBytes() == 0);
+    REQUIRE_FALSE (conv.isPathReady (TSC::Main));
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// DSP_30: TrueStereoConvolver — bounded wait at a tail deadline.
+//
+// With a wait limit, a task still on a worker at its deadline costs that
+// stage one silent partition instead of stalling the audio thread. Feeding
+// blocks back to back (no real-time pacing) with a zero limit makes that
+// happen often. The output stays finite, and once the limit is lifted and
+// the dropped partitions have left the history, the output is exact again.
+// With no workers there is nothing to wait for, so the limit changes
+// nothing.
+// ─────────────────────────────────────────────────────────────────────────────
+TEST_CASE("DSP_30: TrueStereoConvolver bounds the wait for a late tail worker", "[dsp][convolver]")
+{
+    using TSC = TrueStereoConvolver;
+    uint32_t seed = 30u;
+    const int n = 20000;
+    const auto inL = noiseVector (seed, n);
+    const auto inR = noiseVector (seed, n);
+    const bool enabled[TSC::kNumPaths] { true, false, false, false };
+
+    TSC::PathIR ir;
+    for (size_t c = 0; c < 4; ++c)
+    {
+        ir.er[c]   = noiseVector (seed, 200);
+        ir.tail[c] = noiseVector (seed, 12000);
+    }
+
+    // Three passes over the input, so the last one starts with a history the
+    // first pass no longer reaches (12k kernel < 20k input).
+    auto render = [&] (TSC& conv, int firstPassLimitUs)
+    {
+        conv.prepare (16);
+        conv.loadPath (TSC::Main, ir);
+        conv.setTailWaitLimit (firstPassLimitUs);
+        auto first = runConvolver (conv, inL, inR, enabled);
+        conv.setTailWaitLimit (-1);
+        runConvolver (conv, inL, inR, enabled);
+        auto last = runConvolver (conv, inL, inR, enabled);
+        return std::make_pair (first, last);
+    };
+
+    TSC reference (0);
+    const auto want = render (reference, -1);
+
+    SECTION("no workers: the limit never triggers")
+    {
+        TSC conv (0);
+        const auto got = render (conv, 0);
+        REQUIRE (conv.getLateTailJobs() == 0);
+        for (int b = 0; b < TSC::kNumBuses; ++b)
+            REQUIRE (got.first[(size_t) b] == want.first[(size_t) b]);
+    }
+
+    SECTION("late workers degrade to silence and recover")
+    {
+        TSC conv (3);
+        const auto got = render (conv, 0);
+        INFO ("late tail jobs: " << conv.getLateTailJobs());
+        for (int b : { TSC::MainTailL, TSC::MainTailR })
+        {
+            for (float s : got.first[(size_t) b])
+                REQUIRE (std::isfinite (s));
+            REQUIRE (got.second[(size_t) b] == want.second[(size_t) b]);
+        }
+    }
+}
@@ -9,9 +9,23 @@
 #include <catch2/catch_test_macros.hpp>
 #include <catch2/catch_approx.hpp>
 #include "IRSynthEngine.h"
+#include "BandAmpKernel.h"
+#include "DecodedIRCache.h"
+#include "FdnKernel.h"
+#include "LiveFdnTail.h"
+#include "ModalBankKernel.h"
+#include "SynthStageCache.h"
+#include "SynthTaskPool.h"
 #include "TestHelpers.h"
+#include <algorithm>
 #include <cmath>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <iterator>
 #include <limits>
+#include <stdexcept>
+#include <thread>
 
 // ── Shared default params ───────────────────────────────────────────────────
 // Use a small room so tests run in a few seconds rather than 30+.
@@ -1109,6 +1123,1195 @@ TEST_CASE("IR_41: measured_peak_dbfs + applied_gain_db = post-trim peak",
     CHECK (std::fabs (reconstructed - finalPeakDb) < 1e-6);
 }
 
+// ─────────────────────────────────────────────────────────────────────────────
+// IR_42 — SynthTaskPool (per-channel stages of synthMainPath)
+// ─────────────────────────────────────────────────────────────────────────────
+// The MAIN path's bit-identity with the task pool is locked by IR_11 / IR_14;
+// this covers the pool itself: every task of a group has run when wait()
+// returns, groups nest inside tasks without deadlock (the waiting thread runs
+// queued work), a zero-thread pool runs everything on the caller, and a task
+// exception reaches the thread that waits.
+TEST_CASE("IR_42: SynthTaskPool groups, nesting and exceptions", "[engine][tasks]")
+{
+    for (int numThreads : { 0, 3 })
+    {
+        INFO ("numThreads = " << numThreads);
+        SynthTaskPool pool (numThreads);
+        REQUIRE (pool.getNumThreads() == numThreads);
+
+        // Nested: 4 outer tasks, each forking 8 inner tasks into its own slot.
+        std::vector<std::vector<int>> out (4, std::vector<int> (8, 0));
+        {
+            SynthTaskPool::TaskGroup outer (pool);
+            for (int i = 0; i < 4; ++i)
+                outer.run ([&pool, &out, i]
+                {
+                    SynthTaskPool::TaskGroup inner (pool);
+                    for (int j = 0; j < 8; ++j)
+                        inner.run ([&out, i, j] { out[(size_t) i][(size_t) j] = i * 8 + j; });
+                    inner.wait();
+                });
+            outer.wait();
+        }
+        for (int i = 0; i < 4; ++i)
+            for (int j = 0; j < 8; ++j)
+                REQUIRE (out[(size_t) i][(size_t) j] == i * 8 + j);
+
+        // Exceptions: the rest of the group still runs, wait() rethrows.
+        int ran = 0;
+        SynthTaskPool::TaskGroup group (pool);
+        group.run ([] { throw std::runtime_error ("task failed"); });
+        group.run ([&ran] { ++ran; });
+        REQUIRE_THROWS_AS (group.wait(), std::runtime_error);
+        REQUIRE (ran == 1);
+        REQUIRE_NOTHROW (group.wait());
+    }
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// IR_43 — SynthTaskPool cooperative cancellation
+// ─────────────────────────────────────────────────────────────────────────────
+// Cancelling a group drops its queued tasks (and those of nested groups that
+// share its token) without running them; wait() still returns. Uses a
+// zero-thread pool so nothing runs before wait() and the counts are exact.
+TEST_CASE("IR_43: SynthTaskPool cancellation drops queued tasks", "[engine][tasks]")
+{
+    SynthTaskPool pool (0);
+    std::atomic<int> ran { 0 };
+
+    SECTION("cancel before wait: nothing runs")
+    {
+        SynthTaskPool::TaskGroup group (pool);
+        for (int i = 0; i < 10; ++i)
+            group.run ([&ran] { ++ran; });
+        group.cancel();
+        group.wait();
+        REQUIRE (ran.load() == 0);
+        REQUIRE (group.isCancelled());
+    }
+
+    SECTION("a task cancelling its group stops the rest, including nested groups")
+    {
+        SynthTaskPool::TaskGroup group (pool);
+        group.run ([&]
+        {
+            ++ran;
+            SynthTaskPool::TaskGroup nested (pool, group.getToken());
+            nested.run ([&ran] { ++ran; });
+            group.cancel();          // before nested.wait(): the nested task is dropped
+            nested.wait();
+        });
+        for (int i = 0; i < 10; ++i)
+            group.run ([&ran] { ++ran; });
+        group.wait();
+        REQUIRE (ran.load() == 1);
+    }
+
+    SECTION("other groups are unaffected")
+    {
+        SynthTaskPool::TaskGroup cancelled (pool), live (pool);
+        cancelled.run ([&ran] { ran += 100; });
+        live.run ([&ran] { ++ran; });
+        cancelled.cancel();
+        live.wait();
+        cancelled.wait();
+        REQUIRE (ran.load() == 1);
+    }
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// IR_44 — synthIR cancellation
+// ─────────────────────────────────────────────────────────────────────────────
+// A cancelled synth returns success == false / cancelled == true with no IR,
+// whether the token fires before the call or mid-run (another thread cancels
+// 50 ms after the first progress report, i.e. inside the image-source
+// stage). The shared pool must be usable straight afterwards.
+TEST_CASE("IR_44: synthIR stops early when its cancellation token fires", "[engine][tasks]")
+{
+    IRSynthParams p = smallRoomParams();
+    SynthTaskPool::CancellationToken token;
+
+    SECTION("cancelled before the call")
+    {
+        token.cancel();
+        auto r = IRSynthEngine::synthIR (p, nullptr, token);
+        REQUIRE_FALSE (r.success);
+        REQUIRE (r.cancelled);
+        REQUIRE (r.iLL.empty());
+    }
+
+    SECTION("cancelled mid-run, all mic paths enabled")
+    {
+        p.outrig_enabled = p.ambient_enabled = p.direct_enabled = true;
+        std::atomic<bool> started { false };
+        std::thread canceller ([&]
+        {
+            while (! started.load())
+                std::this_thread::yield();
+            std::this_thread::sleep_for (std::chrono::milliseconds (50));
+            token.cancel();
+        });
+        auto r = IRSynthEngine::synthIR (p, [&started] (double, const std::string&)
+        {
+            started.store (true);
+        }, token);
+        canceller.join();
+        REQUIRE_FALSE (r.success);
+        REQUIRE (r.cancelled);
+        REQUIRE (r.iLL.empty());
+        REQUIRE_FALSE (r.outrig.synthesised);
+        REQUIRE_FALSE (r.ambient.synthesised);
+    }
+
+    std::atomic<int> ran { 0 };
+    SynthTaskPool::TaskGroup after;
+    after.run ([&ran] { ++ran; });
+    after.wait();
+    REQUIRE (ran.load() == 1);
+}
+
+TEST_CASE("IR_45: synthPreviewIR is a capped prefix of the full IR", "[engine][preview]")
+{
+    IRSynthParams p = smallRoomParams();
+    auto full    = IRSynthEngine::synthIR (p, nullptr);
+    auto preview = IRSynthEngine::synthPreviewIR (p, nullptr);
+
+    REQUIRE (full.success);
+    REQUIRE (preview.success);
+    REQUIRE (preview.preview);
+    REQUIRE_FALSE (full.preview);
+    REQUIRE (preview.sampleRate == full.sampleRate);
+    REQUIRE (preview.irLen <= (int) std::floor (IRSynthEngine::kPreviewMaxSeconds * preview.sampleRate));
+    REQUIRE (preview.irLen <= full.irLen);
+
+    // Low-order reflections arrive first and share seeds with the full run,
+    // so the opening of the preview matches the full IR sample for sample.
+    const int n = (int) (0.05 * full.sampleRate);
+    REQUIRE (preview.irLen >= n);
+    for (int i = 0; i < n; ++i)
+    {
+        REQUIRE (preview.iLL[(size_t) i] == full.iLL[(size_t) i]);
+        REQUIRE (preview.iRR[(size_t) i] == full.iRR[(size_t) i]);
+    }
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// IR_46 — SynthStageCache LRU and budget
+// ─────────────────────────────────────────────────────────────────────────────
+TEST_CASE("IR_46: SynthStageCache evicts least recently used entries", "[engine][cache]")
+{
+    using Vec = std::vector<double>;
+    auto entry = [] (double v) { return std::make_shared<const Vec> (Vec (4, v)); };
+    const size_t bytes = 4 * sizeof (double);
+
+    SynthStageCache cache (3 * bytes);
+    cache.insert<Vec> (1, entry (1.0), bytes);
+    cache.insert<Vec> (2, entry (2.0), bytes);
+    cache.insert<Vec> (3, entry (3.0), bytes);
+    REQUIRE (cache.find<Vec> (1) != nullptr);        // 1 is now the most recent
+
+    cache.insert<Vec> (4, entry (4.0), bytes);       // evicts 2
+    REQUIRE (cache.find<Vec> (2) == nullptr);
+    REQUIRE ((*cache.find<Vec> (1))[0] == 1.0);
+    REQUIRE ((*cache.find<Vec> (4))[0] == 4.0);
+    REQUIRE (cache.getStats().usedBytes == 3 * bytes);
+    REQUIRE (cache.getStats().evictions == 1);
+
+    // Wrong type under a key is a miss, not a bad cast.
+    REQUIRE (cache.find<MicIRChannels> (1) == nullptr);
+
+    // Entries larger than the budget are never stored; a held entry outlives
+    // its eviction.
+    auto held = cache.find<Vec> (3);
+    cache.insert<Vec> (5, entry (5.0), 4 * bytes);
+    REQUIRE (cache.find<Vec> (5) == nullptr);
+    cache.setBudgetBytes (0);
+    REQUIRE (cache.getStats().numEntries == 0);
+    REQUIRE (cache.find<Vec> (1) == nullptr);
+    REQUIRE ((*held)[0] == 3.0);
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// IR_47 — Incremental re-synthesis through the stage cache
+// ─────────────────────────────────────────────────────────────────────────────
+// Cached stages must reproduce an uncached synth bit for bit, and moving the
+// OUTRIG pair must leave MAIN (a path-cache hit) untouched. Flipping only the
+// FDN core (fdn_vectorised) must miss both path entries.
+TEST_CASE("IR_47: stage cache reuses unchanged paths bit-identically", "[engine][cache]")
+{
+    struct CacheOn
+    {
+        CacheOn()  { SynthStageCache::shared().setBudgetBytes (SynthStageCache::kInteractiveBudgetBytes); }
+        ~CacheOn() { SynthStageCache::shared().setBudgetBytes (0); }
+    };
+
+    IRSynthParams p = smallRoomParams();
+    p.outrig_enabled = true;
+    const auto reference = IRSynthEngine::synthIR (p, nullptr);   // cache off
+    REQUIRE (reference.success);
+    IRSynthParams otherCore = p;
+    otherCore.fdn_vectorised = ! p.fdn_vectorised;
+    const auto otherCoreReference = IRSynthEngine::synthIR (otherCore, nullptr);
+    REQUIRE (otherCoreReference.success);
+
+    CacheOn cacheOn;
+    auto& cache = SynthStageCache::shared();
+
+    const auto cold = IRSynthEngine::synthIR (p, nullptr);
+    REQUIRE (cold.iLL == reference.iLL);
+    REQUIRE (cold.iRR == reference.iRR);
+    REQUIRE (cold.outrig.LL == reference.outrig.LL);
+    REQUIRE (cold.outrig.RR == reference.outrig.RR);
+
+    const auto hitsBefore = cache.getStats().hits;
+    const auto warm = IRSynthEngine::synthIR (p, nullptr);
+    REQUIRE (cache.getStats().hits >= hitsBefore + 2);   // both path entries
+    REQUIRE (warm.iLL == reference.iLL);
+    REQUIRE (warm.iRL == reference.iRL);
+    REQUIRE (warm.outrig.LR == reference.outrig.LR);
+    REQUIRE (warm.irLen == reference.irLen);
+    REQUIRE (warm.rt60 == reference.rt60);
+
+    IRSynthParams moved = p;
+    moved.outrig_lx += 0.05;
+    moved.outrig_rx += 0.05;
+    const auto hitsBeforeEdit = cache.getStats().hits;
+    const auto edited = IRSynthEngine::synthIR (moved, nullptr);
+    REQUIRE (edited.success);
+    REQUIRE (cache.getStats().hits == hitsBeforeEdit + 1);   // MAIN only; every OUTRIG stage reruns
+    REQUIRE (edited.iLL == reference.iLL);
+    REQUIRE (edited.iRR == reference.iRR);
+    REQUIRE (edited.outrig.LL != reference.outrig.LL);
+
+    // The two cores are not bit-identical (IR_52), so a stale path hit would show.
+    const auto missesBeforeCore = cache.getStats().misses;
+    const auto switched = IRSynthEngine::synthIR (otherCore, nullptr);
+    REQUIRE (switched.success);
+    REQUIRE (cache.getStats().misses >= missesBeforeCore + 2);   // MAIN and OUTRIG path entries
+    REQUIRE (switched.iLL == otherCoreReference.iLL);
+    REQUIRE (switched.outrig.LL == otherCoreReference.outrig.LL);
+    REQUIRE (switched.iLL != reference.iLL);
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// IR_48 — BandAmpKernel matches the scalar per-band amplitude loop
+// ─────────────────────────────────────────────────────────────────────────────
+// The vector kernel (AVX / SSE2 / NEON) fed from PowerTable rows must equal,
+// bit for bit, the inline std::pow loop calcRefs ran before the kernel.
+TEST_CASE("IR_48: BandAmpKernel is bit-identical to the scalar band loop", "[engine][simd]")
+{
+    using namespace BandAmpKernel;
+    INFO ("kernel ISA: " << isaName());
+
+    uint32_t seed = 12345u;
+    auto uni = [&seed] (double lo, double hi)
+    {
+        seed = seed * 1664525u + 1013904223u;
+        return lo + (hi - lo) * (double) (seed >> 8) / 16777216.0;
+    };
+
+    const int mo = 12;
+    Bands rF, rC, rW, vBase, oBase, air, mic, sg;
+    for (int b = 0; b < kNumBands; ++b)
+    {
+        rF[(size_t) b] = uni (0.3, 1.0);
+        rC[(size_t) b] = uni (0.3, 1.0);
+        rW[(size_t) b] = uni (0.3, 1.0);
+    }
+    const double oF = uni (0.8, 1.0), vHfA = uni (0.0, 0.3);
+    for (int b = 0; b < kNumBands; ++b)
+        vBase[(size_t) b] = 1.0 - vHfA * std::min (b / 3.0, 1.0);
+    oBase.fill (oF);
+
+    PowerTable powF, powC, powW, powO, powV;
+    powF.build (rF, (mo + 1) / 2);
+    powC.build (rC, mo / 2);
+    powW.build (rW, 2 * mo);
+    powO.build (oBase, mo);
+    powV.build (vBase, mo);
+
+    for (int trial = 0; trial < 2000; ++trial)
+    {
+        const int nx = (int) uni (-mo, mo + 1), ny = (int) uni (-mo, mo + 1), nz = (int) uni (-mo, mo + 1);
+        const double dist = uni (0.1, 300.0);
+        const double polarity = ((nx + ny + nz) % 2 == 0) ? 1.0 : -1.0;
+        for (int b = 0; b < kNumBands; ++b)
+        {
+            air[(size_t) b] = uni (0.0, 1.0);
+            mic[(size_t) b] = uni (0.0, 1.0);
+            sg[(size_t) b]  = uni (0.0, 1.0);
+        }
+
+        const double* factors[kNumFactors] = {
+            powF.row ((std::abs (nz) + 1) / 2), powC.row (std::abs (nz) / 2),
+            powW.row (std::abs (nx) + std::abs (ny)),
+            powO.row (std::abs (ny)), powV.row (std::abs (nz)) };
+        double simd[kNumBands], scalar[kNumBands];
+        amplitudes (1.0 / std::max (dist, 0.5), factors, air.data(), mic.data(), sg.data(), polarity, simd);
+        amplitudesScalar (1.0 / std::max (dist, 0.5), factors, air.data(), mic.data(), sg.data(), polarity, scalar);
+
+        for (int b = 0; b < kNumBands; ++b)
+        {
+            // The pre-kernel calcRefs loop, verbatim.
+            double a = 1.0 / std::max (dist, 0.5);
+            a *= std::pow (rF[(size_t) b], std::ceil (std::abs (nz) / 2.0));
+            a *= std::pow (rC[(size_t) b], std::floor (std::abs (nz) / 2.0));
+            a *= std::pow (rW[(size_t) b], std::abs (nx) + std::abs (ny));
+            if (std::abs (ny) > 0) a *= std::pow (oF, std::abs (ny));
+            if (std::abs (nz) > 0) a *= std::pow (vBase[(size_t) b], std::abs (nz));
+            const double golden = a * air[(size_t) b] * mic[(size_t) b] * sg[(size_t) b] * polarity;
+
+            REQUIRE (scalar[b] == golden);
+            REQUIRE (simd[b] == golden);
+        }
+    }
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// IR_51 — sparse renderCh matches the dense band-buffer render
+// ─────────────────────────────────────────────────────────────────────────────
+// denseRenderChReference is the pre-sparse renderCh (eight irLen-long band
+// buffers, full-length bpF per band, then the ER allpass), with bpF and
+// makeAllpassDiffuserForER duplicated locally. Keep in step with
+// IRSynthEngine.cpp if the band filter, deposit or diffuser changes.
+static std::vector<double> denseRenderChReference (const std::vector<IRSynthEngine::Ref>& refs,
+                                                   int irLen, double den, int sr, double diffusion,
+                                                   double reflectionSpreadMs, double freqScatterMs)
+{
+    const int NB = 8;
+    const double bands[NB] = { 125, 250, 500, 1000, 2000, 4000, 8000, 16000 };
+    std::vector<std::vector<double>> bi (NB, std::vector<double> ((size_t) irLen, 0.0));
+    const int spreadHalf = (reflectionSpreadMs > 0.0)
+        ? std::max (1, (int) std::round (reflectionSpreadMs * 0.001 * sr * 0.5)) : 0;
+
+    for (const auto& r : refs)
+    {
+        double lat = std::abs (std::sin (r.az));
+        if (spreadHalf <= 0)
+        {
+            if (r.t >= irLen) continue;
+            for (int b = 0; b < NB; ++b)
+            {
+                int bt = r.t;
+                if (freqScatterMs > 0.0 && b > 0)
+                {
+                    uint32_t h = ((uint32_t) (r.t + 1) * 2654435769u) ^ ((uint32_t) b * 1234567891u);
+                    double frac = (double) (h & 0xFFFF) / 65535.0 - 0.5;
+                    double scale = (double) b / (double) (NB - 1);
+                    bt += (int) std::round (frac * 2.0 * freqScatterMs * scale * sr / 1000.0);
+                    bt = std::clamp (bt, 0, irLen - 1);
+                }
+                bi[(size_t) b][(size_t) bt] += r.amps[(size_t) b] * den * (1.0 - lat * ((double) b / (double) (NB - 1)) * 0.5);
+            }
+        }
+        else
+        {
+            double weightSum = 0.0;
+            for (int d = -spreadHalf; d <= spreadHalf; ++d)
+                weightSum += 1.0 - (double) std::abs (d) / (double) (spreadHalf + 1);
+            const double invSum = (weightSum > 1e-12) ? 1.0 / weightSum : 1.0;
+            for (int d = -spreadHalf; d <= spreadHalf; ++d)
+            {
+                int i = r.t + d;
+                if (i < 0 || i >= irLen) continue;
+                double w = (1.0 - (double) std::abs (d) / (double) (spreadHalf + 1)) * invSum;
+                for (int b = 0; b < NB; ++b)
+                    bi[(size_t) b][(size_t) i] += r.amps[(size_t) b] * den * (1.0 - lat * ((double) b / (double) (NB - 1)) * 0.5) * w;
+            }
+        }
+    }
+
+    std::vector<double> raw ((size_t) irLen, 0.0);
+    for (int b = 0; b < NB; ++b)
+    {
+        double m = 0.0;
+        for (double v : bi[(size_t) b]) m = std::max (m, std::abs (v));
+        if (m <= 1e-12) continue;
+
+        const double fc = bands[b];
+        double wl = std::max (fc / 1.414, 20.0) / (sr / 2.0);
+        double wh = std::min (fc * 1.414, sr / 2.0 - 1.0) / (sr / 2.0);
+        double wc = (wl + wh) / 2.0;
+        double Q = wc / (wh - wl);
+        double K = std::tan (wc * 3.141592653589793 * 0.5);
+        double n = 1.0 / (1.0 + K / Q + K * K);
+        double b0 = K / Q * n, b2 = -b0, a1 = 2.0 * (K * K - 1.0) * n, a2 = (1.0 - K / Q + K * K) * n;
+        double x1 = 0, x2 = 0, y1 = 0, y2 = 0;
+        for (int i = 0; i < irLen; ++i)
+        {
+            double x = bi[(size_t) b][(size_t) i];
+            double y = b0 * x + b2 * x2 - a1 * y1 - a2 * y2;
+            raw[(size_t) i] += y;
+            x2 = x1; x1 = x; y2 = y1; y1 = y;
+        }
+    }
+
+    if (diffusion > 0.02)
+    {
+        const int dryEnd = (int) std::round (0.065 * sr);
+        const int fadeLen = (int) std::round (0.020 * sr);
+        const int wetStart = dryEnd + fadeLen;
+        const double g = 0.5 + diffusion * 0.25;
+        const double delaysSec[4] = { 0.0081, 0.0047, 0.0023, 0.0007 };
+        std::vector<double> bufs[4];
+        int ptrs[4] = { 0, 0, 0, 0 };
+        for (int k = 0; k < 4; ++k)
+            bufs[k].assign ((size_t) (int) std::round (sr * delaysSec[k]), 0.0);
+
+        std::vector<double> wet ((size_t) irLen, 0.0);
+        for (int i = dryEnd; i < irLen; ++i)
+        {
+            double s = raw[(size_t) i];
+            for (int k = 0; k < 4; ++k)
+            {
+                const int d = (int) bufs[k].size();
+                double delayed = bufs[k][(size_t) ptrs[k]];
+                double w = s + g * delayed;
+                bufs[k][(size_t) ptrs[k]] = w;
+                ptrs[k] = (ptrs[k] + 1) % d;
+                s = -g * w + delayed;
+            }
+            wet[(size_t) i] = s;
+        }
+        for (int i = dryEnd; i < wetStart && i < irLen; ++i)
+        {
+            const double t = (double) (i - dryEnd) / (double) fadeLen;
+            raw[(size_t) i] = raw[(size_t) i] * (1.0 - t) + wet[(size_t) i] * t;
+        }
+        for (int i = wetStart; i < irLen; ++i)
+            raw[(size_t) i] = wet[(size_t) i];
+    }
+    return raw;
+}
+
+TEST_CASE("IR_51: sparse renderCh matches the dense band-buffer render", "[engine][render]")
+{
+    const int sr = 48000;
+    const int irLen = 2 * sr;
+    const int refsEnd = (int) (0.6 * sr);
+
+    uint32_t seed = 777u;
+    auto uni = [&seed] (double lo, double hi)
+    {
+        seed = seed * 1664525u + 1013904223u;
+        return lo + (hi - lo) * (double) (seed >> 8) / 16777216.0;
+    };
+
+    // Reflections up to 0.6 s (plus a few past irLen), then silence: the
+    // sparse render skips the silent tail once every band has rung out.
+    std::vector<IRSynthEngine::Ref> refs;
+    for (int i = 0; i < 4000; ++i)
+    {
+        IRSynthEngine::Ref r;
+        r.t = (int) uni (1.0, refsEnd);
+        for (auto& a : r.amps) a = uni (-1.0, 1.0) / (1.0 + r.t / 4800.0);
+        r.az = uni (-3.14159, 3.14159);
+        refs.push_back (r);
+    }
+    for (int i = 0; i < 8; ++i)
+        refs.push_back ({ irLen + i * 10, refs[(size_t) i].amps, 0.3 });
+
+    struct Case { const char* name; double diffusion, spreadMs, scatterMs; };
+    const Case cases[] = {
+        { "scatter + diffusion", 0.5, 0.0, 1.5 },
+        { "plain",               0.0, 0.0, 0.0 },
+        { "spread",              0.3, 2.0, 0.0 },
+    };
+    for (const auto& c : cases)
+    {
+        INFO (c.name);
+        const auto dense  = denseRenderChReference (refs, irLen, 0.7, sr, c.diffusion, c.spreadMs, c.scatterMs);
+        const auto sparse = IRSynthEngine::renderCh (refs, irLen, 0.7, sr, c.diffusion, c.spreadMs, c.scatterMs);
+        REQUIRE (sparse.size() == dense.size());
+
+        double peak = 0.0;
+        for (double v : dense) peak = std::max (peak, std::abs (v));
+        REQUIRE (peak > 0.0);
+
+        // A chunk is only skipped once its band's state is below kSilentState
+        // (1e-30), so the whole IR matches to well under that, including past
+        // the reflections (refsEnd).
+        double maxDiff = 0.0;
+        for (size_t i = 0; i < dense.size(); ++i)
+            maxDiff = std::max (maxDiff, std::abs (sparse[i] - dense[i]));
+        REQUIRE (maxDiff < 1e-27);
+    }
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// IR_59 — sparse renderCh stops filtering once the bands have rung out
+// ─────────────────────────────────────────────────────────────────────────────
+// The band biquads settle into a subnormal limit cycle rather than exact
+// zero, so a skip on "state == 0" never fires and every band filters to the
+// end of the IR. With reflections only in the first 0.6 s, the number of
+// band × chunk blocks actually filtered must not depend on irLen, and must
+// stay within the reflection span plus the slowest band's ring-out.
+TEST_CASE("IR_59: sparse renderCh cost follows the reflection span, not irLen", "[engine][render]")
+{
+    const int sr = 48000;
+    const int refsEnd = (int) (0.6 * sr);
+
+    uint32_t seed = 59u;
+    auto uni = [&seed] (double lo, double hi)
+    {
+        seed = seed * 1664525u + 1013904223u;
+        return lo + (hi - lo) * (double) (seed >> 8) / 16777216.0;
+    };
+    std::vector<IRSynthEngine::Ref> refs;
+    for (int i = 0; i < 4000; ++i)
+    {
+        IRSynthEngine::Ref r;
+        r.t = (int) uni (1.0, refsEnd);
+        for (auto& a : r.amps) a = uni (-1.0, 1.0) / (1.0 + r.t / 4800.0);
+        r.az = uni (-3.14159, 3.14159);
+        refs.push_back (r);
+    }
+
+    // 8 bands × chunks up to 0.6 s + 1 s of ring-out (4096-sample chunks).
+    const int bound = 8 * ((refsEnd + sr + 4095) / 4096);
+    for (double diffusion : { 0.0, 0.5 })
+    {
+        INFO ("diffusion " << diffusion);
+        int shortCount = -1, longCount = -1;
+        IRSynthEngine::renderCh (refs, 2 * sr,  0.7, sr, diffusion, 0.0, 1.5, nullptr, &shortCount);
+        IRSynthEngine::renderCh (refs, 30 * sr, 0.7, sr, diffusion, 0.0, 1.5, nullptr, &longCount);
+        REQUIRE (shortCount > 0);
+        REQUIRE (longCount == shortCount);
+        REQUIRE (longCount <= bound);
+    }
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// IR_60 — lattice-split calcRefs reproduces the single-pass enumeration
+// ─────────────────────────────────────────────────────────────────────────────
+// calcRefs builds the speaker's ImageLattice (image coordinates, hash-keyed
+// jitter, power tables) and then runs the receiver pass. The digests below
+// were recorded from the single-pass calcRefs it replaced, over every
+// reflection's arrival sample, band amplitudes and azimuth (FNV-1a over the
+// raw bytes). Room proportions cover a small room, a hall, a corridor and a
+// cube, each full / ER-only and with jitter off / on (ts, order jitter, mic
+// tilt), so the lattice bounds, the ER-only slab skip and the jitter shifts
+// are all exercised.
+TEST_CASE("IR_60: lattice-split calcRefs matches the single-pass reflection set", "[engine][refs]")
+{
+    struct Case { double W, D, H; bool eo, jitter; size_t count; const char* digest; };
+    const Case cases[] = {
+        { 10,  8,  4, false, false, 4913, "419e9988c7d14f21" },
+        { 10,  8,  4, false, true,  5037, "5815cfb8320e998d" },
+        { 10,  8,  4, true,  false,  320, "d6131361d413164f" },
+        { 10,  8,  4, true,  true,   434, "4951ba9b741e4acb" },
+        { 30, 18, 12, false, false, 4913, "344735127e170ee7" },
+        { 30, 18, 12, false, true,  5037, "04f4e7670787f050" },
+        { 30, 18, 12, true,  false,   15, "e2b6da86909bb4e7" },
+        { 30, 18, 12, true,  true,    36, "0eda4610f2ae24b0" },
+        {  6, 25,  3, false, false, 4913, "67b902e49e9a65e8" },
+        {  6, 25,  3, false, true,  5037, "2aa862c35be93bbb" },
+        {  6, 25,  3, true,  false,  193, "7c01d808a7b3e798" },
+        {  6, 25,  3, true,  true,   286, "57b0f9e04a89927d" },
+        { 12, 12, 12, false, false, 4913, "325100ec8d9fd4ec" },
+        { 12, 12, 12, false, true,  5037, "49bc1b69b5b364d2" },
+        { 12, 12, 12, true,  false,   59, "fc6a70e596bbdfb9" },
+        { 12, 12, 12, true,  true,   143, "21f65baeb950cd28" },
+    };
+
+    auto fnv = [] (uint64_t h, const void* data, size_t n)
+    {
+        const auto* b = static_cast<const unsigned char*> (data);
+        for (size_t i = 0; i < n; ++i)
+            h = (h ^ b[i]) * 0x100000001b3ull;
+        return h;
+    };
+
+    const int sr = 48000, mo = 8, ec = (int) (0.085 * sr);
+    std::array<double, 8> rF, rC, rW;
+    for (int b = 0; b < 8; ++b)
+    {
+        rF[(size_t) b] = 0.9 - 0.04 * b;
+        rC[(size_t) b] = 0.85 - 0.05 * b;
+        rW[(size_t) b] = 0.8 - 0.03 * b;
+    }
+
+    for (const auto& c : cases)
+    {
+        INFO ("room " << c.W << " x " << c.D << " x " << c.H << (c.eo ? " ER-only" : " full")
+                      << (c.jitter ? " jitter" : ""));
+        IRSynthParams p;
+        p.width = c.W;  p.depth = c.D;  p.height = c.H;
+        const auto refs = IRSynthEngine::calcRefs (
+            c.W * 0.3, c.D * 0.7, std::min (3.0, c.H * 0.9),
+            c.W * 0.6, c.D * 0.2, std::min (1.0, c.H * 0.9),
+            p, c.H, mo, rF, rC, rW, 0.92, 0.2, c.jitter ? 0.4 : 0.0, c.eo, ec, sr, 42u,
+            "cardioid (LDC)", 0.3, 2.5, 1e9,
+            c.jitter ? 0.5 : 0.0, c.jitter ? 1.5 : 0.0, c.jitter ? -0.3 : 0.0, 0.0);
+
+        uint64_t h = 0xcbf29ce484222325ull;
+        for (const auto& r : refs)
+        {
+            const int64_t t = r.t;
+            h = fnv (h, &t, sizeof (t));
+            h = fnv (h, r.amps.data(), sizeof (r.amps));
+            h = fnv (h, &r.az, sizeof (r.az));
+        }
+        char hex[17];
+        std::snprintf (hex, sizeof (hex), "%016llx", (unsigned long long) h);
+
+        CHECK (refs.size() == c.count);
+        CHECK (std::string (hex) == c.digest);
+    }
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// TEST_IR_52 — Vectorised FDN core vs the reference renderFDNTail loop
+// ─────────────────────────────────────────────────────────────────────────────
+// fdn_vectorised swaps the per-line loop (std::sin LFO, modulo reads,
+// std::vector Hadamard) for FdnKernel::Lines16. The two are not
+// bit-identical — recursive LFO, 0.25·x₀ output tap — so bound what a
+// listener would hear: the Schroeder decay curve and the energy of the
+// difference signal per octave band. Both LFO phase sets (seed 100 / 101)
+// and a polygon room are covered.
+TEST_CASE("IR_52: vectorised FDN tail matches the reference decay and spectrum", "[engine][fdn][simd]")
+{
+    const int sr = 48000;
+    const int irLen = 3 * sr;
+    const int erCut = (int) (0.085 * sr);
+    const int maxRefCut = (int) (0.4 * sr);
+    const std::vector<double> rt60s { 2.4, 2.3, 2.1, 1.9, 1.7, 1.4, 1.1, 0.7 };
+
+    TestRng rng (52u);
+    std::vector<double> erIR ((size_t) maxRefCut);
+    for (int i = 0; i < maxRefCut; ++i)
+        erIR[(size_t) i] = (rng.next() * 2.0 - 1.0) * std::exp (-6.9 * i / (0.8 * sr));
+
+    // Octave band energy (RBJ constant-peak band-pass, Q = √2).
+    auto bandEnergy = [sr] (const std::vector<double>& x, double fc)
+    {
+        const double w0 = 2.0 * 3.141592653589793 * fc / sr;
+        const double al = std::sin (w0) / (2.0 * 1.4142135623730951);
+        const double a0 = 1.0 + al;
+        const double b0 = al / a0, b2 = -al / a0;
+        const double a1 = -2.0 * std::cos (w0) / a0, a2 = (1.0 - al) / a0;
+        double x1 = 0.0, x2 = 0.0, y1 = 0.0, y2 = 0.0, e = 0.0;
+        for (double v : x)
+        {
+            const double y = b0 * v + b2 * x2 - a1 * y1 - a2 * y2;
+            x2 = x1; x1 = v; y2 = y1; y1 = y;
+            e += y * y;
+        }
+        return e;
+    };
+
+    struct Case { const char* name; uint32_t seed; const char* shape; double diffusion; };
+    const Case cases[] = {
+        { "rectangular, seed 100", 100u, "Rectangular", 0.5 },
+        { "rectangular, seed 101", 101u, "Rectangular", 0.0 },
+        { "cathedral, seed 158",   158u, "Cathedral",   0.7 },
+    };
+    for (const auto& c : cases)
+    {
+        INFO (c.name << " (" << FdnKernel::isaName() << ")");
+        IRSynthParams p;
+        p.shape = c.shape;
+        const auto ref = IRSynthEngine::renderFDNTail (rt60s, irLen, erCut, erIR, c.diffusion, sr, c.seed,
+                                                       22.0, 15.0, 9.0, maxRefCut, &p);
+        p.fdn_vectorised = true;
+        const auto vec = IRSynthEngine::renderFDNTail (rt60s, irLen, erCut, erIR, c.diffusion, sr, c.seed,
+                                                       22.0, 15.0, 9.0, maxRefCut, &p);
+        REQUIRE (vec.size() == ref.size());
+        REQUIRE_FALSE (hasNaNorInf (vec));
+
+        // Schroeder energy decay curves agree to 0.01 dB down to −60 dB.
+        std::vector<double> edcRef (ref.size() + 1, 0.0), edcVec (vec.size() + 1, 0.0);
+        for (size_t i = ref.size(); i-- > 0;)
+        {
+            edcRef[i] = edcRef[i + 1] + ref[i] * ref[i];
+            edcVec[i] = edcVec[i + 1] + vec[i] * vec[i];
+        }
+        REQUIRE (edcRef[(size_t) erCut] > 0.0);
+        double maxEdcDb = 0.0;
+        for (size_t i = (size_t) erCut; i < ref.size(); i += (size_t) (sr / 100))
+        {
+            if (edcRef[i] < edcRef[(size_t) erCut] * 1e-6)
+                break;
+            maxEdcDb = std::max (maxEdcDb, std::abs (10.0 * std::log10 (edcVec[i] / edcRef[i])));
+        }
+        CHECK (maxEdcDb <= 0.01);
+
+        // Per octave band, the difference carries < −100 dB of the reference energy.
+        std::vector<double> diff (ref.size());
+        for (size_t i = 0; i < ref.size(); ++i)
+            diff[i] = vec[i] - ref[i];
+        for (double fc : { 125.0, 250.0, 500.0, 1000.0, 2000.0, 4000.0, 8000.0, 16000.0 })
+        {
+            INFO ("band " << fc << " Hz");
+            CHECK (bandEnergy (diff, fc) <= 1e-10 * bandEnergy (ref, fc));
+        }
+    }
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// TEST_IR_53 — Live FDN tail vs the convolved tail (A/B energy decay)
+// ─────────────────────────────────────────────────────────────────────────────
+// Live-tail mode replaces the tail convolution with LiveFdnTail running
+// designPathFDN's networks on the audio. Build the tail kernels exactly as
+// PingProcessor::loadIRFromBuffer does (IR from 85 ms, 20 ms fade-in),
+// calibrate against them, and compare Schroeder decay curves of the live
+// impulse response and the kernel: T20 within 10 % and the curves within
+// 2.5 dB down to −30 dB, for both output sides. With an onset delay the live
+// tail must stay silent until the crossover and keep its level after it.
+TEST_CASE("IR_53: live FDN tail matches the convolved tail's energy decay", "[engine][fdn][live]")
+{
+    IRSynthParams octagon = smallRoomParams();
+    octagon.shape  = "Octagonal";
+    octagon.width  = 16.0;
+    octagon.depth  = 12.0;
+    octagon.height =  7.0;
+    const IRSynthParams rooms[] = { smallRoomParams(), octagon };
+
+    for (const auto& p : rooms)
+    {
+        INFO (p.shape << " " << p.width << " x " << p.depth << " x " << p.height);
+        auto r = IRSynthEngine::synthIR (p, [](double, const std::string&) {});
+        REQUIRE (r.success);
+        const int sr = r.sampleRate;
+        const int crossover = (int) (0.085 * sr);
+        const int fade = (int) (0.020 * sr);
+        REQUIRE (r.irLen > crossover + sr);
+
+        auto tailKernel = [&] (const std::vector<double>& ir)
+        {
+            std::vector<float> k ((size_t) (r.irLen - crossover));
+            for (size_t i = 0; i < k.size(); ++i)
+                k[i] = (float) (ir[i + (size_t) crossover] * std::min (1.0, (double) i / fade));
+            return k;
+        };
+        const std::vector<float> ref[2] = { tailKernel (r.iLL), tailKernel (r.iLR) };
+
+        LiveFdnTail live;
+        LiveFdnTail::Design d;
+        d.lines = IRSynthEngine::designPathFDN (p, IRSynthEngine::TailPath::Main, sr);
+        d.designRate = sr;
+        d.diffusion = p.diffusion;
+        live.prepare (d);
+        live.calibrate (ref[0].data(), (int) ref[0].size(), ref[1].data(), (int) ref[1].size(), sr);
+        const auto h = live.impulseResponse ((int) ref[0].size());
+
+        // On the audio the live tail starts at the crossover, where the
+        // convolved Tail kernel is placed.
+        {
+            LiveFdnTail delayed;
+            d.onsetSamples = crossover;
+            delayed.prepare (d);
+            const auto gains = live.getOutputGains();
+            delayed.setOutputGains (gains[0], gains[1]);
+            const int len = crossover + sr / 10;
+            std::vector<float> inL ((size_t) len, 0.0f), inR ((size_t) len, 0.0f);
+            std::vector<float> outL ((size_t) len, 0.0f), outR ((size_t) len, 0.0f);
+            inL[0] = 1.0f;
+            delayed.process (inL.data(), inR.data(), outL.data(), outR.data(), len);
+            for (int i = 0; i < crossover; ++i)
+                REQUIRE (outL[(size_t) i] == 0.0f);
+            // The line LFOs have run on through the onset, so the delayed
+            // response is the same network at another modulation phase:
+            // compare its energy, not its samples.
+            double eDelayed = 0.0, eLive = 0.0;
+            for (int i = 0; i < sr / 10; ++i)
+            {
+                eDelayed += (double) outL[(size_t) (crossover + i)] * outL[(size_t) (crossover + i)];
+                eLive    += h[0][(size_t) i] * h[0][(size_t) i];
+            }
+            CHECK (std::abs (10.0 * std::log10 (eDelayed / eLive)) < 1.0);
+        }
+
+        for (size_t s = 0; s < 2; ++s)
+        {
+            INFO ((s == 0 ? "left" : "right") << " side");
+            REQUIRE_FALSE (hasNaNorInf (h[s]));
+            const size_t n = ref[s].size();
+            std::vector<double> edcRef (n + 1, 0.0), edcLive (n + 1, 0.0);
+            for (size_t i = n; i-- > 0;)
+            {
+                edcRef[i]  = edcRef[i + 1]  + (double) ref[s][i] * (double) ref[s][i];
+                edcLive[i] = edcLive[i + 1] + h[s][i] * h[s][i];
+            }
+            REQUIRE (edcRef[0] > 0.0);
+
+            // Both curves relative to the kernel's total energy.
+            auto db = [&] (const std::vector<double>& edc, size_t i) { return 10.0 * std::log10 (edc[i] / edcRef[0]); };
+            auto crossing = [&] (const std::vector<double>& edc, double level)
+            {
+                for (size_t i = 0; i < n; ++i)
+                    if (db (edc, i) < level)
+                        return (double) i / sr;
+                return (double) n / sr;
+            };
+            const double t20Ref  = 3.0 * (crossing (edcRef,  -25.0) - crossing (edcRef,  -5.0));
+            const double t20Live = 3.0 * (crossing (edcLive, -25.0) - crossing (edcLive, -5.0));
+            INFO ("T20 convolved " << t20Ref << " s, live " << t20Live << " s");
+            CHECK (t20Live == Catch::Approx (t20Ref).epsilon (0.10));
+
+            double maxDevDb = 0.0;
+            for (size_t i = 0; i < n; i += (size_t) (sr / 100))
+            {
+                if (db (edcRef, i) < -30.0)
+                    break;
+                maxDevDb = std::max (maxDevDb, std::abs (db (edcLive, i) - db (edcRef, i)));
+            }
+            CHECK (maxDevDb <= 2.5);
+        }
+    }
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// TEST_IR_54 — Fused modal bank vs the per-mode, per-channel biquad loop
+// ─────────────────────────────────────────────────────────────────────────────
+// applyModalBank runs every resonator on all four channels in one
+// ModalBankKernel pass. The reference below is the loop it replaced: one
+// full-length band-pass per mode per channel, summed in mode order. Same
+// arithmetic in the same order, so the two agree to rounding (bit for bit
+// unless the compiler contracts the scalar loop into FMAs). Covers the axial
+// bank, the tangential + oblique set, and a length that is not a whole
+// number of kernel blocks.
+TEST_CASE("IR_54: fused modal bank matches the per-channel resonator loop", "[engine][modal][simd]")
+{
+    INFO ("kernel ISA: " << ModalBankKernel::isaName());
+    const int sr = 48000;
+    const int n  = sr + 37;
+    const double W = 10.0, D = 8.0, He = 5.0, rt125 = 1.8, gain = 0.18;
+
+    TestRng rng (54u);
+    std::array<std::vector<double>, 4> in;
+    for (auto& ch : in)
+    {
+        ch.resize ((size_t) n);
+        for (int i = 0; i < n; ++i)
+            ch[(size_t) i] = (rng.next() * 2.0 - 1.0) * std::exp (-6.9 * i / (0.6 * sr));
+    }
+
+    auto reference = [&] (const std::vector<double>& x, bool tangentialOblique)
+    {
+        const auto modes = IRSynthEngine::roomModes (W, D, He, tangentialOblique);
+        std::vector<double> modal (x.size(), 0.0);
+        double totalWeight = 0.0;
+        for (const auto& m : modes)
+        {
+            const double Q = std::clamp (3.141592653589793 * m.fc * rt125 / 6.908, 8.0, 80.0);
+            const double modeGain = gain * std::min (60.0 / m.fc, 2.0) * m.weight;
+            const double K = std::tan (3.141592653589793 * m.fc / (double) sr);
+            const double nrm = 1.0 / (1.0 + K / Q + K * K);
+            const double b0 = K / Q * nrm, b2 = -b0;
+            const double a1 = 2.0 * (K * K - 1.0) * nrm;
+            const double a2 = (1.0 - K / Q + K * K) * nrm;
+            double x1 = 0.0, x2 = 0.0, y1 = 0.0, y2 = 0.0;
+            for (size_t i = 0; i < x.size(); ++i)
+            {
+                const double y = b0 * x[i] + b2 * x2 - a1 * y1 - a2 * y2;
+                x2 = x1; x1 = x[i]; y2 = y1; y1 = y;
+                modal[i] += y * modeGain;
+            }
+            totalWeight += m.weight;
+        }
+        std::vector<double> out (x.size());
+        for (size_t i = 0; i < x.size(); ++i)
+            out[i] = x[i] + modal[i] * (1.0 / totalWeight);
+        return out;
+    };
+
+    for (bool tangentialOblique : { false, true })
+    {
+        INFO ("tangentialOblique = " << tangentialOblique);
+        auto fused = in;
+        IRSynthEngine::applyModalBank (fused[0], fused[1], fused[2], fused[3], W, D, He,
+                                       rt125, gain, sr, "Rectangular", 0.0, tangentialOblique);
+        for (size_t c = 0; c < 4; ++c)
+        {
+            INFO ("channel " << c);
+            const auto ref = reference (in[c], tangentialOblique);
+            double peak = 0.0, maxErr = 0.0, change = 0.0;
+            for (size_t i = 0; i < ref.size(); ++i)
+            {
+                peak   = std::max (peak, std::abs (ref[i]));
+                maxErr = std::max (maxErr, std::abs (fused[c][i] - ref[i]));
+                change = std::max (change, std::abs (ref[i] - in[c][i]));
+            }
+            CHECK (change > 1e-6 * peak);   // the bank did something
+            CHECK (maxErr <= 1e-12 * peak);
+        }
+    }
+
+    // Mode set: the axial modes first and unchanged, then tangential (√½)
+    // and oblique (½) modes, everything inside (10, 250) Hz.
+    const auto axial = IRSynthEngine::roomModes (W, D, He, false);
+    const auto all   = IRSynthEngine::roomModes (W, D, He, true);
+    REQUIRE (all.size() > axial.size());
+    int numTangential = 0, numOblique = 0;
+    for (size_t i = 0; i < all.size(); ++i)
+    {
+        CHECK (all[i].fc > 10.0);
+        CHECK (all[i].fc < 250.0);
+        if (i < axial.size())
+        {
+            CHECK (all[i].fc == axial[i].fc);
+            CHECK (all[i].weight == 1.0);
+        }
+        else if (all[i].weight == 0.5)
+            ++numOblique;
+        else
+        {
+            CHECK (all[i].weight == Catch::Approx (std::sqrt (0.5)));
+            ++numTangential;
+        }
+    }
+    CHECK (numTangential > 0);
+    CHECK (numOblique > 0);
+
+    // Polygon rooms without an area are left untouched.
+    auto poly = in;
+    IRSynthEngine::applyModalBank (poly[0], poly[1], poly[2], poly[3], W, D, He,
+                                   rt125, gain, sr, "Octagonal", 0.0, true);
+    for (size_t c = 0; c < 4; ++c)
+        CHECK (poly[c] == in[c]);
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// TEST_IR_55 — synthIR<float> vs synthIR<double>
+// ─────────────────────────────────────────────────────────────────────────────
+// The float pipeline keeps every recursion, gain and envelope in double and
+// only rounds buffers as they are stored, so its IR is the double IR plus
+// accumulated rounding noise (about −145 dB). Per channel of every
+// synthesised path: RMS difference below −120 dB and peak difference below
+// −110 dB of the double channel's level, and Schroeder decay curves within
+// 0.001 dB down to −60 dB.
+// Also pins the result metadata (length, trim) and that the float IR holds
+// half the bytes.
+TEST_CASE("IR_55: float synthesis stays within bounds of the double engine", "[engine][float]")
+{
+    IRSynthParams withPaths = smallRoomParams();
+    withPaths.outrig_enabled = withPaths.ambient_enabled = withPaths.direct_enabled = true;
+    const IRSynthParams cases[] = { smallRoomParams(), withPaths };
+
+    auto compare = [] (const std::vector<double>& ref, const std::vector<float>& f)
+    {
+        REQUIRE (f.size() == ref.size());
+        REQUIRE_FALSE (hasNaNorInfF (f));
+        double eRef = 0.0, eDiff = 0.0, pkRef = 0.0, pkDiff = 0.0;
+        for (size_t i = 0; i < ref.size(); ++i)
+        {
+            const double d = (double) f[i] - ref[i];
+            eRef  += ref[i] * ref[i];
+            eDiff += d * d;
+            pkRef  = std::max (pkRef, std::abs (ref[i]));
+            pkDiff = std::max (pkDiff, std::abs (d));
+        }
+        REQUIRE (eRef > 0.0);
+        INFO ("RMS diff " << 10.0 * std::log10 (std::max (eDiff, 1e-300) / eRef) << " dB, peak diff "
+              << 20.0 * std::log10 (std::max (pkDiff, 1e-300) / pkRef) << " dB");
+        CHECK (eDiff <= 1e-12 * eRef);
+        CHECK (pkDiff <= 3.2e-6 * pkRef);
+
+        std::vector<double> edcRef (ref.size() + 1, 0.0), edcF (ref.size() + 1, 0.0);
+        for (size_t i = ref.size(); i-- > 0;)
+        {
+            edcRef[i] = edcRef[i + 1] + ref[i] * ref[i];
+            edcF[i]   = edcF[i + 1] + (double) f[i] * (double) f[i];
+        }
+        double maxEdcDb = 0.0;
+        for (size_t i = 0; i < ref.size(); i += 480)
+        {
+            if (edcRef[i] < edcRef[0] * 1e-6)
+                break;
+            maxEdcDb = std::max (maxEdcDb, std::abs (10.0 * std::log10 (edcF[i] / edcRef[i])));
+        }
+        CHECK (maxEdcDb <= 0.001);
+    };
+
+    for (const auto& p : cases)
+    {
+        INFO ((p.outrig_enabled ? "all paths" : "main only"));
+        const auto rd = IRSynthEngine::synthIR<double> (p, [](double, const std::string&) {});
+        const auto rf = IRSynthEngine::synthIR<float>  (p, [](double, const std::string&) {});
+        REQUIRE (rd.success);
+        REQUIRE (rf.success);
+        CHECK (rf.irLen == rd.irLen);
+        CHECK (rf.sampleRate == rd.sampleRate);
+        CHECK (rf.applied_gain_db == Catch::Approx (rd.applied_gain_db).margin (1e-4));
+        CHECK (rf.iLL.size() * sizeof (rf.iLL[0]) * 2 == rd.iLL.size() * sizeof (rd.iLL[0]));
+
+        { INFO ("main LL"); compare (rd.iLL, rf.iLL); }
+        { INFO ("main RL"); compare (rd.iRL, rf.iRL); }
+        { INFO ("main LR"); compare (rd.iLR, rf.iLR); }
+        { INFO ("main RR"); compare (rd.iRR, rf.iRR); }
+
+        const std::pair<const MicIRChannels*, const MicIRChannelsF*> paths[] = {
+            { &rd.direct, &rf.direct }, { &rd.outrig, &rf.outrig }, { &rd.ambient, &rf.ambient } };
+        for (const auto& [d, f] : paths)
+        {
+            REQUIRE (f->synthesised == d->synthesised);
+            if (! d->synthesised)
+                continue;
+            INFO ("path of " << d->irLen << " samples");
+            compare (d->LL, f->LL);
+            compare (d->RL, f->RL);
+            compare (d->LR, f->LR);
+            compare (d->RR, f->RR);
+        }
+    }
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// TEST_IR_57 — per-stage synthesis profile
+// ─────────────────────────────────────────────────────────────────────────────
+// IRSynthResult::profile lists MAIN's stages in order, then each enabled
+// extra path, with counts that follow from the IR: both FDN tails run irLen
+// samples, refs finds image sources, polygon rooms report accepted nodes.
+// A warm stage cache collapses each path to a single "cached" stage.
+TEST_CASE("IR_57: synthIR reports a per-stage profile", "[engine][profile]")
+{
+    IRSynthParams p = smallRoomParams();
+    const auto r = IRSynthEngine::synthIR (p, nullptr);
+    REQUIRE (r.success);
+    const SynthProfile& prof = r.profile;
+
+    const char* mainStages[] = { "lattice", "refs", "render", "seed", "fdn", "mix", "modal", "output" };
+    REQUIRE (prof.stages.size() == std::size (mainStages));
+    for (size_t i = 0; i < std::size (mainStages); ++i)
+    {
+        INFO ("stage " << mainStages[i]);
+        CHECK (prof.stages[i].path == "main");
+        CHECK (prof.stages[i].stage == mainStages[i]);
+        CHECK (prof.stages[i].wallMs >= 0.0);
+        CHECK (prof.stages[i].cpuMs >= 0.0);
+        CHECK (prof.stages[i].wallMs <= prof.totalWallMs);
+        CHECK (prof.stages[i].peakBytes > 0);
+    }
+    CHECK (prof.find ("main", "lattice")->items > 0);
+    CHECK (prof.find ("main", "refs")->items > 0);
+    CHECK (prof.find ("main", "render")->items == prof.find ("main", "refs")->items);
+    CHECK (prof.find ("main", "fdn")->items == 2 * (size_t) r.irLen);
+    CHECK (prof.find ("main", "output")->items == (size_t) r.irLen);
+    CHECK (prof.find ("main", "cached") == nullptr);
+
+    const std::string json = prof.toJson();
+    CHECK (json.find ("\"totalWallMs\":") != std::string::npos);
+    CHECK (json.find ("\"stage\":\"fdn\"") != std::string::npos);
+
+    SECTION ("ER-only mode has no FDN stage")
+    {
+        IRSynthParams eo = p;
+        eo.er_only = true;
+        const auto re = IRSynthEngine::synthIR (eo, nullptr);
+        REQUIRE (re.success);
+        CHECK (re.profile.find ("main", "fdn") == nullptr);
+        CHECK (re.profile.find ("main", "mix") != nullptr);
+    }
+
+    SECTION ("polygon rooms count accepted image-source nodes")
+    {
+        IRSynthParams poly = p;
+        poly.shape = "Octagonal";
+        const auto rp = IRSynthEngine::synthIR (poly, nullptr);
+        REQUIRE (rp.success);
+        REQUIRE (rp.profile.find ("main", "refs") != nullptr);
+        CHECK (rp.profile.find ("main", "refs")->nodes > 0);
+        CHECK (rp.profile.find ("main", "lattice") == nullptr);
+    }
+
+    SECTION ("extra paths follow MAIN")
+    {
+        IRSynthParams all = p;
+        all.outrig_enabled = all.ambient_enabled = all.direct_enabled = true;
+        const auto ra = IRSynthEngine::synthIR (all, nullptr);
+        REQUIRE (ra.success);
+        for (const char* path : { "outrig", "ambient" })
+        {
+            INFO ("path " << path);
+            REQUIRE (ra.profile.find (path, "refs") != nullptr);
+            CHECK (ra.profile.find (path, "refs")->items > 0);
+            CHECK (ra.profile.find (path, "fdn")->items == 2 * (size_t) ra.outrig.irLen);
+            CHECK (ra.profile.find (path, "output") != nullptr);
+        }
+        REQUIRE (ra.profile.find ("direct", "direct") != nullptr);
+        CHECK (ra.profile.find ("direct", "direct")->items > 0);
+        CHECK (ra.profile.stages.back().path == "direct");
+    }
+
+    SECTION ("a warm stage cache reports cached paths")
+    {
+        struct CacheOn
+        {
+            CacheOn()  { SynthStageCache::shared().setBudgetBytes (SynthStageCache::kInteractiveBudgetBytes); }
+            ~CacheOn() { SynthStageCache::shared().setBudgetBytes (0); }
+        };
+        CacheOn cacheOn;
+        IRSynthParams withOutrig = p;
+        withOutrig.outrig_enabled = true;
+        (void) IRSynthEngine::synthIR (withOutrig, nullptr);
+        const auto warm = IRSynthEngine::synthIR (withOutrig, nullptr);
+        REQUIRE (warm.success);
+        REQUIRE (warm.profile.stages.size() == 2);
+        CHECK (warm.profile.find ("main", "cached")->cacheHits == 1);
+        CHECK (warm.profile.find ("outrig", "cached")->cacheHits == 1);
+        CHECK (warm.profile.find ("main", "cached")->peakBytes == 4 * (size_t) warm.irLen * sizeof (double));
+    }
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// IR_58 — DecodedIRCache keys, LRU and budget
+// ─────────────────────────────────────────────────────────────────────────────
+// A rewritten file (new mtime or size) must miss; a held entry outlives its
+// eviction; a zero budget disables the cache.
+TEST_CASE("IR_58: DecodedIRCache keys on path, mtime and size and evicts LRU", "[engine][cache]")
+{
+    using IR = DecodedIRCache::DecodedIR;
+    auto decoded = [] (int numChannels, int numSamples, float v)
+    {
+        auto ir = std::make_shared<IR>();
+        ir->sampleRate = 48000.0;
+        ir->numChannels = numChannels;
+        ir->numSamples = numSamples;
+        ir->samples.assign ((size_t) numChannels * (size_t) numSamples, v);
+        ir->channel (numChannels - 1)[0] = -v;
+        return std::shared_ptr<const IR> (std::move (ir));
+    };
+    const size_t bytes = 4 * 16 * sizeof (float);
+
+    const auto hall    = DecodedIRCache::makeKey ("/IRs/Hall.wav", 1000, 4096);
+    const auto touched = DecodedIRCache::makeKey ("/IRs/Hall.wav", 2000, 4096);
+    const auto resized = DecodedIRCache::makeKey ("/IRs/Hall.wav", 1000, 8192);
+    REQUIRE (hall != touched);
+    REQUIRE (hall != resized);
+
+    DecodedIRCache cache (3 * bytes);
+    cache.insert (hall, decoded (4, 16, 1.0f));
+    REQUIRE (cache.find (touched) == nullptr);
+    REQUIRE (cache.find (resized) == nullptr);
+    auto hit = cache.find (hall);
+    REQUIRE (hit != nullptr);
+    REQUIRE (hit->numChannels == 4);
+    REQUIRE (hit->channel (0)[5] == 1.0f);
+    REQUIRE (hit->channel (3)[0] == -1.0f);
+
+    const auto direct  = DecodedIRCache::makeKey ("/IRs/Hall_direct.wav", 1000, 4096);
+    const auto outrig  = DecodedIRCache::makeKey ("/IRs/Hall_outrig.wav", 1000, 4096);
+    const auto ambient = DecodedIRCache::makeKey ("/IRs/Hall_ambient.wav", 1000, 4096);
+    cache.insert (direct, decoded (4, 16, 2.0f));
+    cache.insert (outrig, decoded (4, 16, 3.0f));
+    REQUIRE (cache.find (hall) != nullptr);          // hall is now the most recent
+    cache.insert (ambient, decoded (4, 16, 4.0f));   // evicts direct
+    REQUIRE (cache.find (direct) == nullptr);
+    REQUIRE (cache.find (hall) != nullptr);
+    REQUIRE (cache.getStats().usedBytes == 3 * bytes);
+    REQUIRE (cache.getStats().evictions == 1);
+
+    // A file larger than the whole budget is not stored; a zero budget empties
+    // the cache while a held entry stays valid.
+    cache.insert (direct, decoded (4, 64, 2.0f));
+    REQUIRE (cache.find (direct) == nullptr);
+    cache.setBudgetBytes (0);
+    REQUIRE (cache.getStats().numEntries == 0);
+    REQUIRE (cache.find (hall) == nullptr);
+    REQUIRE (hit->channel (0)[5] == 1.0f);
+}
+
 // ─────────────────────────────────────────────────────────────────────────────
 // TEST_IR_GOLDEN_CAPTURE — Helper to print golden values
 // ─────────────────────────────────────────────────────────────────────────────
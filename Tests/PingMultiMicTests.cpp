@@ -136,13 +136,19 @@ TEST_CASE("IR_14: MAIN path full-IR bit-identity regression lock",
     // jitter realisation is different; irLen is unchanged because the FDN
     // and room geometry are untouched. IR_32 / IR_33 enforce the new
     // mirror-symmetry property.
+    //
+    // Updated for the sparse renderCh: a band filter whose state has decayed
+    // below BandpassBiquad::kSilentState (1e-30) is flushed to zero so the
+    // render can skip it. Every channel moves by far less than 1e-27 (IR_51
+    // holds the sparse render to the dense one), which still flips the
+    // digests; irLen is unchanged.
     static const int         golden_irLen = 813146;
-    static const std::string golden_iLL   = "d1b755224b398703";
-    static const std::string golden_iRL   = "9f435b9b8f0cfcb2";
-    static const std::string golden_iLR   = "765b28e78b21159d";
-    static const std::string golden_iRR   = "285158bd53c10787";
+    static const std::string golden_iLL   = "105e497f4739ae8b";
+    static const std::string golden_iRL   = "95fc8e492942a2ed";
+    static const std::string golden_iLR   = "01e8a9c83e72bd4a";
+    static const std::string golden_iRR   = "bd1a65bc222b6291";
 
-    static const bool goldenCaptured = true;   // recaptured for v2.10 mirror-symmetric ER jitter
+    static const bool goldenCaptured = true;   // recaptured for the sparse renderCh silence flush
     if (! goldenCaptured)
     {
         SUCCEED("IR_14 golden digests not yet captured — run [capture14] first.");
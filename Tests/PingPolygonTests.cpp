@@ -17,6 +17,12 @@
 //   IR_30   Circular Hall — full 16-gon (cornerCut=1) produces a
 //           different IR than the bounding rectangle.
 //   IR_31   makeWalls2D area / perimeter accuracy for known dimensions.
+//   IR_49   buildImageSources2D (flat arena) reproduces the original
+//           vector-copying image-source tree node for node.
+//   IR_50   Benchmark (hidden, run with "[benchmark]"): image-source tree
+//           node throughput, arena vs the original generator.
+//   IR_56   Beam pruning keeps the image-source set identical over a grid
+//           of source / receiver positions and cuts chain validations.
 //
 // All tests use small rooms (10×8×5 m) to keep individual runtime under a
 // few seconds. They never modify p.shape="Rectangular", so no existing
@@ -30,7 +36,9 @@
 #include "IRSynthEngine.h"
 #include "TestHelpers.h"
 #include <array>
+#include <chrono>
 #include <cmath>
+#include <cstdio>
 #include <string>
 #include <vector>
 
@@ -581,3 +589,295 @@ TEST_CASE("IR_31: makeWalls2D produces hand-calculable area/perimeter",
         }
     }
 }
+
+// ────────────────────────────────────────────────────────────────────────────
+// Reference image-source tree — the pre-arena generateIS2D, verbatim apart
+// from names. Every node deep-copies its wall path and image positions and
+// each child allocates fresh copies. IR_49 / IR_50 compare against it.
+// ────────────────────────────────────────────────────────────────────────────
+namespace
+{
+    struct RefImageSource2D
+    {
+        double x = 0.0, y = 0.0;
+        std::vector<int> wallPath;
+        std::array<double, 8> cumAbs {};
+        int order = 0;
+        std::vector<std::pair<double, double>> imgPositions;
+    };
+
+    bool refValidateChain2D (const std::vector<Wall2D>& walls,
+                             const RefImageSource2D& is, double rcvX, double rcvY)
+    {
+        double curX = rcvX, curY = rcvY;
+        for (int k = (int) is.wallPath.size() - 1; k >= 0; --k)
+        {
+            const Wall2D& w = walls[(size_t) is.wallPath[(size_t) k]];
+            const auto& tgt = is.imgPositions[(size_t) (k + 1)];
+            double t = 0.0, s = 0.0;
+            if (! IRSynthEngine::rayIntersectsSegment (curX, curY, tgt.first, tgt.second, w, t, s))
+                return false;
+            curX = curX + t * (tgt.first  - curX);
+            curY = curY + t * (tgt.second - curY);
+        }
+        return true;
+    }
+
+    void refGenerateIS2D (const std::vector<Wall2D>& walls,
+                          double imgX, double imgY,
+                          const std::vector<int>& wallPath,
+                          const std::vector<std::pair<double, double>>& imgPositions,
+                          const std::array<double, 8>& cumAbs,
+                          double rcvX, double rcvY,
+                          double maxDist2D, int maxOrder, size_t acceptedBudget,
+                          std::vector<RefImageSource2D>& out)
+    {
+        if (out.size() >= acceptedBudget)
+            return;
+        const double dx = imgX - rcvX, dy = imgY - rcvY;
+        if (std::sqrt (dx * dx + dy * dy) > maxDist2D)
+            return;
+
+        RefImageSource2D is;
+        is.x = imgX;
+        is.y = imgY;
+        is.wallPath = wallPath;
+        is.imgPositions = imgPositions;
+        is.cumAbs = cumAbs;
+        is.order = (int) wallPath.size();
+        if (is.order > 0 && ! refValidateChain2D (walls, is, rcvX, rcvY))
+            return;
+        out.push_back (std::move (is));
+
+        if ((int) wallPath.size() >= maxOrder)
+            return;
+
+        for (int wi = 0; wi < (int) walls.size(); ++wi)
+        {
+            if (! wallPath.empty() && wallPath.back() == wi)
+                continue;
+            const Wall2D& w = walls[(size_t) wi];
+            const double dot = (imgX - w.x1) * w.nx + (imgY - w.y1) * w.ny;
+            if (dot < -1e-6)
+                continue;
+
+            const auto refl = IRSynthEngine::reflect2D (imgX, imgY, w);
+            std::vector<int> newPath = wallPath;
+            newPath.push_back (wi);
+            std::vector<std::pair<double, double>> newPositions = imgPositions;
+            newPositions.emplace_back (refl.first, refl.second);
+            std::array<double, 8> newAbs;
+            for (int b = 0; b < 8; ++b)
+                newAbs[(size_t) b] = cumAbs[(size_t) b] * w.rAbs[(size_t) b];
+
+            refGenerateIS2D (walls, refl.first, refl.second, newPath, newPositions,
+                             newAbs, rcvX, rcvY, maxDist2D, maxOrder, acceptedBudget, out);
+        }
+    }
+
+    std::vector<RefImageSource2D> refBuildImageSources2D (const std::vector<Wall2D>& walls,
+                                                          double sx, double sy, double rx, double ry,
+                                                          int maxOrder, size_t budget)
+    {
+        std::vector<RefImageSource2D> out;
+        std::array<double, 8> initAbs;
+        initAbs.fill (1.0);
+        refGenerateIS2D (walls, sx, sy, {}, { { sx, sy } }, initAbs, rx, ry,
+                         1.0e9, maxOrder, budget, out);
+        return out;
+    }
+
+    // Cathedral (12-wall cruciform), Octagonal and Circular Hall (16 walls)
+    // at the engine's per-shape order caps and accepted-image budget
+    // (orderLimitForShape, kPolygonAcceptedBudget). Chain validation rejects
+    // most candidates, so the accepted trees are small; the work — and the
+    // copying the arena removes — is in the rejected candidates.
+    struct TreeCase
+    {
+        const char* shape;
+        double W, D;
+        int maxOrder;
+    };
+    constexpr TreeCase kTreeCases[] = {
+        { "Cathedral", 28.0, 60.0, 16 },
+        { "Octagonal", 20.0, 20.0, 14 },
+        { "Circular Hall", 28.0, 40.0, 12 },
+    };
+    constexpr size_t kTreeBudget = 20000;
+
+    std::vector<Wall2D> treeWalls (const TreeCase& c)
+    {
+        IRSynthParams p;
+        p.shape = c.shape;
+        p.width = c.W;
+        p.depth = c.D;
+        p.shapeCornerCut = 0.6;
+        std::array<double, 8> rW;
+        for (int b = 0; b < 8; ++b)
+            rW[(size_t) b] = 0.9 - 0.05 * b;
+        return IRSynthEngine::makeWalls2D (p, p.width, p.depth, rW);
+    }
+}
+
+// ────────────────────────────────────────────────────────────────────────────
+// IR_49 — arena image-source tree matches the original generator
+// ────────────────────────────────────────────────────────────────────────────
+TEST_CASE("IR_49: buildImageSources2D matches the reference image-source tree",
+          "[IR_49][polygon][image-source]")
+{
+    for (const auto& c : kTreeCases)
+    {
+        INFO ("shape = " << c.shape);
+        const auto walls = treeWalls (c);
+        const double sx = c.W * 0.5, sy = c.D * 0.3;
+        const double rx = c.W * 0.5 + 1.5, ry = c.D * 0.6;
+
+        const auto ref   = refBuildImageSources2D (walls, sx, sy, rx, ry, c.maxOrder, kTreeBudget);
+        const auto arena = IRSynthEngine::buildImageSources2D (walls, sx, sy, rx, ry, 1.0e9,
+                                                               c.maxOrder, kTreeBudget);
+        REQUIRE(ref.size() > 20u);
+        REQUIRE(arena.size() == ref.size());
+        REQUIRE(arena.size() <= kTreeBudget);
+
+        for (size_t i = 0; i < ref.size(); ++i)
+        {
+            const auto& a = arena[i];
+            REQUIRE(a.x == ref[i].x);
+            REQUIRE(a.y == ref[i].y);
+            REQUIRE(a.order == ref[i].order);
+            REQUIRE(a.cumAbs == ref[i].cumAbs);
+
+            // The parent chain spells the reference wall path, newest first.
+            int n = (int) i;
+            for (int k = ref[i].order - 1; k >= 0; --k)
+            {
+                REQUIRE(arena[(size_t) n].wall == ref[i].wallPath[(size_t) k]);
+                n = arena[(size_t) n].parent;
+                REQUIRE(n >= 0);
+                REQUIRE(n < (int) i);
+            }
+            REQUIRE(arena[(size_t) n].parent == -1);
+        }
+    }
+}
+
+// ────────────────────────────────────────────────────────────────────────────
+// IR_50 — image-source tree throughput benchmark (hidden)
+// ────────────────────────────────────────────────────────────────────────────
+// Prints accepted nodes per second (and the speed-up) for the original
+// vector-copying tree and the flat arena. Timing-only, so it is tagged [.] and never gates CI:
+//   ./PingTests "[benchmark]" -s
+TEST_CASE("IR_50: image-source tree node throughput, arena vs reference",
+          "[IR_50][polygon][benchmark][.]")
+{
+    using Clock = std::chrono::steady_clock;
+    constexpr int kRuns = 200;
+
+    for (const auto& c : kTreeCases)
+    {
+        const auto walls = treeWalls (c);
+        const double sx = c.W * 0.5, sy = c.D * 0.3;
+        const double rx = c.W * 0.5 + 1.5, ry = c.D * 0.6;
+
+        size_t refNodes = 0, arenaNodes = 0;
+        const auto t0 = Clock::now();
+        for (int r = 0; r < kRuns; ++r)
+            refNodes += refBuildImageSources2D (walls, sx, sy, rx, ry, c.maxOrder, kTreeBudget).size();
+        const auto t1 = Clock::now();
+        for (int r = 0; r < kRuns; ++r)
+            arenaNodes += IRSynthEngine::buildImageSources2D (walls, sx, sy, rx, ry, 1.0e9,
+                                                              c.maxOrder, kTreeBudget).size();
+        const auto t2 = Clock::now();
+        REQUIRE(arenaNodes == refNodes);
+
+        const double refSec   = std::chrono::duration<double> (t1 - t0).count();
+        const double arenaSec = std::chrono::duration<double> (t2 - t1).count();
+        std::printf ("%-13s %6zu nodes | reference %8.2f Mnode/s | arena %8.2f Mnode/s | x%.2f\n",
+                     c.shape, refNodes / kRuns,
+                     1.0e-6 * (double) refNodes / refSec,
+                     1.0e-6 * (double) arenaNodes / arenaSec,
+                     refSec / arenaSec);
+    }
+}
+
+// ────────────────────────────────────────────────────────────────────────────
+// IR_56 — beam pruning: same image sources, far fewer chain validations
+// ────────────────────────────────────────────────────────────────────────────
+// generateIS2D skips a candidate wall unless the facing table, the receiver's
+// first validation step and the parent's beam all allow it. Every one of
+// those is a necessary condition for the chain to validate, so the tree must
+// match the reference node for node. Checked on every tree shape at three
+// corner cuts, over a grid of source / receiver positions that includes
+// symmetric and axis-aligned placements. Without pruning, every candidate
+// passing the dot test is chain-validated; the pruned tree must validate
+// fewer than a quarter of those, and reject (almost) none.
+TEST_CASE("IR_56: beam-pruned image-source tree matches the reference",
+          "[IR_56][polygon][image-source]")
+{
+    constexpr TreeCase kCases[] = {
+        kTreeCases[0], kTreeCases[1], kTreeCases[2],
+        { "Fan / Shoebox", 18.0, 30.0, 24 },
+    };
+    constexpr double kFrac[] = { 0.3, 0.5, 0.62 };
+
+    size_t unprunedChecks = 0, prunedChecks = 0, accepted = 0;
+    for (const auto& c : kCases)
+        for (double cut : { 0.0, 0.6, 1.0 })
+        {
+            IRSynthParams p;
+            p.shape = c.shape;
+            p.shapeCornerCut = cut;
+            p.shapeTaper = 0.5 * cut;
+            std::array<double, 8> rW;
+            for (int b = 0; b < 8; ++b)
+                rW[(size_t) b] = 0.9 - 0.05 * b;
+            const auto walls = IRSynthEngine::makeWalls2D (p, c.W, c.D, rW);
+
+            for (double fs : kFrac)
+                for (double fr : kFrac)
+                {
+                    const double sx = c.W * fs, sy = c.D * 0.3;
+                    const double rx = c.W * fr, ry = c.D * (1.0 - fs);
+                    INFO (c.shape << " cut " << cut << " source (" << sx << ", " << sy
+                          << ") receiver (" << rx << ", " << ry << ")");
+
+                    const auto ref = refBuildImageSources2D (walls, sx, sy, rx, ry, c.maxOrder, kTreeBudget);
+                    size_t checks = 0;
+                    const auto arena = IRSynthEngine::buildImageSources2D (walls, sx, sy, rx, ry, 1.0e9,
+                                                                           c.maxOrder, kTreeBudget, &checks);
+                    REQUIRE(arena.size() == ref.size());
+                    for (size_t i = 0; i < ref.size(); ++i)
+                    {
+                        REQUIRE(arena[i].x == ref[i].x);
+                        REQUIRE(arena[i].y == ref[i].y);
+                        REQUIRE(arena[i].order == ref[i].order);
+                        REQUIRE((ref[i].order == 0 ? -1 : ref[i].wallPath.back()) == arena[i].wall);
+                    }
+
+                    // Candidates the unpruned generator validates: every wall
+                    // but the last that passes the dot test, under each
+                    // accepted node below the order cap.
+                    for (const auto& is : ref)
+                    {
+                        if (is.order >= c.maxOrder)
+                            continue;
+                        for (int wi = 0; wi < (int) walls.size(); ++wi)
+                        {
+                            const Wall2D& w = walls[(size_t) wi];
+                            if ((! is.wallPath.empty() && is.wallPath.back() == wi)
+                                || (is.x - w.x1) * w.nx + (is.y - w.y1) * w.ny < -1e-6)
+                                continue;
+                            ++unprunedChecks;
+                        }
+                    }
+                    prunedChecks += checks;
+                    accepted += arena.size() - 1;
+                }
+        }
+
+    INFO ("chain validations: unpruned " << unprunedChecks << ", pruned " << prunedChecks
+          << ", accepted " << accepted);
+    CHECK(prunedChecks * 4 < unprunedChecks);
+    CHECK(prunedChecks - accepted <= accepted / 100);
+}
+
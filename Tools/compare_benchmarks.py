@@ -0,0 +1,142 @@
+#!/usr/bin/env python3
+"""
+compare_benchmarks.py — Turn PingBenchmarks results into JSON and compare
+them against a checked-in baseline.
+
+PingBenchmarks (Tests/PingBenchmarks.cpp) is a Catch2 BENCHMARK binary. Its
+XML reporter records every benchmark as a <BenchmarkResults name="…">
+element with the mean and standard deviation in nanoseconds, plus their
+bootstrap confidence bounds. This script reads one or more of those XML
+files (or JSON files it wrote earlier) and:
+
+  • --json OUT           writes the results as JSON (the baseline format)
+  • --baseline FILE      compares the mean of each benchmark with the
+                         baseline and prints a table; exits 1 if any got
+                         slower by more than --threshold (default 0.10)
+                         AND its confidence interval no longer overlaps the
+                         baseline's — noise alone does not fail the run
+  • --update-baseline    rewrites FILE from these results instead
+
+JSON format:
+
+    { "host": "…", "unit": "ns",
+      "benchmarks": { "<name>": { "mean": …, "meanLow": …, "meanHigh": …,
+                                  "stddev": …, "samples": … }, … } }
+
+Benchmarks missing on either side are listed but never fail the run.
+Baselines are only comparable on the machine (and build type) that wrote
+them; the "host" field records which one that was.
+
+Usage:
+    ./PingBenchmarks "[kernel]" --benchmark-samples 20 --reporter xml::out=kernels.xml
+    ./PingBenchmarks "[synth]"  --benchmark-samples 5  --reporter xml::out=synth.xml
+    python3 Tools/compare_benchmarks.py kernels.xml synth.xml \\
+        --baseline Tests/benchmark_baseline.json
+
+No external dependencies — pure Python 3 stdlib only.
+"""
+
+import argparse
+import json
+import platform
+import sys
+import xml.etree.ElementTree as ET
+
+
+def load_results(path):
+    """name → {mean, meanLow, meanHigh, stddev, samples} from a Catch2 XML
+    report or a JSON file in this script's format."""
+    with open(path, "rb") as f:
+        head = f.read(1).lstrip()
+    if head == b"{":
+        with open(path, "r", encoding="utf-8") as f:
+            return json.load(f)["benchmarks"]
+
+    results = {}
+    for bench in ET.parse(path).getroot().iter("BenchmarkResults"):
+        mean = bench.find("mean")
+        sd = bench.find("standardDeviation")
+        if mean is None or sd is None:
+            continue   # benchmark failed before producing statistics
+        results[bench.get("name")] = {
+            "mean":     float(mean.get("value")),
+            "meanLow":  float(mean.get("lowerBound")),
+            "meanHigh": float(mean.get("upperBound")),
+            "stddev":   float(sd.get("value")),
+            "samples":  int(bench.get("samples", "0")),
+        }
+    return results
+
+
+def format_ns(ns):
+    for unit, scale in (("s", 1e9), ("ms", 1e6), ("us", 1e3)):
+        if ns >= scale:
+            return "%.3g %s" % (ns / scale, unit)
+    return "%.3g ns" % ns
+
+
+def compare(current, baseline, threshold):
+    """Prints the comparison table; returns the names that regressed."""
+    regressions = []
+    width = max([len(n) for n in list(current) + list(baseline)] + [9])
+    print("%-*s  %10s  %10s  %8s" % (width, "benchmark", "baseline", "current", "change"))
+    for name in sorted(set(current) | set(baseline)):
+        cur, base = current.get(name), baseline.get(name)
+        if cur is None or base is None:
+            print("%-*s  %10s  %10s  %8s" % (width, name,
+                                               format_ns(base["mean"]) if base else "—",
+                                               format_ns(cur["mean"]) if cur else "—",
+                                               "new" if base is None else "missing"))
+            continue
+        change = cur["mean"] / base["mean"] - 1.0 if base["mean"] > 0.0 else 0.0
+        regressed = change > threshold and cur["meanLow"] > base["meanHigh"]
+        if regressed:
+            regressions.append(name)
+        print("%-*s  %10s  %10s  %+7.1f%%%s" % (width, name, format_ns(base["mean"]),
+                                                 format_ns(cur["mean"]), 100.0 * change,
+                                                 "  REGRESSION" if regressed else ""))
+    return regressions
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__.split("\n\n")[0])
+    ap.add_argument("results", nargs="+", help="Catch2 XML reports or JSON results")
+    ap.add_argument("--json", metavar="OUT", help="write the merged results as JSON")
+    ap.add_argument("--baseline", metavar="FILE", help="baseline JSON to compare against")
+    ap.add_argument("--threshold", type=float, default=0.10,
+                    help="relative slowdown that counts as a regression (default 0.10)")
+    ap.add_argument("--host", default="%s %s" % (platform.system(), platform.machine()),
+                    help="machine description stored with --json / --update-baseline")
+    ap.add_argument("--update-baseline", action="store_true",
+                    help="overwrite --baseline with these results")
+    args = ap.parse_args()
+
+    current = {}
+    for path in args.results:
+        current.update(load_results(path))
+    if not current:
+        sys.exit("no benchmark results in " + ", ".join(args.results))
+
+    doc = {"host": args.host,
+           "unit": "ns",
+           "benchmarks": dict(sorted(current.items()))}
+
+    if args.json:
+        with open(args.json, "w", encoding="utf-8") as f:
+            json.dump(doc, f, indent=2)
+            f.write("\n")
+
+    if args.baseline and args.update_baseline:
+        with open(args.baseline, "w", encoding="utf-8") as f:
+            json.dump(doc, f, indent=2)
+            f.write("\n")
+        print("wrote %d benchmarks to %s" % (len(current), args.baseline))
+    elif args.baseline:
+        regressions = compare(current, load_results(args.baseline), args.threshold)
+        if regressions:
+            print("\n%d regression(s) beyond %.0f%%" % (len(regressions), 100.0 * args.threshold))
+            sys.exit(1)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,190 @@
+// convolver_benchmark.cpp
+//
+// Worst-case callback time of TrueStereoConvolver, the engine behind every
+// mic path's ER / Tail convolution. The plugin's real question is whether
+// processBlock can ever miss its deadline, so this tool reports the slowest
+// callback (and p99 / mean) rather than throughput.
+//
+// For each host block size (32 / 64 / 128) and IR length (1, 2, 5, 10, 20,
+// 30 s at 48 kHz) it loads all four paths the way PingProcessor does — MAIN,
+// OUTRIG and AMBIENT with an 80 ms ER plus a tail of the full length placed
+// at the 80 ms crossover, DIRECT with an 80 ms ER — and runs 30 s of stereo
+// noise through process(), one callback per block. Each case runs twice: with no worker threads (the audio
+// thread computes every tail partition itself at its deadline) and with the
+// requested number of workers.
+//
+// By default callbacks are paced in real time, so the workers have the same
+// time budget they get in a host; `--fast` runs them back-to-back instead
+// (useful for quick A/B of the arithmetic, but it starves the pool).
+//
+// Build (from repo root):
+//   cmake --build build --target PingConvolverBench
+// or by hand:
+//   c++ -std=c++17 -O2 -DPING_TESTING_BUILD=1 -I Source \
+//       Source/TrueStereoConvolver.cpp Tools/convolver_benchmark.cpp \
+//       -o build/convolver_benchmark -lpthread
+//
+// Run:
+//   ./build/convolver_benchmark [--workers N] [--fast] [--seconds S]
+//
+// Note: PING_TESTING_BUILD swaps juce::dsp::FFT for the engine's portable
+// radix-2 FFT, so absolute times are pessimistic against the plugin build;
+// the ratio between the worker / no-worker columns is what to watch.
+
+#include "TrueStereoConvolver.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    constexpr double kSampleRate = 48000.0;
+
+    std::vector<float> noise (uint32_t& seed, int n, float gain)
+    {
+        std::vector<float> v ((size_t) n);
+        for (auto& s : v)
+        {
+            seed = seed * 1664525u + 1013904223u;
+            s = gain * (float) ((double) (seed >> 8) / 8388608.0 - 1.0);
+        }
+        return v;
+    }
+
+    // Exponentially decaying noise, roughly what synthMainPath produces.
+    std::vector<float> decayingNoise (uint32_t& seed, int n)
+    {
+        auto v = noise (seed, n, 0.1f);
+        const double k = n > 0 ? std::log (0.001) / n : 0.0;
+        for (int i = 0; i < n; ++i)
+            v[(size_t) i] *= (float) std::exp (k * i);
+        return v;
+    }
+
+    struct Result
+    {
+        double worstUs = 0.0, p99Us = 0.0, meanUs = 0.0;
+        double budgetUs = 0.0;
+    };
+
+    Result runCase (int blockSize, double irSeconds, int numWorkers, bool realTime, double runSeconds)
+    {
+        using TSC = TrueStereoConvolver;
+        using Clock = std::chrono::steady_clock;
+
+        uint32_t seed = 3u;
+        const int erLen   = (int) (0.08 * kSampleRate);
+        const int tailLen = (int) (irSeconds * kSampleRate);
+
+        TSC conv (numWorkers);
+        conv.prepare (blockSize);
+        for (int p = 0; p < TSC::kNumPaths; ++p)
+        {
+            TSC::PathIR ir;
+            ir.tailOffset = erLen;
+            for (size_t c = 0; c < 4; ++c)
+            {
+                ir.er[c] = decayingNoise (seed, erLen);
+                if (p != TSC::Direct)
+                    ir.tail[c] = decayingNoise (seed, tailLen);
+            }
+            conv.loadPath ((TSC::Path) p, ir);
+        }
+
+        const auto inL = noise (seed, blockSize * 64, 0.5f);
+        const auto inR = noise (seed, blockSize * 64, 0.5f);
+        std::vector<std::vector<float>> buses (TSC::kNumBuses, std::vector<float> ((size_t) blockSize));
+        std::vector<float*> busPtrs;
+        for (auto& b : buses)
+            busPtrs.push_back (b.data());
+        const bool enabled[TSC::kNumPaths] { true, true, true, true };
+
+        const int numBlocks = (int) (runSeconds * kSampleRate / blockSize);
+        const auto period = std::chrono::duration<double> (blockSize / kSampleRate);
+        std::vector<double> times;
+        times.reserve ((size_t) numBlocks);
+
+        auto next = Clock::now();
+        for (int i = 0; i < numBlocks; ++i)
+        {
+            const int off = (i % 64) * blockSize;
+            const auto t0 = Clock::now();
+            conv.adoptPending();
+            conv.process (inL.data() + off, inR.data() + off, blockSize, enabled, busPtrs.data());
+            const auto t1 = Clock::now();
+            times.push_back (std::chrono::duration<double, std::micro> (t1 - t0).count());
+
+            if (realTime)
+            {
+                next += std::chrono::duration_cast<Clock::duration> (period);
+                std::this_thread::sleep_until (next);
+            }
+        }
+        conv.releaseRetired();
+
+        Result r;
+        r.budgetUs = 1.0e6 * blockSize / kSampleRate;
+        double sum = 0.0;
+        for (double t : times)
+            sum += t;
+        r.meanUs = sum / (double) times.size();
+        std::sort (times.begin(), times.end());
+        r.worstUs = times.back();
+        r.p99Us   = times[(size_t) ((double) (times.size() - 1) * 0.99)];
+        return r;
+    }
+}
+
+int main (int argc, char** argv)
+{
+    int numWorkers = 2;
+    bool realTime = true;
+    double runSeconds = 30.0;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        if (std::strcmp (argv[i], "--workers") == 0 && i + 1 < argc)
+            numWorkers = std::max (1, std::atoi (argv[++i]));
+        else if (std::strcmp (argv[i], "--fast") == 0)
+            realTime = false;
+        else if (std::strcmp (argv[i], "--seconds") == 0 && i + 1 < argc)
+            runSeconds = std::max (1.0, std::atof (argv[++i]));
+        else
+        {
+            std::fprintf (stderr, "usage: %s [--workers N] [--fast] [--seconds S]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    std::printf ("TrueStereoConvolver callback times (us), 4 paths, %g s per case%s\n",
+                 runSeconds, realTime ? ", real-time paced" : ", unpaced");
+    std::printf ("%5s %6s | %10s %10s %10s | %10s %10s %10s | %8s\n",
+                 "block", "IR s", "worst/0w", "p99/0w", "mean/0w",
+                 "worst/Nw", "p99/Nw", "mean/Nw", "budget");
+
+    const int blockSizes[] = { 32, 64, 128 };
+    const double irSeconds[] = { 1.0, 2.0, 5.0, 10.0, 20.0, 30.0 };
+    for (int block : blockSizes)
+    {
+        for (double ir : irSeconds)
+        {
+            const auto inlineRun = runCase (block, ir, 0, realTime, runSeconds);
+            const auto pooled    = runCase (block, ir, numWorkers, realTime, runSeconds);
+            std::printf ("%5d %6.0f | %10.1f %10.1f %10.2f | %10.1f %10.1f %10.2f | %8.1f\n",
+                         block, ir,
+                         inlineRun.worstUs, inlineRun.p99Us, inlineRun.meanUs,
+                         pooled.worstUs, pooled.p99Us, pooled.meanUs,
+                         inlineRun.budgetUs);
+            std::fflush (stdout);
+        }
+    }
+    std::printf ("(N = %d worker threads)\n", numWorkers);
+    return 0;
+}
@@ -29,8 +29,14 @@
  */
 
 #include "IRSynthEngine.h"
+#include "SynthTaskPool.h"
 
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
 #include <iostream>
+#include <mutex>
 #include <fstream>
 #include <filesystem>
 #include <sstream>
@@ -590,6 +596,24 @@ static bool writeText(const fs::path& path, const std::string& text)
     return f.good();
 }
 
+// JSON string literal (quotes, backslashes and control characters escaped).
+static std::string jsonString(const std::string& s)
+{
+    std::string o = "\"";
+    for (unsigned char c : s)
+    {
+        if (c == '"' || c == '\\') { o += '\\'; o += (char)c; }
+        else if (c < 0x20)
+        {
+            char buf[8];
+            std::snprintf(buf, sizeof(buf), "\\u%04x", c);
+            o += buf;
+        }
+        else o += (char)c;
+    }
+    return o + "\"";
+}
+
 // ── Sidecar XML ──────────────────────────────────────────────────────────────
 static std::string makeSidecarXML(const IRSynthParams& p)
 {
@@ -916,6 +940,11 @@ int main(int argc, char** argv)
                   << "                         already exists is skipped entirely (both\n"
                   << "                         the .wav and the .ping are left alone)\n"
                   << "                         to protect hand-authored parameter edits.\n"
+                  << "  --threads <n>          Worker threads shared by all venues (default:\n"
+                  << "                         one per core). Venues synthesise concurrently;\n"
+                  << "                         --threads 1 runs them one at a time.\n"
+                  << "  --profile <file.json>  Write each venue's per-stage synth profile\n"
+                  << "                         (IRSynthResult::profile) to <file.json>.\n"
                   << "\n"
                   << "  e.g. generate_factory_irs Installer/factory_irs Installer/factory_presets\n";
         return 1;
@@ -925,10 +954,14 @@ int main(int argc, char** argv)
     fs::path presetBase = argv[2];
 
     bool overwriteSidecars = false;
+    int numThreads = SynthTaskPool::defaultNumThreads() + 1;
+    fs::path profilePath;
     for (int i = 3; i < argc; ++i)
     {
         const std::string arg = argv[i];
         if (arg == "--overwrite-sidecars") overwriteSidecars = true;
+        else if (arg == "--threads" && i + 1 < argc) numThreads = std::max (1, std::atoi (argv[++i]));
+        else if (arg == "--profile" && i + 1 < argc) profilePath = argv[++i];
         else
         {
             std::cerr << "Unknown option: " << arg << "\n";
@@ -937,27 +970,33 @@ int main(int argc, char** argv)
     }
 
     int total   = (int)VENUES.size();
-    int done    = 0;
-    int failed  = 0;
-    int skipped = 0;
+
+    SynthTaskPool::setSharedNumThreads (numThreads - 1);   // + this thread
 
     std::cout << "=== P!NG Factory IR Generator ===\n"
               << "Venues: " << total << "\n"
               << "IR output:     " << irBase     << "\n"
               << "Preset output: " << presetBase << "\n"
               << "Overwrite sidecars: " << (overwriteSidecars ? "YES (destructive)" : "no (safe default)") << "\n"
+              << "Threads: " << numThreads << "\n"
               << "\n";
 
-    for (const auto& venueConst : VENUES)
+    // One task per venue on the shared SynthTaskPool. Each venue's synthIR
+    // forks its own path / channel tasks onto the same pool, so --threads
+    // bounds the whole run. A venue's log is buffered and printed in one
+    // piece when it finishes.
+    enum class VenueStatus { Done, Failed, Skipped };
+    std::vector<std::string> venueProfiles (VENUES.size());   // JSON, "" if not synthesised
+    auto processVenue = [&](size_t index, std::ostream& out, std::ostream& err) -> VenueStatus
     {
         // Take a mutable copy so we can apply the standard multi-mic setup
         // (Decca + outriggers + ambients) on top of the authored venue parameters.
-        VenueDef venue = venueConst;
+        VenueDef venue = VENUES[index];
         applyStandardMicSetup (venue.params);
 
-        std::cout << "[" << (done + failed + skipped + 1) << "/" << total << "] "
-                  << venue.category << " / " << venue.name << "\n";
-        std::cout.flush();
+        out << "[" << (index + 1) << "/" << total << "] "
+            << venue.category << " / " << venue.name << "\n";
+        out.flush();
 
         // Create output directories
         fs::path irDir     = irBase     / venue.category;
@@ -966,9 +1005,8 @@ int main(int argc, char** argv)
             fs::create_directories(irDir);
             fs::create_directories(presetDir);
         } catch (const std::exception& e) {
-            std::cerr << "  ERROR creating directories: " << e.what() << "\n";
-            ++failed;
-            continue;
+            err << "  ERROR creating directories: " << e.what() << "\n";
+            return VenueStatus::Failed;
         }
 
         fs::path wavPath    = irDir    / (std::string(venue.name) + ".wav");
@@ -988,35 +1026,40 @@ int main(int argc, char** argv)
         // re-synthesising .wavs from hand-authored sidecars.
         if (!overwriteSidecars && fs::exists (sidecarPath))
         {
-            std::cout << "    SKIP: sidecar already exists ("
-                      << sidecarPath.filename() << ")\n"
-                      << "          pass --overwrite-sidecars to replace.\n";
-            ++skipped;
-            continue;
+            out << "    SKIP: sidecar already exists ("
+                << sidecarPath.filename() << ")\n"
+                << "          pass --overwrite-sidecars to replace.\n";
+            return VenueStatus::Skipped;
         }
 
         // Generate IR
         auto t0 = std::chrono::steady_clock::now();
 
-        IRSynthResult result = IRSynthEngine::synthIR(
-            venue.params,
-            [](double frac, const std::string& msg) {
+        // Live progress only when venues run one at a time; concurrent
+        // venues would overwrite each other's \r line.
+        IRSynthProgressFn progress;
+        if (numThreads <= 1)
+            progress = [](double frac, const std::string& msg) {
                 std::cout << "    " << std::fixed << std::setprecision(0)
                           << (frac * 100.0) << "% " << msg << "         \r";
                 std::cout.flush();
-            });
+            };
+        IRSynthResult result = IRSynthEngine::synthIR(venue.params, progress);
 
         auto t1  = std::chrono::steady_clock::now();
         double elapsed = std::chrono::duration<double>(t1 - t0).count();
-        std::cout << "    Done in " << std::fixed << std::setprecision(1) << elapsed
-                  << " s  (" << (result.irLen / result.sampleRate) << " s IR, "
-                  << result.iLL.size() << " samples)\n";
+        out << "    Done in " << std::fixed << std::setprecision(1) << elapsed
+            << " s  (" << (result.irLen / result.sampleRate) << " s IR, "
+            << result.iLL.size() << " samples)\n";
+        if (result.success)
+            venueProfiles[index] = "{\"category\":" + jsonString(venue.category)
+                                 + ",\"name\":" + jsonString(venue.name)
+                                 + ",\"profile\":" + result.profile.toJson() + "}";
 
         if (!result.success)
         {
-            std::cerr << "  FAILED: " << result.errorMessage << "\n";
-            ++failed;
-            continue;
+            err << "  FAILED: " << result.errorMessage << "\n";
+            return VenueStatus::Failed;
         }
 
         // Write MAIN WAV
@@ -1024,12 +1067,11 @@ int main(int argc, char** argv)
             result.iLL, result.iRL, result.iLR, result.iRR, result.sampleRate);
         if (!writeBytes(wavPath, wavBytes.data(), wavBytes.size()))
         {
-            std::cerr << "  ERROR writing WAV: " << wavPath << "\n";
-            ++failed;
-            continue;
+            err << "  ERROR writing WAV: " << wavPath << "\n";
+            return VenueStatus::Failed;
         }
-        std::cout << "    WAV:     " << wavPath.filename() << " ("
-                  << (wavBytes.size() / 1024) << " KB)\n";
+        out << "    WAV:     " << wavPath.filename() << " ("
+            << (wavBytes.size() / 1024) << " KB)\n";
 
         // Write DIRECT / OUTRIG / AMBIENT sibling WAVs (auto-loaded by the
         // plugin when the MAIN file is selected — see IRManager sibling rules).
@@ -1038,11 +1080,11 @@ int main(int argc, char** argv)
             auto bytes = IRSynthEngine::makeWav (ch.LL, ch.RL, ch.LR, ch.RR, result.sampleRate);
             if (!writeBytes (p, bytes.data(), bytes.size()))
             {
-                std::cerr << "  ERROR writing " << label << ": " << p << "\n";
+                err << "  ERROR writing " << label << ": " << p << "\n";
                 return;
             }
-            std::cout << "    " << label << ":  " << p.filename() << " ("
-                      << (bytes.size() / 1024) << " KB)\n";
+            out << "    " << label << ":  " << p.filename() << " ("
+                << (bytes.size() / 1024) << " KB)\n";
         };
         writeAux (result.direct,  directPath,  "Direct ");
         writeAux (result.outrig,  outrigPath,  "Outrig ");
@@ -1052,11 +1094,10 @@ int main(int argc, char** argv)
         auto sidecarXML = makeSidecarXML(venue.params);
         if (!writeText(sidecarPath, sidecarXML))
         {
-            std::cerr << "  ERROR writing sidecar: " << sidecarPath << "\n";
-            ++failed;
-            continue;
+            err << "  ERROR writing sidecar: " << sidecarPath << "\n";
+            return VenueStatus::Failed;
         }
-        std::cout << "    Sidecar: " << sidecarPath.filename() << "\n";
+        out << "    Sidecar: " << sidecarPath.filename() << "\n";
 
         // Write preset binary
         std::string irFilePath = "/Library/Application Support/Ping/Factory IRs/"
@@ -1064,13 +1105,50 @@ int main(int argc, char** argv)
         auto presetXML = makePresetXML(irFilePath, venue.params, venue.eq, venue.dryWet, venue.inputGainDb);
         if (!writePreset(presetPath, presetXML))
         {
-            std::cerr << "  ERROR writing preset: " << presetPath << "\n";
-            ++failed;
-            continue;
+            err << "  ERROR writing preset: " << presetPath << "\n";
+            return VenueStatus::Failed;
         }
-        std::cout << "    Preset:  " << presetPath.filename() << "\n";
+        out << "    Preset:  " << presetPath.filename() << "\n";
 
-        ++done;
+        return VenueStatus::Done;
+    };
+
+    std::mutex logMutex;
+    std::atomic<int> done { 0 }, failed { 0 }, skipped { 0 };
+    {
+        SynthTaskPool::TaskGroup venues;
+        for (size_t i = 0; i < VENUES.size(); ++i)
+            venues.run ([&, i]
+            {
+                std::ostringstream out, err;
+                const auto status = processVenue (i, out, err);
+                std::lock_guard<std::mutex> lock (logMutex);
+                std::cout << out.str();
+                std::cerr << err.str();
+                std::cout.flush();
+                (status == VenueStatus::Done ? done : status == VenueStatus::Failed ? failed : skipped)++;
+            });
+        venues.wait();
+    }
+
+    if (!profilePath.empty())
+    {
+        std::string json = "{\"venues\":[";
+        bool first = true;
+        for (const auto& v : venueProfiles)
+        {
+            if (v.empty()) continue;
+            json += (first ? "\n  " : ",\n  ") + v;
+            first = false;
+        }
+        json += "\n]}\n";
+        if (writeText(profilePath, json))
+            std::cout << "Profile: " << profilePath << "\n";
+        else
+        {
+            std::cerr << "ERROR writing profile: " << profilePath << "\n";
+            failed++;
+        }
     }
 
     std::cout << "\n=== Complete: " << done << " succeeded"
@@ -0,0 +1,346 @@
+// process_benchmark.cpp
+//
+// Headless callback-time benchmark of the whole plugin: instantiates
+// PingProcessor with no host and no editor, prepares it at each requested
+// sample rate and block size, loads an IR into all four mic paths (MAIN,
+// DIRECT, OUTRIG, AMBIENT, every strip switched on) and runs stereo noise
+// through processBlock, one callback per block. convolver_benchmark covers
+// TrueStereoConvolver alone; this covers everything around it as well.
+//
+// For every case it reports the mean, p99 and worst callback time, the
+// block's real-time budget and the real-time factor (audio time processed
+// per second of callback time; below 1 the instance cannot keep up). A
+// second line splits the mean into the stages of processChunk, timed by
+// ProcessStageTimer (this target builds with PING_PROCESS_PROFILE=1), so a
+// regression in, say, the shimmer voices or the convolvers shows up in its
+// own column.
+//
+// Effect configurations (--fx, comma-separated):
+//   none     Plate, Bloom, Cloud and Shimmer off
+//   plate / bloom / cloud / shimmer
+//            that one effect on at its default settings
+//   all      all four on
+//
+// IR source: by default the MAIN / DIRECT / OUTRIG / AMBIENT set synthIR
+// produces for the default hall, rendered once up front. --ir loads a WAV
+// (normally a factory IR) instead, with its _direct / _outrig / _ambient
+// siblings; a path without a sibling stays empty and is reported. Every case
+// goes through what a host sample-rate / block-size change does: the
+// processor is re-prepared, and the message loop runs briefly so the reload
+// prepareToPlay posts (reloadSynthIR or loadIRFromFile) and the scratch /
+// retired-kernel timer happen. Then --warmup seconds run untimed (kernel
+// adoption, the IR load fade, shimmer onset) before it measures.
+//
+// By default callbacks are paced in real time so the convolver's worker
+// threads get the time budget they get in a host; --fast runs them
+// back-to-back.
+//
+// Build (from repo root):
+//   cmake --build build --target PingProcessBench
+//
+// Run:
+//   PingProcessBench [--rates 44100,48000,96000] [--blocks 32,64,128,256,512]
+//                    [--fx none,plate,bloom,cloud,shimmer,all] [--ir <file.wav>]
+//                    [--live-tail] [--seconds S] [--warmup S] [--fast]
+//                    [--json <file.json>]
+//
+// Note: the licence check is bypassed for this instance only (see
+// PingProcessor::unlockForBenchmark); nothing is written to disk.
+
+#include <JuceHeader.h>
+#include "PluginProcessor.h"
+#include "ProcessStageTimer.h"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    using Clock = std::chrono::steady_clock;
+    using MicPath = PingProcessor::MicPath;
+
+    // Long enough for the IR reload prepareToPlay posts and one tick of the
+    // processor's scratch / retired-kernel timer.
+    constexpr int kMessagePumpMs = 500;
+
+    constexpr std::array<MicPath, 4> kPaths { MicPath::Main, MicPath::Direct, MicPath::Outrig, MicPath::Ambient };
+    constexpr const char* kPathNames[4] { "main", "direct", "outrig", "ambient" };
+
+    struct FxConfig { const char* name; bool plate, bloom, cloud, shimmer; };
+    constexpr FxConfig kFxConfigs[] {
+        { "none",    false, false, false, false },
+        { "plate",   true,  false, false, false },
+        { "bloom",   false, true,  false, false },
+        { "cloud",   false, false, true,  false },
+        { "shimmer", false, false, false, true  },
+        { "all",     true,  true,  true,  true  },
+    };
+
+    struct Result
+    {
+        double meanUs = 0.0, p99Us = 0.0, worstUs = 0.0, budgetUs = 0.0;
+        double realTimeFactor = 0.0;
+        std::array<double, ProcessStageTimer::kNumStages> stageMeanUs {};
+    };
+
+    std::vector<int> parseList (const char* s)
+    {
+        std::vector<int> v;
+        for (auto& tok : juce::StringArray::fromTokens (s, ",", {}))
+            if (tok.getIntValue() > 0)
+                v.push_back (tok.getIntValue());
+        return v;
+    }
+
+    void setParam (PingProcessor& proc, const char* id, float normalised)
+    {
+        if (auto* p = proc.getAPVTS().getParameter (id))
+            p->setValueNotifyingHost (normalised);
+    }
+
+    // The synth set the IR Synth panel would hand the processor for the
+    // default hall, with every extra path enabled.
+    bool synthesiseIRs (PingProcessor& proc)
+    {
+        IRSynthParams p;
+        p.direct_enabled = p.outrig_enabled = p.ambient_enabled = true;
+        const auto r = IRSynthEngine::synthIR<float> (p, nullptr);
+        if (! r.success)
+            return false;
+
+        auto toBuffer = [] (const std::vector<float>& ll, const std::vector<float>& rl,
+                            const std::vector<float>& lr, const std::vector<float>& rr)
+        {
+            const int n = (int) ll.size();
+            juce::AudioBuffer<float> b (4, n);
+            b.copyFrom (0, 0, ll.data(), n);
+            b.copyFrom (1, 0, rl.data(), n);
+            b.copyFrom (2, 0, lr.data(), n);
+            b.copyFrom (3, 0, rr.data(), n);
+            return b;
+        };
+        // Deferred: stores the raw buffers only. The reload prepareToPlay
+        // posts builds the kernels once the processor is prepared.
+        proc.loadIRFromBuffer (toBuffer (r.iLL, r.iRL, r.iLR, r.iRR), (double) r.sampleRate, true, true, MicPath::Main);
+        for (auto [mic, path] : { std::pair { &r.direct, MicPath::Direct },
+                                  std::pair { &r.outrig, MicPath::Outrig },
+                                  std::pair { &r.ambient, MicPath::Ambient } })
+            if (mic->synthesised)
+                proc.loadIRFromBuffer (toBuffer (mic->LL, mic->RL, mic->LR, mic->RR),
+                                       (double) r.sampleRate, true, true, path);
+        return true;
+    }
+
+    Result runCase (PingProcessor& proc, double rate, int block, const FxConfig& fx,
+                    double warmupSeconds, double runSeconds, bool realTime)
+    {
+        for (const char* id : { "mainOn", "directOn", "outrigOn", "ambientOn" })
+            setParam (proc, id, 1.0f);
+        setParam (proc, "plateOn", fx.plate   ? 1.0f : 0.0f);
+        setParam (proc, "bloomOn", fx.bloom   ? 1.0f : 0.0f);
+        setParam (proc, "cloudOn", fx.cloud   ? 1.0f : 0.0f);
+        setParam (proc, "shimOn",  fx.shimmer ? 1.0f : 0.0f);
+
+        proc.setPlayConfigDetails (2, 2, rate, block);
+        proc.prepareToPlay (rate, block);
+        juce::MessageManager::getInstance()->runDispatchLoopUntil (kMessagePumpMs);
+
+        // 64 blocks of noise at −12 dBFS, cycled.
+        juce::Random rng (7);
+        juce::AudioBuffer<float> source (2, block * 64);
+        for (int ch = 0; ch < 2; ++ch)
+            for (int i = 0; i < source.getNumSamples(); ++i)
+                source.setSample (ch, i, 0.25f * (rng.nextFloat() * 2.0f - 1.0f));
+
+        juce::AudioBuffer<float> io (2, block);
+        juce::MidiBuffer midi;
+        auto& timer = proc.getStageTimer();
+
+        const int warmupBlocks = (int) (warmupSeconds * rate / block);
+        const int numBlocks    = std::max (1, (int) (runSeconds * rate / block));
+        const auto period = std::chrono::duration_cast<Clock::duration> (std::chrono::duration<double> (block / rate));
+
+        std::vector<double> times;
+        times.reserve ((size_t) numBlocks);
+        std::array<double, ProcessStageTimer::kNumStages> stageSumNs {};
+
+        auto next = Clock::now();
+        for (int i = 0; i < warmupBlocks + numBlocks; ++i)
+        {
+            const int off = (i % 64) * block;
+            for (int ch = 0; ch < 2; ++ch)
+                io.copyFrom (ch, 0, source, ch, off, block);
+
+            timer.reset();
+            const auto t0 = Clock::now();
+            proc.processBlock (io, midi);
+            const auto t1 = Clock::now();
+
+            if (i >= warmupBlocks)
+            {
+                times.push_back (std::chrono::duration<double, std::micro> (t1 - t0).count());
+                for (size_t s = 0; s < stageSumNs.size(); ++s)
+                    stageSumNs[s] += timer.stageNs()[s];
+            }
+
+            if (realTime)
+            {
+                next += period;
+                std::this_thread::sleep_until (next);
+            }
+        }
+
+        Result r;
+        r.budgetUs = 1.0e6 * block / rate;
+        double sum = 0.0;
+        for (double t : times)
+            sum += t;
+        r.meanUs = sum / (double) times.size();
+        r.realTimeFactor = r.budgetUs / r.meanUs;
+        for (size_t s = 0; s < stageSumNs.size(); ++s)
+            r.stageMeanUs[s] = stageSumNs[s] / 1000.0 / (double) times.size();
+        std::sort (times.begin(), times.end());
+        r.worstUs = times.back();
+        r.p99Us   = times[(size_t) ((double) (times.size() - 1) * 0.99)];
+        return r;
+    }
+}
+
+int main (int argc, char** argv)
+{
+    juce::ScopedJuceInitialiser_GUI juceInit;
+
+    std::vector<int> rates  { 48000 };
+    std::vector<int> blocks { 64, 256 };
+    std::vector<const FxConfig*> fxConfigs { &kFxConfigs[0], &kFxConfigs[5] };
+    juce::File irFile;
+    juce::File jsonFile;
+    bool liveTail = false, realTime = true;
+    double runSeconds = 10.0, warmupSeconds = 2.0;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        const bool hasValue = i + 1 < argc;
+        if (std::strcmp (argv[i], "--rates") == 0 && hasValue)
+            rates = parseList (argv[++i]);
+        else if (std::strcmp (argv[i], "--blocks") == 0 && hasValue)
+            blocks = parseList (argv[++i]);
+        else if (std::strcmp (argv[i], "--fx") == 0 && hasValue)
+        {
+            fxConfigs.clear();
+            for (auto& tok : juce::StringArray::fromTokens (argv[++i], ",", {}))
+                for (const auto& fx : kFxConfigs)
+                    if (tok.trim() == fx.name)
+                        fxConfigs.push_back (&fx);
+        }
+        else if (std::strcmp (argv[i], "--ir") == 0 && hasValue)
+            irFile = juce::File::getCurrentWorkingDirectory().getChildFile (argv[++i]);
+        else if (std::strcmp (argv[i], "--json") == 0 && hasValue)
+            jsonFile = juce::File::getCurrentWorkingDirectory().getChildFile (argv[++i]);
+        else if (std::strcmp (argv[i], "--live-tail") == 0)
+            liveTail = true;
+        else if (std::strcmp (argv[i], "--seconds") == 0 && hasValue)
+            runSeconds = std::max (1.0, std::atof (argv[++i]));
+        else if (std::strcmp (argv[i], "--warmup") == 0 && hasValue)
+            warmupSeconds = std::max (0.0, std::atof (argv[++i]));
+        else if (std::strcmp (argv[i], "--fast") == 0)
+            realTime = false;
+        else
+        {
+            std::fprintf (stderr, "usage: %s [--rates R,…] [--blocks N,…] [--fx none,plate,bloom,cloud,shimmer,all]\n"
+                                  "          [--ir file.wav] [--live-tail] [--seconds S] [--warmup S] [--fast]\n"
+                                  "          [--json file.json]\n", argv[0]);
+            return 1;
+        }
+    }
+    if (rates.empty() || blocks.empty() || fxConfigs.empty())
+    {
+        std::fprintf (stderr, "nothing to run: --rates, --blocks and --fx need at least one valid entry\n");
+        return 1;
+    }
+    if (irFile != juce::File() && ! irFile.existsAsFile())
+    {
+        std::fprintf (stderr, "IR file not found: %s\n", irFile.getFullPathName().toRawUTF8());
+        return 1;
+    }
+
+    PingProcessor proc;
+    proc.unlockForBenchmark();
+    proc.setLiveTail (liveTail);
+    if (irFile.existsAsFile())
+        proc.setSelectedIRFile (irFile);   // prepareToPlay's reload picks it up
+    else if (! synthesiseIRs (proc))
+    {
+        std::fprintf (stderr, "IR synthesis failed\n");
+        return 1;
+    }
+
+    std::printf ("PingProcessor callback times (us), %s, %g s per case%s%s\n",
+                 irFile.existsAsFile() ? irFile.getFileName().toRawUTF8() : "synthesised default hall",
+                 runSeconds, realTime ? ", real-time paced" : ", unpaced", liveTail ? ", live tail" : "");
+
+    juce::Array<juce::var> jsonCases;
+    bool reportedPaths = false;
+    for (int rate : rates)
+        for (int block : blocks)
+        {
+            std::printf ("\n%6s %5s %-8s | %10s %10s %10s | %8s %7s\n",
+                         "rate", "block", "fx", "mean", "p99", "worst", "budget", "x RT");
+            for (const auto* fx : fxConfigs)
+            {
+                const auto r = runCase (proc, (double) rate, block, *fx, warmupSeconds, runSeconds, realTime);
+                if (! reportedPaths)
+                {
+                    for (size_t p = 0; p < kPaths.size(); ++p)
+                        if (! proc.isPathIRLoaded (kPaths[p]))
+                            std::printf ("(no IR for %s — that strip runs empty)\n", kPathNames[p]);
+                    reportedPaths = true;
+                }
+
+                std::printf ("%6d %5d %-8s | %10.2f %10.1f %10.1f | %8.1f %7.2f\n",
+                             rate, block, fx->name, r.meanUs, r.p99Us, r.worstUs, r.budgetUs, r.realTimeFactor);
+                std::printf ("%21s mean per stage:", "");
+                for (int s = 0; s < ProcessStageTimer::kNumStages; ++s)
+                    std::printf (" %s %.2f", ProcessStageTimer::name (s), r.stageMeanUs[(size_t) s]);
+                std::printf ("\n");
+                std::fflush (stdout);
+
+                auto* c = new juce::DynamicObject();
+                c->setProperty ("rate", rate);
+                c->setProperty ("block", block);
+                c->setProperty ("fx", juce::String (fx->name));
+                c->setProperty ("meanUs", r.meanUs);
+                c->setProperty ("p99Us", r.p99Us);
+                c->setProperty ("worstUs", r.worstUs);
+                c->setProperty ("budgetUs", r.budgetUs);
+                c->setProperty ("realTimeFactor", r.realTimeFactor);
+                auto* stages = new juce::DynamicObject();
+                for (int s = 0; s < ProcessStageTimer::kNumStages; ++s)
+                    stages->setProperty (ProcessStageTimer::name (s), r.stageMeanUs[(size_t) s]);
+                c->setProperty ("stageMeanUs", juce::var (stages));
+                jsonCases.add (juce::var (c));
+            }
+        }
+
+    if (jsonFile != juce::File())
+    {
+        auto* root = new juce::DynamicObject();
+        root->setProperty ("ir", irFile.existsAsFile() ? irFile.getFileName() : juce::String ("synth"));
+        root->setProperty ("realTimePaced", realTime);
+        root->setProperty ("liveTail", liveTail);
+        root->setProperty ("cases", jsonCases);
+        if (! jsonFile.replaceWithText (juce::JSON::toString (juce::var (root))))
+        {
+            std::fprintf (stderr, "could not write %s\n", jsonFile.getFullPathName().toRawUTF8());
+            return 1;
+        }
+    }
+    return 0;
+}
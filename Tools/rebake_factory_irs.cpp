@@ -36,11 +36,19 @@
  *                          substring (case-sensitive).  Can be passed
  *                          multiple times; any match wins.
  *   -q / --quiet           Suppress per-venue progress output.
+ *   --threads <n>          Worker threads shared by all sidecars (default:
+ *                          one per core). Sidecars are rebaked concurrently
+ *                          on the shared SynthTaskPool; 1 = one at a time.
  */
 
 #include "IRSynthEngine.h"
+#include "SynthTaskPool.h"
 
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
 #include <iostream>
+#include <mutex>
 #include <fstream>
 #include <sstream>
 #include <filesystem>
@@ -312,6 +320,24 @@ static bool writeBytes(const fs::path& p, const void* data, size_t size)
     return static_cast<bool>(out);
 }
 
+// JSON string literal (quotes, backslashes and control characters escaped).
+static std::string jsonString(const std::string& s)
+{
+    std::string o = "\"";
+    for (unsigned char c : s)
+    {
+        if (c == '"' || c == '\\') { o += '\\'; o += (char)c; }
+        else if (c < 0x20)
+        {
+            char buf[8];
+            std::snprintf(buf, sizeof buf, "\\u%04x", c);
+            o += buf;
+        }
+        else o += (char)c;
+    }
+    return o + "\"";
+}
+
 // ── Sidecar mutator (v2.14.2): synthGain only ────────────────────────────────
 // Surgically inject or update `synthGain="X.XX"` inside the unique
 // `<irSynthParams .../>` element of a .ping sidecar. All other bytes
@@ -400,6 +426,10 @@ int main(int argc, char** argv)
             "  --only <substring>     Only process sidecars whose path contains\n"
             "                         the substring (case-sensitive).  Repeatable.\n"
             "  -q | --quiet           Suppress per-venue progress output.\n"
+            "  --threads <n>          Worker threads shared by all sidecars\n"
+            "                         (default: one per core; 1 = one at a time).\n"
+            "  --profile <file.json>  Write each sidecar's per-stage synth profile\n"
+            "                         (IRSynthResult::profile) to <file.json>.\n"
             "\n"
             "Example:\n"
             "  rebake_factory_irs Installer/factory_irs --only 'Large Beauty'\n";
@@ -409,7 +439,9 @@ int main(int argc, char** argv)
     fs::path root = argv[1];
     bool dryRun = false;
     bool quiet  = false;
+    int  numThreads = SynthTaskPool::defaultNumThreads() + 1;
     std::vector<std::string> onlyFilters;
+    fs::path profilePath;
 
     for (int i = 2; i < argc; ++i)
     {
@@ -417,6 +449,8 @@ int main(int argc, char** argv)
         if      (arg == "--dry-run")              dryRun = true;
         else if (arg == "-q" || arg == "--quiet") quiet = true;
         else if (arg == "--only" && i + 1 < argc) onlyFilters.emplace_back(argv[++i]);
+        else if (arg == "--threads" && i + 1 < argc) numThreads = std::max(1, std::atoi(argv[++i]));
+        else if (arg == "--profile" && i + 1 < argc) profilePath = argv[++i];
         else
         {
             std::cerr << "Unknown option: " << arg << "\n";
@@ -459,13 +493,20 @@ int main(int argc, char** argv)
     std::cout << "=== P!NG Factory IR Rebaker (sidecar-driven) ===\n"
               << "Root:    " << root << "\n"
               << "Sidecars: " << sidecars.size() << "\n"
+              << "Threads: " << numThreads << "\n"
               << (dryRun ? "Mode:    DRY RUN (no files will be written)\n" : "")
               << "\n";
 
-    int done = 0, failed = 0, skipped = 0;
+    SynthTaskPool::setSharedNumThreads (numThreads - 1);   // + this thread
 
-    for (const auto& pingPath : sidecars)
+    // One task per sidecar on the shared SynthTaskPool; each synthIR forks
+    // its path / channel tasks onto the same pool, so --threads bounds the
+    // whole run. A sidecar's log is buffered and printed in one piece.
+    enum class Status { Done, Failed, Skipped };
+    std::vector<std::string> profiles(sidecars.size());   // JSON, "" if not synthesised
+    auto rebake = [&](size_t index, std::ostream& out, std::ostream& err) -> Status
     {
+        const fs::path& pingPath = sidecars[index];
         const fs::path base   = pingPath.parent_path() / pingPath.stem();
         const fs::path wavMain    = base.string() + ".wav";
         const fs::path wavDirect  = base.string() + "_direct.wav";
@@ -473,48 +514,47 @@ int main(int argc, char** argv)
         const fs::path wavAmbient = base.string() + "_ambient.wav";
 
         const std::string relative = fs::relative(pingPath, root).string();
-        std::cout << "[" << (done + failed + skipped + 1) << "/" << sidecars.size()
-                  << "] " << relative << "\n";
+        out << "[" << (index + 1) << "/" << sidecars.size()
+            << "] " << relative << "\n";
 
         // Parse sidecar.
         std::string xml = readFileAll(pingPath);
         if (xml.empty())
         {
-            std::cerr << "    ERROR: cannot read " << pingPath << "\n";
-            ++failed;
-            continue;
+            err << "    ERROR: cannot read " << pingPath << "\n";
+            return Status::Failed;
         }
         bool parseOk = false;
         auto attrs = parsePingAttrs(xml, parseOk);
         if (!parseOk)
         {
-            std::cerr << "    ERROR: no <irSynthParams> element found\n";
-            ++failed;
-            continue;
+            err << "    ERROR: no <irSynthParams> element found\n";
+            return Status::Failed;
         }
 
         IRSynthParams p = paramsFromPingAttrs(attrs);
 
         if (!quiet)
         {
-            std::cout << "    shape=" << p.shape
-                      << "  W×D×H=" << p.width << "×" << p.depth << "×" << p.height
-                      << "  sr=" << p.sample_rate
-                      << "  direct=" << (p.direct_enabled  ? 1 : 0)
-                      << "  outrig=" << (p.outrig_enabled  ? 1 : 0)
-                      << "  ambient=" << (p.ambient_enabled ? 1 : 0) << "\n";
+            out << "    shape=" << p.shape
+                << "  W×D×H=" << p.width << "×" << p.depth << "×" << p.height
+                << "  sr=" << p.sample_rate
+                << "  direct=" << (p.direct_enabled  ? 1 : 0)
+                << "  outrig=" << (p.outrig_enabled  ? 1 : 0)
+                << "  ambient=" << (p.ambient_enabled ? 1 : 0) << "\n";
         }
 
         if (dryRun)
         {
-            ++skipped;
-            continue;
+            return Status::Skipped;
         }
 
         // Synthesise using the current engine.
         auto t0 = std::chrono::steady_clock::now();
+        // Live progress only when sidecars run one at a time; concurrent
+        // rebakes would overwrite each other's \r line.
         IRSynthProgressFn cb;
-        if (!quiet)
+        if (!quiet && numThreads <= 1)
         {
             cb = [](double frac, const std::string& msg) {
                 std::cout << "    " << (int)(frac * 100.0) << "% " << msg << "            \r";
@@ -527,10 +567,11 @@ int main(int argc, char** argv)
 
         if (!result.success)
         {
-            std::cerr << "    ERROR: synthIR failed: " << result.errorMessage << "\n";
-            ++failed;
-            continue;
+            err << "    ERROR: synthIR failed: " << result.errorMessage << "\n";
+            return Status::Failed;
         }
+        profiles[index] = "{\"name\":" + jsonString(relative)
+                        + ",\"profile\":" + result.profile.toJson() + "}";
 
         // Per-channel peak amplitude readout. Useful for spotting any IR
         // that's heading toward 0 dBFS (which would clip when written to
@@ -551,14 +592,14 @@ int main(int argc, char** argv)
                 char buf[32]; std::snprintf(buf, sizeof buf, "%6.2f", 20.0 * std::log10(x));
                 return std::string(buf);
             };
-            std::cout << "    peak (dBFS):  LL=" << db(pLL) << "  RL=" << db(pRL)
-                      << "  LR=" << db(pLR) << "  RR=" << db(pRR);
+            out << "    peak (dBFS):  LL=" << db(pLL) << "  RL=" << db(pRL)
+                << "  LR=" << db(pLR) << "  RR=" << db(pRR);
             // Echo the v2.14.2 telemetry: pre-trim peak (across all paths)
             // and the auto-trim that was applied. -inf shown as "silent".
             char gbuf[32];
             std::snprintf(gbuf, sizeof gbuf, "%.2f", result.applied_gain_db);
-            std::cout << "   pre-trim peak=" << result.measured_peak_dbfs
-                      << " dBFS  gain=" << gbuf << " dB\n";
+            out << "   pre-trim peak=" << result.measured_peak_dbfs
+                << " dBFS  gain=" << gbuf << " dB\n";
         }
 
         // If the engine applied a non-trivial auto-trim, lock that gain
@@ -572,30 +613,29 @@ int main(int argc, char** argv)
         {
             if (writeSynthGainToSidecar(pingPath, result.applied_gain_db))
             {
-                if (!quiet) std::cout << "    sidecar: synthGain=\""
-                                      << result.applied_gain_db << "\" written\n";
+                if (!quiet) out << "    sidecar: synthGain=\""
+                                << result.applied_gain_db << "\" written\n";
             }
             else
             {
-                std::cerr << "    WARN: failed to update synthGain in "
-                          << pingPath << "\n";
+                err << "    WARN: failed to update synthGain in "
+                    << pingPath << "\n";
             }
         }
 
         if (!quiet)
-            std::cout << "    Done in " << elapsed << " s ("
-                      << (result.irLen / result.sampleRate) << " s IR)\n";
+            out << "    Done in " << elapsed << " s ("
+                << (result.irLen / result.sampleRate) << " s IR)\n";
 
         // Write MAIN .wav.
         auto mainBytes = IRSynthEngine::makeWav(
             result.iLL, result.iRL, result.iLR, result.iRR, result.sampleRate);
         if (!writeBytes(wavMain, mainBytes.data(), mainBytes.size()))
         {
-            std::cerr << "    ERROR writing " << wavMain << "\n";
-            ++failed;
-            continue;
+            err << "    ERROR writing " << wavMain << "\n";
+            return Status::Failed;
         }
-        if (!quiet) std::cout << "    MAIN:    " << wavMain.filename() << " (" << (mainBytes.size() / 1024) << " KB)\n";
+        if (!quiet) out << "    MAIN:    " << wavMain.filename() << " (" << (mainBytes.size() / 1024) << " KB)\n";
 
         // Write aux .wavs (only those the sidecar requested AND that the
         // engine actually synthesised).  The sibling-WAV autoload in the
@@ -606,23 +646,63 @@ int main(int argc, char** argv)
             {
                 std::error_code ec;
                 if (fs::remove(outP, ec) && !quiet)
-                    std::cout << "    " << label << ":  (removed stale " << outP.filename() << ")\n";
+                    out << "    " << label << ":  (removed stale " << outP.filename() << ")\n";
                 return;
             }
             auto bytes = IRSynthEngine::makeWav(ch.LL, ch.RL, ch.LR, ch.RR, result.sampleRate);
             if (!writeBytes(outP, bytes.data(), bytes.size()))
             {
-                std::cerr << "    ERROR writing " << outP << "\n";
+                err << "    ERROR writing " << outP << "\n";
                 return;
             }
-            if (!quiet) std::cout << "    " << label << ":  " << outP.filename()
-                                  << " (" << (bytes.size() / 1024) << " KB)\n";
+            if (!quiet) out << "    " << label << ":  " << outP.filename()
+                            << " (" << (bytes.size() / 1024) << " KB)\n";
         };
         writeAux(result.direct,  wavDirect,  "DIRECT ");
         writeAux(result.outrig,  wavOutrig,  "OUTRIG ");
         writeAux(result.ambient, wavAmbient, "AMBIENT");
 
-        ++done;
+        return Status::Done;
+    };
+
+    std::mutex logMutex;
+    std::atomic<int> done { 0 }, failed { 0 }, skipped { 0 };
+    {
+        SynthTaskPool::TaskGroup jobs;
+        for (size_t i = 0; i < sidecars.size(); ++i)
+            jobs.run ([&, i]
+            {
+                std::ostringstream out, err;
+                const auto status = rebake (i, out, err);
+                std::lock_guard<std::mutex> lock (logMutex);
+                std::cout << out.str();
+                std::cerr << err.str();
+                std::cout.flush();
+                (status == Status::Done ? done : status == Status::Failed ? failed : skipped)++;
+            });
+        jobs.wait();
+    }
+
+    if (!profilePath.empty() && !dryRun)
+    {
+        std::string json = "{\"venues\":[";
+        bool first = true;
+        for (const auto& v : profiles)
+        {
+            if (v.empty()) continue;
+            json += (first ? "\n  " : ",\n  ") + v;
+            first = false;
+        }
+        json += "\n]}\n";
+        std::ofstream f(profilePath);
+        f << json;
+        if (f)
+            std::cout << "Profile: " << profilePath << "\n";
+        else
+        {
+            std::cerr << "ERROR writing profile: " << profilePath << "\n";
+            failed++;
+        }
     }
 
     std::cout << "\n=== Complete: " << done << " rebaked"